@@ -25,6 +25,7 @@ using graphics_engine::engine::Render;
 using graphics_engine::engine::SetBackgroundColor;
 using graphics_engine::gl_clear_flags::CreateIGLClearFlags;
 using graphics_engine::gl_clear_flags::IGLClearFlagsPtr;
+using graphics_engine::gl_wrappers::CheckDeferredErrors;
 using graphics_engine::gl_wrappers::Clear;
 using graphics_engine::image::CaptureScreenshot;
 using graphics_engine::types::Expected;
@@ -98,6 +99,13 @@ auto main() -> int {
       return err.value();
     }
 
+    Expected<void> frame_errors = CheckDeferredErrors("frame");
+    if (!frame_errors.has_value()) {
+      const error_code& err = frame_errors.error();
+      cerr << err.message() << '\n';
+      return err.value();
+    }
+
     glfwSwapBuffers(window);
     assert(glfwGetError(nullptr) == GLFW_NO_ERROR);
 
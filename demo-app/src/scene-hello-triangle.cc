@@ -6,13 +6,14 @@
 
 #include <array>
 #include <cassert>
+#include <cstdint>
 
 #include "graphics-engine/gl-types.h"
 #include "graphics-engine/gl-wrappers.h"
 #include "graphics-engine/i-shader.h"
+#include "graphics-engine/quantize.h"
 
 using enum graphics_engine::gl_types::GLBufferTarget;
-using enum graphics_engine::gl_types::GLDataType;
 using enum graphics_engine::gl_types::GLDataUsagePattern;
 using enum graphics_engine::gl_types::GLDrawMode;
 using enum graphics_engine::gl_types::GLShaderType;
@@ -26,6 +27,8 @@ using graphics_engine::gl_wrappers::GenBuffers;
 using graphics_engine::gl_wrappers::GenVertexArrays;
 using graphics_engine::gl_wrappers::UseProgram;
 using graphics_engine::gl_wrappers::VertexAttribPointer;
+using graphics_engine::quantize::kPositionFormat;
+using graphics_engine::quantize::PackPositions;
 using graphics_engine::shader::CreateIShader;
 using graphics_engine::types::Expected;
 using graphics_engine::types::ShaderSourceMap;
@@ -52,13 +55,21 @@ void main()
   const ShaderSourceMap sources = {{kVertex, vs_src}, {kFragment, fs_src}};
   shader_ = CreateIShader(sources);
 
-  const std::array<float, 9> vertices = {
+  const std::array<float, 9> positions = {
       -0.5F, -0.5F, 0.0F,  // left
       0.5F,  -0.5F, 0.0F,  // right
       0.0F,  0.5F,  0.0F   // top
   };
 
-  Expected<void> result = GenVertexArrays(1, &vao_);
+  // Upload the positions as half floats, half the size of the float data.
+  std::array<std::uint16_t, 12> vertices{};
+  Expected<void> result = PackPositions(positions, vertices);
+  if (!result.has_value()) {
+    assert(false);
+    return std::unexpected(result.error());
+  }
+
+  result = GenVertexArrays(1, &vao_);
   if (!result.has_value()) {
     assert(false);
     return std::unexpected(result.error());
@@ -89,7 +100,9 @@ void main()
     return std::unexpected(result.error());
   }
 
-  result = VertexAttribPointer(0, 3, kFloat, 0, 3 * sizeof(float), nullptr);
+  result = VertexAttribPointer(0, kPositionFormat.size, kPositionFormat.type,
+                               kPositionFormat.normalized,
+                               kPositionFormat.bytes, nullptr);
   if (!result.has_value()) {
     assert(false);
     return std::unexpected(result.error());
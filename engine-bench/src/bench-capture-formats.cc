@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench.h"
+#include "graphics-engine/image.h"
+#include "graphics-engine/types.h"
+
+using enum graphics_engine::image::ImageFormat;
+
+using graphics_engine::image::EncodeImage;
+using graphics_engine::image::EncodeOptions;
+using graphics_engine::image::ImageView;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::byte;
+using std::cerr;
+using std::cout;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace engine_bench {
+
+namespace {
+
+constexpr int kWidth = 1280;
+constexpr int kHeight = 720;
+constexpr int kChannels = 4;
+constexpr int kIterations = 5;
+
+struct FormatCase {
+  string_view name;
+  EncodeOptions options;
+};
+
+// Something like a rendered frame: a smooth gradient with flat rectangles and
+// a little per-pixel noise, so neither the compressors nor the run-length
+// paths get an unrealistically easy input.
+auto MakeFrame() -> vector<byte> {
+  vector<byte> pixels(static_cast<size_t>(kWidth) * kHeight * kChannels);
+  std::uint32_t noise = 1;
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      noise = (noise * 1664525U) + 1013904223U;
+      const bool in_rect = (x / 160 + y / 90) % 3 == 0;
+      const size_t i = ((static_cast<size_t>(y) * kWidth) + x) * kChannels;
+      const auto jitter = static_cast<int>((noise >> 24U) & 3U);
+      pixels[i] = static_cast<byte>(in_rect ? 200 : (x * 255 / kWidth));
+      pixels[i + 1] = static_cast<byte>(in_rect ? 64 : (y * 255 / kHeight));
+      pixels[i + 2] = static_cast<byte>((128 + jitter) & 0xFF);
+      pixels[i + 3] = byte{255};
+    }
+  }
+  return pixels;
+}
+
+}  // namespace
+
+auto RunCaptureFormatBenchmarks() -> void {
+  const vector<byte> pixels = MakeFrame();
+  const ImageView frame{.width = kWidth,
+                        .height = kHeight,
+                        .channels = kChannels,
+                        .pixels = pixels,
+                        .bottom_up = true};
+  const double megabytes = static_cast<double>(pixels.size()) / 1e6;
+
+  const array<FormatCase, 7> cases = {{
+      {.name = "png, level 0", .options = {.format = kPng,
+                                           .png_compression_level = 0}},
+      {.name = "png, level 1", .options = {.format = kPng,
+                                           .png_compression_level = 1}},
+      {.name = "png, level 8 (default)", .options = {}},
+      {.name = "png, level 9", .options = {.format = kPng,
+                                           .png_compression_level = 9}},
+      {.name = "qoi", .options = {.format = kQoi}},
+      {.name = "pam", .options = {.format = kPam}},
+      {.name = "ppm", .options = {.format = kPpm}},
+  }};
+
+  cout << "Capture encode throughput (" << kWidth << "x" << kHeight
+       << " RGBA, " << kIterations << " iterations)\n";
+
+  for (const FormatCase& format_case : cases) {
+    Expected<vector<byte>> encoded;
+    const double nanoseconds = MeasureNanoseconds(kIterations, [&]() {
+      encoded = EncodeImage(frame, format_case.options);
+    });
+    if (!encoded.has_value()) {
+      cerr << "  EncodeImage failed: " << encoded.error().message() << '\n';
+      return;
+    }
+
+    const double ratio = static_cast<double>(encoded->size()) /
+                         static_cast<double>(pixels.size());
+    const string name = "  " + string(format_case.name) + " (" +
+                        std::to_string(static_cast<int>(ratio * 100)) +
+                        "% of raw)";
+    PrintThroughput(name, megabytes / (nanoseconds / 1e9));
+  }
+}
+
+}  // namespace engine_bench
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+#include <utility>
+
+#include "bench.h"
+#include "graphics-engine/gl-types.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLDrawMode;
+using enum graphics_engine::gl_types::GLErrorPolicy;
+
+using graphics_engine::gl_types::GLErrorPolicy;
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::CheckDeferredErrors;
+using graphics_engine::gl_wrappers::DrawArrays;
+using graphics_engine::gl_wrappers::GetErrorPolicy;
+using graphics_engine::gl_wrappers::GetStateCacheStats;
+using graphics_engine::gl_wrappers::ResetStateCacheStats;
+using graphics_engine::gl_wrappers::SetErrorPolicy;
+using graphics_engine::gl_wrappers::StateCacheStats;
+using graphics_engine::gl_wrappers::UseProgram;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::cerr;
+using std::cout;
+using std::pair;
+using std::size_t;
+using std::string_view;
+
+namespace engine_bench {
+
+namespace {
+
+constexpr int kNumFrames = 100;
+constexpr int kDrawsPerFrame = 1000;
+
+}  // namespace
+
+auto RunErrorPolicyBenchmarks() -> void {
+  // Two programs and VAOs, so that alternating between them changes state on
+  // every draw and the state cache can't skip the calls being timed.
+  array<TriangleFixture, 2> fixtures;
+  for (TriangleFixture& fixture : fixtures) {
+    Expected<TriangleFixture> created = CreateTriangleFixture();
+    if (!created.has_value()) {
+      cerr << "CreateTriangleFixture failed: " << created.error().message()
+           << '\n';
+      return;
+    }
+    fixture = std::move(*created);
+  }
+  const array<unsigned int, 2> programs = {
+      fixtures[0].shader->GetProgramId(), fixtures[1].shader->GetProgramId()};
+  const array<unsigned int, 2> vaos = {fixtures[0].vao, fixtures[1].vao};
+
+  // Each frame issues kDrawsPerFrame program/VAO/draw triples and checks for
+  // deferred errors once at the end, the way a render loop would.
+  auto frame = [&programs, &vaos]() {
+    for (int i = 0; i < kDrawsPerFrame; ++i) {
+      const auto which = static_cast<size_t>(i % 2);
+      (void)UseProgram(programs[which]);
+      (void)BindVertexArray(vaos[which]);
+      (void)DrawArrays(kTriangles, 0, 3);
+    }
+    (void)CheckDeferredErrors("frame");
+  };
+
+  cout << "gl_wrappers error policy (" << kNumFrames << " frames x "
+       << kDrawsPerFrame << " draws)\n";
+
+  const GLErrorPolicy original_policy = GetErrorPolicy();
+  const array<pair<GLErrorPolicy, string_view>, 3> policies = {{
+      {kCheckEveryCall, "  kCheckEveryCall, per draw"},
+      {kCheckDeferred, "  kCheckDeferred, per draw"},
+      {kCheckNone, "  kCheckNone, per draw"},
+  }};
+  for (const auto& [policy, name] : policies) {
+    SetErrorPolicy(policy);
+    frame();  // Warm up.
+    ResetStateCacheStats();
+    const double ns_per_frame = MeasureNanoseconds(kNumFrames, frame);
+    PrintResult(name, ns_per_frame / kDrawsPerFrame);
+    if (const StateCacheStats stats = GetStateCacheStats(); stats.skipped > 0) {
+      cerr << "  state cache skipped " << stats.skipped
+           << " calls; the policies aren't compared on equal terms\n";
+    }
+  }
+
+  SetErrorPolicy(original_policy);
+}
+
+}  // namespace engine_bench
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <iostream>
+
+#include "bench.h"
+#include "graphics-engine/gl-types.h"
+#include "graphics-engine/gl-wrappers.h"
+#include "graphics-engine/i-indirect-command-builder.h"
+
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::gl_types::GLDrawMode;
+
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::DrawArrays;
+using graphics_engine::gl_wrappers::UseProgram;
+using graphics_engine::indirect_command_builder::CreateIIndirectCommandBuilder;
+using graphics_engine::indirect_command_builder::IIndirectCommandBuilderPtr;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::cout;
+
+namespace engine_bench {
+
+namespace {
+
+constexpr int kNumFrames = 50;
+constexpr int kDrawsPerFrame = 10000;
+
+}  // namespace
+
+auto RunIndirectDrawBenchmarks() -> void {
+  Expected<TriangleFixture> fixture = CreateTriangleFixture();
+  if (!fixture.has_value()) {
+    cerr << "CreateTriangleFixture failed: " << fixture.error().message()
+         << '\n';
+    return;
+  }
+
+  (void)UseProgram(fixture->shader->GetProgramId());
+  (void)BindVertexArray(fixture->vao);
+
+  cout << "Individual vs indirect draws (" << kNumFrames << " frames x "
+       << kDrawsPerFrame << " draws)\n";
+
+  const double individual_ns = MeasureNanoseconds(kNumFrames, []() {
+    for (int i = 0; i < kDrawsPerFrame; ++i) {
+      (void)DrawArrays(kTriangles, 0, 3);
+    }
+  });
+  PrintResult("  DrawArrays x 10k, per frame", individual_ns);
+
+  // Rebuilding the command list each frame is part of the cost being measured.
+  IIndirectCommandBuilderPtr builder = CreateIIndirectCommandBuilder();
+  Expected<void> result;
+  const double indirect_ns = MeasureNanoseconds(kNumFrames, [&]() {
+    builder->Clear();
+    for (int i = 0; i < kDrawsPerFrame; ++i) {
+      builder->AddDrawArrays({.count = 3, .first = 0});
+    }
+    result = builder->Draw(kTriangles, kUnsignedInt);
+  });
+  if (!result.has_value()) {
+    cerr << "  MultiDrawArraysIndirect failed: " << result.error().message()
+         << '\n';
+    return;
+  }
+  PrintResult("  MultiDrawArraysIndirect x 1, per frame", indirect_ns);
+}
+
+}  // namespace engine_bench
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+
+#include "bench.h"
+#include "graphics-engine/i-shader.h"
+
+using graphics_engine::shader::CreateIShader;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader::ShaderOptions;
+
+using std::cerr;
+using std::cout;
+using std::filesystem::path;
+
+namespace engine_bench {
+
+namespace {
+
+constexpr int kProgramCount = 32;
+
+auto MeasureStartup(long long int salt, const ShaderOptions& options,
+                    bool& failed, bool& from_cache) -> double {
+  int index = 0;
+  from_cache = true;
+  return MeasureNanoseconds(kProgramCount, [&]() {
+    IShaderPtr shader =
+        CreateIShader(MakeShaderSources(salt, index++), options);
+    failed |= shader == nullptr;
+    from_cache &= shader != nullptr && shader->IsFromBinaryCache();
+  });
+}
+
+}  // namespace
+
+auto RunShaderCacheBenchmarks() -> void {
+  const path directory =
+      std::filesystem::temp_directory_path() / "engine-bench-shader-cache";
+  std::error_code ignored;
+  std::filesystem::remove_all(directory, ignored);
+  const long long int salt =
+      std::chrono::steady_clock::now().time_since_epoch().count() % 1000000;
+
+  cout << "Shader startup time per program (" << kProgramCount
+       << " programs)\n";
+
+  bool failed = false;
+  bool from_cache = false;
+  const double uncached = MeasureStartup(salt, {}, failed, from_cache);
+  const ShaderOptions cached{.binary_cache_directory = directory};
+  const double cold = MeasureStartup(salt + 1, cached, failed, from_cache);
+  const double warm = MeasureStartup(salt + 1, cached, failed, from_cache);
+  if (failed) {
+    cerr << "  CreateIShader failed\n";
+  } else {
+    PrintResult("  compile and link, no cache", uncached);
+    PrintResult("  cold cache (compile, link, store)", cold);
+    if (from_cache) {
+      PrintResult("  warm cache (glProgramBinary)", warm);
+    } else {
+      cout << "  warm cache skipped: the driver provides no program "
+              "binaries\n";
+    }
+  }
+
+  std::filesystem::remove_all(directory, ignored);
+}
+
+}  // namespace engine_bench
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GLFW/glfw3.h"
+#include "bench.h"
+#include "graphics-engine/i-shader-compiler.h"
+#include "graphics-engine/i-shader.h"
+#include "graphics-engine/types.h"
+
+using enum graphics_engine::shader_compiler::ShaderCompileMode;
+
+using graphics_engine::shader::CreateIShader;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader_compiler::CreateIShaderCompiler;
+using graphics_engine::shader_compiler::ShaderCompileHandle;
+using graphics_engine::shader_compiler::ShaderCompileMode;
+using graphics_engine::shader_compiler::ShaderCompilerOptions;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::cout;
+using std::string;
+using std::vector;
+
+namespace engine_bench {
+
+namespace {
+
+constexpr int kProgramCount = 128;
+
+auto GetModeName(ShaderCompileMode mode) -> string {
+  switch (mode) {
+    case kParallelExtension:
+      return "KHR_parallel_shader_compile";
+    case kWorkerContext:
+      return "worker context";
+    case kDeferredStatus:
+    default:
+      return "deferred status";
+  }
+}
+
+// Submit every program, then wait for all of them, as a loading screen
+// would. Returns the mean time per program, or a negative value on failure.
+auto MeasureCompiler(long long int salt, ShaderCompilerOptions options,
+                     ShaderCompileMode& mode) -> double {
+  auto compiler = CreateIShaderCompiler(std::move(options));
+  if (!compiler.has_value()) {
+    return -1.0;
+  }
+  mode = (*compiler)->GetMode();
+
+  bool failed = false;
+  const double nanoseconds = MeasureNanoseconds(1, [&]() {
+    vector<ShaderCompileHandle> handles;
+    handles.reserve(kProgramCount);
+    for (int i = 0; i < kProgramCount; ++i) {
+      handles.push_back((*compiler)->Submit(MakeShaderSources(salt, i)));
+    }
+    for (const ShaderCompileHandle handle : handles) {
+      failed |= !(*compiler)->Wait(handle).has_value();
+    }
+  });
+  return failed ? -1.0 : nanoseconds / kProgramCount;
+}
+
+auto PrintCompilerResult(ShaderCompileMode mode, double nanoseconds) -> void {
+  const string name = "  IShaderCompiler, " + GetModeName(mode);
+  if (nanoseconds < 0.0) {
+    cerr << name << " failed\n";
+  } else {
+    PrintResult(name, nanoseconds);
+  }
+}
+
+}  // namespace
+
+auto RunShaderCompilerBenchmarks() -> void {
+  // Each case gets its own salt so none of them hits the driver's cache.
+  long long int salt =
+      std::chrono::steady_clock::now().time_since_epoch().count() % 1000000;
+
+  cout << "Shader load time per program (" << kProgramCount
+       << " programs submitted at once)\n";
+
+  int index = 0;
+  bool failed = false;
+  const double blocking = MeasureNanoseconds(kProgramCount, [&]() {
+    IShaderPtr shader = CreateIShader(MakeShaderSources(salt, index++));
+    failed |= shader == nullptr;
+  });
+  if (failed) {
+    cerr << "  CreateIShader failed\n";
+  } else {
+    PrintResult("  CreateIShader, one at a time", blocking);
+  }
+
+  ShaderCompileMode mode{};
+  double nanoseconds = MeasureCompiler(++salt, {}, mode);
+  PrintCompilerResult(mode, nanoseconds);
+  if (mode == kParallelExtension) {
+    nanoseconds =
+        MeasureCompiler(++salt, {.prefer_parallel_extension = false}, mode);
+    PrintCompilerResult(mode, nanoseconds);
+  }
+
+  // A hidden window whose context shares objects with the benchmark's.
+  GLFWwindow* worker_window =
+      glfwCreateWindow(1, 1, "", nullptr, glfwGetCurrentContext());
+  if (worker_window == nullptr) {
+    cout << "  worker context skipped: no shared context\n";
+    return;
+  }
+  ShaderCompilerOptions options{.prefer_parallel_extension = false};
+  options.make_worker_context_current = [worker_window]() {
+    glfwMakeContextCurrent(worker_window);
+    return glfwGetCurrentContext() == worker_window;
+  };
+  options.release_worker_context = []() { glfwMakeContextCurrent(nullptr); };
+  nanoseconds = MeasureCompiler(++salt, std::move(options), mode);
+  PrintCompilerResult(mode, nanoseconds);
+  glfwDestroyWindow(worker_window);
+}
+
+}  // namespace engine_bench
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "bench.h"
+#include "graphics-engine/i-shader-registry.h"
+#include "graphics-engine/i-shader.h"
+
+using graphics_engine::shader::CreateIShader;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader_registry::CreateIShaderRegistry;
+using graphics_engine::shader_registry::SharedShader;
+
+using std::cerr;
+using std::cout;
+using std::vector;
+
+namespace engine_bench {
+
+namespace {
+
+// A scene of kObjectCount objects drawn with kMaterialCount programs.
+constexpr int kObjectCount = 256;
+constexpr int kMaterialCount = 8;
+
+}  // namespace
+
+auto RunShaderRegistryBenchmarks() -> void {
+  // Each case gets its own salt so neither hits the driver's cache.
+  const long long int salt =
+      std::chrono::steady_clock::now().time_since_epoch().count() % 1000000;
+
+  cout << "Shader setup time per object (" << kObjectCount << " objects, "
+       << kMaterialCount << " distinct programs)\n";
+
+  int object = 0;
+  bool failed = false;
+  const double separate = MeasureNanoseconds(kObjectCount, [&]() {
+    IShaderPtr shader =
+        CreateIShader(MakeShaderSources(salt, object++ % kMaterialCount));
+    failed |= shader == nullptr;
+  });
+  if (failed) {
+    cerr << "  CreateIShader failed\n";
+  } else {
+    PrintResult("  CreateIShader per object", separate);
+  }
+
+  auto registry = CreateIShaderRegistry();
+  if (!registry.has_value()) {
+    cerr << "  CreateIShaderRegistry failed\n";
+    return;
+  }
+  vector<SharedShader> shaders;
+  shaders.reserve(kObjectCount);
+  object = 0;
+  failed = false;
+  const double shared = MeasureNanoseconds(kObjectCount, [&]() {
+    auto shader = (*registry)->Acquire(
+        MakeShaderSources(salt + 1, object++ % kMaterialCount));
+    failed |= !shader.has_value();
+    if (shader.has_value()) {
+      shaders.push_back(*shader);
+    }
+  });
+  if (failed) {
+    cerr << "  IShaderRegistry::Acquire failed\n";
+  } else {
+    PrintResult("  IShaderRegistry::Acquire", shared);
+    cout << "  programs compiled: " << (*registry)->GetStats().misses << '\n';
+  }
+}
+
+}  // namespace engine_bench
@@ -0,0 +1,140 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <vector>
+
+#include "bench.h"
+#include "graphics-engine/i-texture-loader.h"
+#include "graphics-engine/image.h"
+#include "graphics-engine/texture-container.h"
+#include "graphics-engine/types.h"
+
+using graphics_engine::image::EncodeImage;
+using graphics_engine::image::ImageView;
+using graphics_engine::texture_container::ConvertToTextureContainer;
+using graphics_engine::texture_container::LoadTextureContainer;
+using graphics_engine::texture_loader::CreateITextureLoader;
+using graphics_engine::texture_loader::DeleteTexture;
+using graphics_engine::texture_loader::Texture;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::cerr;
+using std::cout;
+using std::size_t;
+using std::vector;
+using std::filesystem::path;
+
+namespace engine_bench {
+
+namespace {
+
+constexpr int kWidth = 2048;
+constexpr int kHeight = 2048;
+constexpr int kChannels = 4;
+constexpr int kIterations = 10;
+
+// A texture-like pattern: tiles with a gradient and some noise, so the PNG
+// doesn't compress down to nothing.
+auto MakeTexture() -> vector<byte> {
+  vector<byte> pixels(static_cast<size_t>(kWidth) * kHeight * kChannels);
+  std::uint32_t noise = 1;
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      noise = (noise * 1664525U) + 1013904223U;
+      const size_t i = ((static_cast<size_t>(y) * kWidth) + x) * kChannels;
+      const bool dark = ((x / 128) + (y / 128)) % 2 == 0;
+      const auto jitter = static_cast<int>((noise >> 24U) & 7U);
+      pixels[i] = static_cast<byte>(((x & 0xFF) + jitter) & 0xFF);
+      pixels[i + 1] = static_cast<byte>(((y & 0xFF) + jitter) & 0xFF);
+      pixels[i + 2] = static_cast<byte>(dark ? 40 + jitter : 200 + jitter);
+      pixels[i + 3] = byte{255};
+    }
+  }
+  return pixels;
+}
+
+auto WriteFile(const path& file, const vector<byte>& bytes) -> bool {
+  std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  stream.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+  return static_cast<bool>(stream);
+}
+
+}  // namespace
+
+auto RunTextureContainerBenchmarks() -> void {
+  const path directory = std::filesystem::temp_directory_path();
+  const path png = directory / "engine-bench-texture.png";
+  const path container = directory / "engine-bench-texture.getex";
+
+  const vector<byte> pixels = MakeTexture();
+  Expected<vector<byte>> encoded = EncodeImage(ImageView{.width = kWidth,
+                                                         .height = kHeight,
+                                                         .channels = kChannels,
+                                                         .pixels = pixels,
+                                                         .bottom_up = false});
+  if (!encoded.has_value() || !WriteFile(png, *encoded)) {
+    cerr << "  Failed to write " << png << '\n';
+    return;
+  }
+  if (auto converted = ConvertToTextureContainer(png, container);
+      !converted.has_value()) {
+    cerr << "  ConvertToTextureContainer failed: "
+         << converted.error().message() << '\n';
+    return;
+  }
+
+  auto loader = CreateITextureLoader({.worker_count = 1});
+  if (!loader.has_value()) {
+    cerr << "  CreateITextureLoader failed: " << loader.error().message()
+         << '\n';
+    return;
+  }
+
+  cout << "Texture startup time (" << kWidth << "x" << kHeight
+       << " RGBA with mipmaps, " << kIterations
+       << " iterations, until the texture is usable)\n";
+
+  // Decode, upload and glGenerateMipmap, the path every PNG takes today.
+  bool failed = false;
+  const double png_nanoseconds = MeasureNanoseconds(kIterations, [&]() {
+    auto future = (*loader)->Load(png);
+    failed |= !(*loader)->Flush().has_value();
+    Expected<Texture> texture = future.get();
+    failed |= !texture.has_value();
+    if (texture.has_value()) {
+      DeleteTexture(*texture);
+    }
+  });
+
+  // Map the file and upload every stored level from the mapping.
+  const double container_nanoseconds = MeasureNanoseconds(kIterations, [&]() {
+    Expected<Texture> texture = LoadTextureContainer(container);
+    failed |= !texture.has_value();
+    if (texture.has_value()) {
+      DeleteTexture(*texture);
+    }
+  });
+
+  if (failed) {
+    cerr << "  A texture failed to load\n";
+  } else {
+    PrintResult("  png via ITextureLoader", png_nanoseconds);
+    PrintResult("  LoadTextureContainer", container_nanoseconds);
+  }
+
+  std::error_code ignored;
+  std::filesystem::remove(png, ignored);
+  std::filesystem::remove(container, ignored);
+}
+
+}  // namespace engine_bench
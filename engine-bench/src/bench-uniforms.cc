@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <cstdint>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <iostream>
+#include <string>
+
+#include "bench.h"
+#include "graphics-engine/i-shader.h"
+#include "graphics-engine/types.h"
+
+using enum graphics_engine::gl_types::GLShaderType;
+
+using graphics_engine::shader::CreateIShader;
+using graphics_engine::shader::HashUniformName;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader::UniformStats;
+
+using std::cerr;
+using std::cout;
+using std::string;
+
+namespace engine_bench {
+
+namespace {
+
+constexpr int kDrawCount = 100000;
+
+constexpr std::uint32_t kModel = HashUniformName("model");
+constexpr std::uint32_t kTint = HashUniformName("tint");
+
+const string kVertexSource = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+uniform mat4 model;
+void main()
+{
+  gl_Position = model * vec4(aPos, 1.0);
+})";
+
+const string kFragmentSource = R"(#version 330 core
+uniform vec3 tint;
+out vec4 FragColor;
+void main()
+{
+  FragColor = vec4(tint, 1.0);
+})";
+
+}  // namespace
+
+auto RunUniformBenchmarks() -> void {
+  IShaderPtr shader =
+      CreateIShader({{kVertex, kVertexSource}, {kFragment, kFragmentSource}});
+  if (shader == nullptr) {
+    cerr << "  CreateIShader failed\n";
+    return;
+  }
+
+  cout << "Uniform updates per draw (mat4 and vec3, " << kDrawCount
+       << " draws)\n";
+
+  const double lookup = MeasureNanoseconds(kDrawCount, [&]() {
+    const int model = shader->GetUniformLocation(kModel);
+    const int tint = shader->GetUniformLocation(kTint);
+    (void)shader->SetUniform(model, glm::mat4(1.0F));
+    (void)shader->SetUniform(tint, glm::vec3(1.0F, 0.5F, 0.2F));
+  });
+  PrintResult("  lookup by hash, unchanged values", lookup);
+
+  const int model = shader->GetUniformLocation(kModel);
+  const int tint = shader->GetUniformLocation(kTint);
+  int draw = 0;
+  const double changed = MeasureNanoseconds(kDrawCount, [&]() {
+    const auto value = static_cast<float>(draw++ % 2);
+    (void)shader->SetUniform(model, glm::mat4(value));
+    (void)shader->SetUniform(tint, glm::vec3(value, 0.5F, 0.2F));
+  });
+  PrintResult("  cached locations, values change every draw", changed);
+
+  const UniformStats stats = shader->GetUniformStats();
+  cout << "  calls issued: " << stats.issued
+       << ", skipped: " << stats.skipped << '\n';
+}
+
+}  // namespace engine_bench
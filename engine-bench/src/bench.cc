@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "bench.h"
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "graphics-engine/gl-types.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::gl_types::GLShaderType;
+
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::EnableVertexAttribArray;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::gl_wrappers::GenVertexArrays;
+using graphics_engine::gl_wrappers::VertexAttribPointer;
+using graphics_engine::shader::CreateIShader;
+using graphics_engine::types::Expected;
+using graphics_engine::types::ShaderSourceMap;
+
+using std::cout;
+using std::string;
+using std::string_view;
+
+namespace engine_bench {
+
+auto CreateTriangleFixture() -> Expected<TriangleFixture> {
+  const string vs_src = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+void main()
+{
+  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);
+})";
+
+  const string fs_src = R"(#version 330 core
+out vec4 FragColor;
+void main()
+{
+  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);
+})";
+
+  TriangleFixture fixture;
+  const ShaderSourceMap sources = {{kVertex, vs_src}, {kFragment, fs_src}};
+  fixture.shader = CreateIShader(sources);
+
+  const std::array<float, 9> vertices = {
+      -0.5F, -0.5F, 0.0F,  // left
+      0.5F,  -0.5F, 0.0F,  // right
+      0.0F,  0.5F,  0.0F   // top
+  };
+
+  Expected<void> result =
+      GenVertexArrays(1, &fixture.vao)
+          .and_then([&fixture]() { return BindVertexArray(fixture.vao); })
+          .and_then([&fixture]() { return GenBuffers(1, &fixture.vbo); })
+          .and_then([&fixture]() { return BindBuffer(kArray, fixture.vbo); })
+          .and_then([&vertices]() {
+            return BufferData(kArray, sizeof(vertices), vertices.data(),
+                              kStaticDraw);
+          })
+          .and_then([]() {
+            return VertexAttribPointer(0, 3, kFloat, 0, 3 * sizeof(float),
+                                       nullptr);
+          })
+          .and_then([]() { return EnableVertexAttribArray(0); });
+  if (!result.has_value()) {
+    return std::unexpected(result.error());
+  }
+
+  return fixture;
+}
+
+// `salt` makes the sources unique per run, so a driver's own shader cache
+// can't turn uncached compiles into cache hits.
+auto MakeShaderSources(long long int salt, int index) -> ShaderSourceMap {
+  const string constant =
+      std::to_string(salt) + ".0 + " + std::to_string(index) + ".0";
+  const string vs_src = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+out vec3 vPos;
+void main()
+{
+  vPos = aPos;
+  gl_Position = vec4(aPos, 1.0);
+})";
+  const string fs_src = R"(#version 330 core
+in vec3 vPos;
+out vec4 FragColor;
+const float kSalt = )" + constant + R"(;
+void main()
+{
+  vec3 color = vPos;
+  for (int i = 0; i < 16; ++i) {
+    color = sin(color * 3.1 + vec3(kSalt, float(i), 0.5)) * 0.5 + 0.5;
+    color = mix(color, color.zxy, 0.25);
+  }
+  FragColor = vec4(pow(color, vec3(2.2)), 1.0);
+})";
+  return {{kVertex, vs_src}, {kFragment, fs_src}};
+}
+
+auto PrintResult(string_view name, double nanoseconds) -> void {
+  cout << std::left << std::setw(48) << name << std::right << std::fixed
+       << std::setprecision(1) << std::setw(12) << nanoseconds << " ns\n";
+}
+
+auto PrintThroughput(string_view name, double megabytes_per_second) -> void {
+  cout << std::left << std::setw(48) << name << std::right << std::fixed
+       << std::setprecision(1) << std::setw(12) << megabytes_per_second
+       << " MB/s\n";
+}
+
+}  // namespace engine_bench
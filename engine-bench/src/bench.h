@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_BENCH_BENCH_H_
+#define ENGINE_BENCH_BENCH_H_
+
+#include <chrono>
+#include <string_view>
+
+#include "graphics-engine/i-shader.h"
+#include "graphics-engine/types.h"
+
+namespace engine_bench {
+
+/// @brief The GL objects needed to draw a single triangle.
+struct TriangleFixture {
+  graphics_engine::shader::IShaderPtr shader;
+  unsigned int vao{};
+  unsigned int vbo{};
+};
+
+/// @brief Create a shader, VAO and VBO holding one triangle.
+/// @return the fixture on success, error on failure.
+[[nodiscard]] auto CreateTriangleFixture()
+    -> graphics_engine::types::Expected<TriangleFixture>;
+
+/// @brief Sources for a program heavy enough that compiling it isn't
+/// dominated by call overhead, unique for each `salt` and `index`.
+[[nodiscard]] auto MakeShaderSources(long long int salt, int index)
+    -> graphics_engine::types::ShaderSourceMap;
+
+/// @brief Time `iterations` calls of `body`.
+/// @return The mean wall time of one call in nanoseconds.
+template <typename Body>
+[[nodiscard]] auto MeasureNanoseconds(int iterations, Body&& body) -> double {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    body();
+  }
+  const auto stop = std::chrono::steady_clock::now();
+  const std::chrono::duration<double, std::nano> elapsed = stop - start;
+  return elapsed.count() / iterations;
+}
+
+/// @brief Print one benchmark result line.
+auto PrintResult(std::string_view name, double nanoseconds) -> void;
+
+/// @brief Print one throughput result line.
+auto PrintThroughput(std::string_view name, double megabytes_per_second)
+    -> void;
+
+auto RunCaptureFormatBenchmarks() -> void;
+auto RunErrorPolicyBenchmarks() -> void;
+auto RunIndirectDrawBenchmarks() -> void;
+auto RunShaderCacheBenchmarks() -> void;
+auto RunShaderCompilerBenchmarks() -> void;
+auto RunShaderRegistryBenchmarks() -> void;
+auto RunTextureContainerBenchmarks() -> void;
+auto RunUniformBenchmarks() -> void;
+
+}  // namespace engine_bench
+
+#endif  // ENGINE_BENCH_BENCH_H_
@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <iostream>
+
+#include "GLFW/glfw3.h"
+#include "bench.h"
+#include "graphics-engine/engine.h"
+#include "graphics-engine/types.h"
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+
+auto main() -> int {
+  if (glfwInit() == GLFW_FALSE) {
+    cerr << "glfwInit failed.\n";
+    return -1;
+  }
+
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+  if (window == nullptr) {
+    cerr << "glfwCreateWindow failed.\n";
+    glfwTerminate();
+    return -1;
+  }
+
+  glfwMakeContextCurrent(window);
+
+  Expected<void> result = InitializeEngine();
+  if (!result.has_value()) {
+    cerr << result.error().message() << '\n';
+    glfwTerminate();
+    return -1;
+  }
+
+  engine_bench::RunErrorPolicyBenchmarks();
+  engine_bench::RunIndirectDrawBenchmarks();
+  engine_bench::RunCaptureFormatBenchmarks();
+  engine_bench::RunTextureContainerBenchmarks();
+  engine_bench::RunShaderCacheBenchmarks();
+  engine_bench::RunShaderCompilerBenchmarks();
+  engine_bench::RunShaderRegistryBenchmarks();
+  engine_bench::RunUniformBenchmarks();
+
+  glfwTerminate();
+  return 0;
+}
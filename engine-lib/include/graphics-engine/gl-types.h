@@ -13,12 +13,14 @@ enum class GLBufferTarget : std::uint8_t {
   kArray,
   kCopyRead,
   kCopyWrite,
+  kDrawIndirect,
   kElementArray,
   kPixelPack,
   kPixelUnpack,
   kTexture,
   kTransformFeedback,
-  kUniform
+  kUniform,
+  kNumTargets  // Sentinel value to track enum size
 };
 
 enum class GLClearBit : std::uint8_t { kColor, kDepth, kStencil, kNumBits };
@@ -63,6 +65,19 @@ enum class GLDrawMode : std::uint8_t {
   kTrianglesAdjacency
 };
 
+/// @brief Controls when the gl_wrappers functions query glGetError.
+///
+/// - kCheckEveryCall: query after every wrapped call (the most precise, and the
+///   slowest since glGetError may synchronize with the driver).
+/// - kCheckDeferred: skip the per-call query and record which calls were made;
+///   errors are collected and attributed by gl_wrappers::CheckDeferredErrors.
+/// - kCheckNone: never query glGetError.
+enum class GLErrorPolicy : std::uint8_t {
+  kCheckEveryCall,
+  kCheckDeferred,
+  kCheckNone
+};
+
 enum class GLShaderObjectParameter : std::uint8_t {
   kShaderType,
   kDeleteStatus,
@@ -6,7 +6,9 @@
 #define ENGINE_LIB_GL_WRAPPERS_H_
 
 #include <bitset>
+#include <cstdint>
 #include <memory>
+#include <string_view>
 
 #include "dll-export.h"
 #include "gl-types.h"
@@ -15,6 +17,12 @@
 
 namespace graphics_engine::gl_wrappers {
 
+/// @brief Counts of the state-setting calls seen by the state cache.
+struct StateCacheStats {
+  std::uint64_t issued{};   ///< Calls that changed state and reached OpenGL.
+  std::uint64_t skipped{};  ///< Calls skipped because nothing would change.
+};
+
 DLLEXPORT [[nodiscard]] auto AttachShader(unsigned int program,
                                           unsigned int shader)
     -> types::Expected<void>;
@@ -31,20 +39,82 @@ DLLEXPORT [[nodiscard]] auto BufferData(gl_types::GLBufferTarget target,
                                         gl_types::GLDataUsagePattern usage)
     -> types::Expected<void>;
 
+DLLEXPORT [[nodiscard]] auto BufferSubData(gl_types::GLBufferTarget target,
+                                           long long int offset,
+                                           long long int size,
+                                           const void* data)
+    -> types::Expected<void>;
+
+/// @brief Collect the OpenGL errors raised since the last check.
+/// @param scope A label (e.g. "frame") used when reporting the errors.
+/// @return void if no error was raised, otherwise the first error.
+/// @note Only has an effect under GLErrorPolicy::kCheckDeferred; the other
+/// policies return void without querying OpenGL.
+DLLEXPORT [[nodiscard]] auto CheckDeferredErrors(std::string_view scope)
+    -> types::Expected<void>;
+
 DLLEXPORT [[nodiscard]] auto Clear(const gl_clear_flags::IGLClearFlags& flags)
     -> types::Expected<void>;
 
 DLLEXPORT [[nodiscard]] auto CompileShader(unsigned int shader)
     -> types::Expected<void>;
 
+/// @brief Copy `size` bytes between the buffers bound to two targets, e.g.
+/// kCopyRead and kCopyWrite. The ranges must not overlap if both targets have
+/// the same buffer bound.
+DLLEXPORT [[nodiscard]] auto CopyBufferSubData(
+    gl_types::GLBufferTarget read_target, gl_types::GLBufferTarget write_target,
+    long long int read_offset, long long int write_offset, long long int size)
+    -> types::Expected<void>;
+
 DLLEXPORT [[nodiscard]] auto CreateProgram() -> types::Expected<unsigned int>;
 
 DLLEXPORT [[nodiscard]] auto CreateShader(gl_types::GLShaderType shader_type)
     -> types::Expected<unsigned int>;
 
+DLLEXPORT [[nodiscard]] auto DeleteBuffers(int n, const unsigned int* buffers)
+    -> types::Expected<void>;
+
+DLLEXPORT [[nodiscard]] auto DeleteVertexArrays(int n,
+                                                const unsigned int* arrays)
+    -> types::Expected<void>;
+
 DLLEXPORT [[nodiscard]] auto DrawArrays(gl_types::GLDrawMode mode, int first,
                                         int count) -> types::Expected<void>;
 
+/// @brief Draw `instance_count` copies of the vertices [first, first + count).
+/// Attributes with a non-zero VertexAttribDivisor advance per instance.
+DLLEXPORT [[nodiscard]] auto DrawArraysInstanced(gl_types::GLDrawMode mode,
+                                                 int first, int count,
+                                                 int instance_count)
+    -> types::Expected<void>;
+
+/// @brief Draw `count` indices from the bound kElementArray buffer.
+/// @param type kUnsignedByte, kUnsignedShort or kUnsignedInt.
+/// @param index_offset Byte offset of the first index in that buffer.
+DLLEXPORT [[nodiscard]] auto DrawElements(gl_types::GLDrawMode mode, int count,
+                                          gl_types::GLDataType type,
+                                          long long int index_offset)
+    -> types::Expected<void>;
+
+/// @brief Like DrawElements, but `base_vertex` is added to every index before
+/// the vertex is fetched, so meshes sharing one vertex buffer can keep
+/// zero-based indices.
+DLLEXPORT [[nodiscard]] auto DrawElementsBaseVertex(gl_types::GLDrawMode mode,
+                                                    int count,
+                                                    gl_types::GLDataType type,
+                                                    long long int index_offset,
+                                                    int base_vertex)
+    -> types::Expected<void>;
+
+/// @brief Instanced version of DrawElements.
+DLLEXPORT [[nodiscard]] auto DrawElementsInstanced(gl_types::GLDrawMode mode,
+                                                   int count,
+                                                   gl_types::GLDataType type,
+                                                   long long int index_offset,
+                                                   int instance_count)
+    -> types::Expected<void>;
+
 DLLEXPORT [[nodiscard]] auto EnableVertexAttribArray(unsigned int index)
     -> types::Expected<void>;
 
@@ -54,6 +124,10 @@ DLLEXPORT [[nodiscard]] auto GenBuffers(int n, unsigned int* buffers)
 DLLEXPORT [[nodiscard]] auto GenVertexArrays(int n, unsigned int* arrays)
     -> types::Expected<void>;
 
+/// @brief Get the policy deciding when glGetError is queried.
+/// @return The current error policy.
+DLLEXPORT [[nodiscard]] auto GetErrorPolicy() -> gl_types::GLErrorPolicy;
+
 DLLEXPORT [[nodiscard]] auto GetShaderInfoLog(unsigned int shader,
                                               int max_length, int* length,
                                               char* info_log)
@@ -63,9 +137,52 @@ DLLEXPORT [[nodiscard]] auto GetShaderiv(
     unsigned int shader, gl_types::GLShaderObjectParameter pname, int* params)
     -> types::Expected<void>;
 
+/// @brief Get the number of issued and skipped state-setting calls.
+/// @return The counts accumulated since the last ResetStateCacheStats.
+/// @note Program, vertex array, buffer and clear color changes are tracked.
+DLLEXPORT [[nodiscard]] auto GetStateCacheStats() -> StateCacheStats;
+
+/// @brief Forget all cached OpenGL state.
+/// @note Call this after code outside of the engine has changed bindings or
+/// the clear color, or deleted objects whose names may be reused. The next
+/// state-setting call of each kind always reaches OpenGL.
+DLLEXPORT auto InvalidateStateCache() -> void;
+
 DLLEXPORT [[nodiscard]] auto LinkProgram(unsigned int program)
     -> types::Expected<void>;
 
+/// @brief Issue `draw_count` DrawArrays calls described by the
+/// DrawArraysIndirectCommand records in the bound kDrawIndirect buffer.
+/// @param indirect_offset Byte offset of the first record in that buffer.
+/// @param stride Distance between records in bytes, 0 if tightly packed.
+/// @return void on success, kGLExtensionUnavailable if the context lacks
+/// GL_ARB_multi_draw_indirect, error on failure.
+DLLEXPORT [[nodiscard]] auto MultiDrawArraysIndirect(
+    gl_types::GLDrawMode mode, long long int indirect_offset, int draw_count,
+    int stride) -> types::Expected<void>;
+
+/// @brief Issue `draw_count` DrawElements calls described by the
+/// DrawElementsIndirectCommand records in the bound kDrawIndirect buffer.
+/// @param type The index type of the bound kElementArray buffer.
+/// @param indirect_offset Byte offset of the first record in that buffer.
+/// @param stride Distance between records in bytes, 0 if tightly packed.
+/// @return void on success, kGLExtensionUnavailable if the context lacks
+/// GL_ARB_multi_draw_indirect, error on failure.
+DLLEXPORT [[nodiscard]] auto MultiDrawElementsIndirect(
+    gl_types::GLDrawMode mode, gl_types::GLDataType type,
+    long long int indirect_offset, int draw_count, int stride)
+    -> types::Expected<void>;
+
+/// @brief Reset the counts returned by GetStateCacheStats, e.g. each frame.
+DLLEXPORT auto ResetStateCacheStats() -> void;
+
+/// @brief Set the policy deciding when glGetError is queried.
+/// @param policy The new error policy.
+/// @note The default policy is chosen at build time with the
+/// ENGINE_LIB_GL_ERROR_POLICY CMake option. Calls recorded under kCheckDeferred
+/// are forgotten.
+DLLEXPORT auto SetErrorPolicy(gl_types::GLErrorPolicy policy) -> void;
+
 DLLEXPORT [[nodiscard]] auto ShaderSource(unsigned int shader, int count,
                                           const char** string,
                                           const int* length)
@@ -74,6 +191,12 @@ DLLEXPORT [[nodiscard]] auto ShaderSource(unsigned int shader, int count,
 DLLEXPORT [[nodiscard]] auto UseProgram(unsigned int program)
     -> types::Expected<void>;
 
+/// @brief Set how often attribute `index` advances during instanced draws.
+/// @param divisor 0 to advance per vertex, N to advance every N instances.
+DLLEXPORT [[nodiscard]] auto VertexAttribDivisor(unsigned int index,
+                                                 unsigned int divisor)
+    -> types::Expected<void>;
+
 DLLEXPORT [[nodiscard]] auto VertexAttribPointer(unsigned int index, int size,
                                                  gl_types::GLDataType type,
                                                  unsigned char normalized,
@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_GOLDEN_RUNNER_H_
+#define ENGINE_LIB_GOLDEN_RUNNER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "dll-export.h"
+#include "i-fingerprint-index.h"
+#include "scene.h"
+#include "types.h"
+
+namespace graphics_engine::golden_runner {
+
+/// @brief One scene to render and the image it must match.
+struct GoldenCase {
+  /// Name of the case in reports; the reference's file name without its
+  /// extension unless the manifest gives one.
+  std::string name;
+  /// Key into the SceneRegistry.
+  std::string scene;
+  std::filesystem::path reference;
+  int width{640};
+  int height{480};
+  /// Largest difference allowed in any channel.
+  std::uint8_t tolerance{};
+};
+
+/// @brief Creates a scene by name. Called on the OpenGL context thread.
+using SceneFactory = std::function<types::Expected<scene::ScenePtr>()>;
+using SceneRegistry = std::map<std::string, SceneFactory, std::less<>>;
+
+/// @brief Options for RunGoldenSuite.
+struct GoldenRunOptions {
+  /// Threads comparing frames with their references; 0 uses one per core.
+  std::size_t worker_count{};
+  /// Where images of failing cases are written.
+  std::filesystem::path output_dir{std::filesystem::temp_directory_path() /
+                                   "golden"};
+  /// If set, a frame whose fingerprint exactly matches the entry keyed by its
+  /// reference's path (in generic form) passes without decoding the
+  /// reference. Other frames are compared pixel by pixel as usual.
+  const image_fingerprint::IFingerprintIndex* fingerprints{};
+};
+
+/// @brief The outcome of one GoldenCase.
+struct GoldenResult {
+  GoldenCase golden_case;
+  bool passed{};
+  /// Why the case failed; empty if it passed.
+  std::string failure;
+  std::size_t mismatch_count{};
+  /// The rendered frame and a heatmap of the differences, written for cases
+  /// that rendered but didn't match.
+  std::optional<std::filesystem::path> actual;
+  std::optional<std::filesystem::path> diff;
+  /// Time spent comparing the frame with its reference.
+  double seconds{};
+};
+
+/// @brief The outcome of a suite, in manifest order.
+struct GoldenReport {
+  std::vector<GoldenResult> results;
+  /// Wall time of the whole run.
+  double seconds{};
+
+  [[nodiscard]] auto GetFailureCount() const -> std::size_t;
+};
+
+/// @brief Read a manifest of golden cases.
+///
+/// One case per line: a scene name, a reference image and then, in any
+/// order, an optional size such as `800x600`, `tolerance=N` and `name=NAME`.
+/// Fields are separated by whitespace, so paths can't contain any. Relative
+/// reference paths are resolved against the manifest's directory. Empty lines
+/// and lines starting with `#` are skipped.
+/// @param manifest The manifest file.
+/// @return the cases on success, kFileIoError if the file can't be read, a
+/// line is malformed or two cases have the same name.
+DLLEXPORT [[nodiscard]] auto ParseGoldenManifest(
+    const std::filesystem::path& manifest)
+    -> types::Expected<std::vector<GoldenCase>>;
+
+/// @brief Render every case offscreen and compare it with its reference.
+///
+/// Scenes are created, rendered into an offscreen framebuffer and read back
+/// asynchronously on the calling thread, which must have the OpenGL context
+/// current. Decoding references and comparing, the bulk of the work, runs on
+/// a pool of worker threads while later cases render, so wall time shrinks
+/// with the number of cores for large suites. The bound framebuffer and
+/// viewport are restored afterwards.
+/// @param cases The cases to run.
+/// @param scenes Factories for the scenes the cases name.
+/// @param options Worker count and output directory.
+/// @return the report on success, even if cases failed; error if the
+/// offscreen target or readback can't be set up.
+DLLEXPORT [[nodiscard]] auto RunGoldenSuite(
+    const std::vector<GoldenCase>& cases, const SceneRegistry& scenes,
+    const GoldenRunOptions& options = {}) -> types::Expected<GoldenReport>;
+
+/// @brief Write a report in the JUnit XML format CI systems understand.
+/// @return void on success, kFileIoError if the file can't be written.
+DLLEXPORT [[nodiscard]] auto WriteJUnitReport(
+    const GoldenReport& report, const std::filesystem::path& file)
+    -> types::Expected<void>;
+
+/// @brief Write a report as JSON.
+/// @return void on success, kFileIoError if the file can't be written.
+DLLEXPORT [[nodiscard]] auto WriteJsonReport(const GoldenReport& report,
+                                             const std::filesystem::path& file)
+    -> types::Expected<void>;
+
+}  // namespace graphics_engine::golden_runner
+
+#endif  // ENGINE_LIB_GOLDEN_RUNNER_H_
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_ASYNC_CAPTURE_H_
+#define ENGINE_LIB_I_ASYNC_CAPTURE_H_
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "dll-export.h"
+#include "types.h"
+
+namespace graphics_engine::async_capture {
+
+/// @brief The pixels of a captured frame.
+struct CapturedFrame {
+  int width{};
+  int height{};
+  /// RGBA, 8 bits per channel, rows from bottom to top as OpenGL returns
+  /// them.
+  std::vector<std::byte> pixels;
+};
+
+using CaptureFuture = std::future<types::Expected<CapturedFrame>>;
+
+/// @brief Captures the viewport without waiting for the GPU.
+///
+/// Capture queues a read of the current framebuffer into one of a few
+/// kPixelPack buffers and fences it. Poll, called once per frame, copies out
+/// the reads the GPU has finished and completes their futures, usually a frame
+/// or two after the capture. With as many buffers as frames in flight,
+/// capturing every frame never stalls the render loop. All calls must be made
+/// on the OpenGL context thread, and the capturer must be destroyed while that
+/// context is current; the futures can be waited on from any thread.
+class IAsyncCapture {
+ public:
+  virtual ~IAsyncCapture() = default;
+
+  /// @brief Queue a read of the viewport of the bound read framebuffer.
+  /// @return a future completed by a later Poll or Flush, error on failure.
+  /// @note If every buffer is still in flight, this waits for the oldest one.
+  [[nodiscard]] virtual auto Capture() -> types::Expected<CaptureFuture> = 0;
+
+  /// @brief Complete the captures the GPU has finished, without waiting.
+  /// @return void on success, error on failure.
+  [[nodiscard]] virtual auto Poll() -> types::Expected<void> = 0;
+
+  /// @brief Wait for and complete every pending capture, including those
+  /// after one that failed.
+  /// @return void on success, the first error on failure.
+  [[nodiscard]] virtual auto Flush() -> types::Expected<void> = 0;
+
+  [[nodiscard]] virtual auto GetPendingCount() const -> std::size_t = 0;
+};
+
+using IAsyncCapturePtr = std::unique_ptr<IAsyncCapture>;
+
+/// @brief Create an asynchronous capturer.
+/// @param buffer_count Number of pixel buffers; 2 or 3 covers the frames a
+/// driver usually keeps in flight.
+/// @return the capturer on success, kGLErrorInvalidValue if `buffer_count` is
+/// 0, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateIAsyncCapture(std::size_t buffer_count = 3)
+    -> types::Expected<IAsyncCapturePtr>;
+
+}  // namespace graphics_engine::async_capture
+
+#endif  // ENGINE_LIB_I_ASYNC_CAPTURE_H_
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_CAPTURE_WRITER_H_
+#define ENGINE_LIB_I_CAPTURE_WRITER_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+#include "dll-export.h"
+#include "i-async-capture.h"
+#include "image.h"
+#include "types.h"
+
+namespace graphics_engine::capture_writer {
+
+/// @brief Options for CreateICaptureWriter.
+struct CaptureWriterOptions {
+  /// Number of threads encoding frames in parallel.
+  std::size_t worker_count{2};
+
+  /// Number of frames that may wait for a free worker. At most
+  /// `queue_capacity + worker_count` frames are held at any time.
+  std::size_t queue_capacity{4};
+};
+
+/// @brief Flips, encodes and writes captured frames on a pool of worker
+/// threads, keeping image encoding off the render thread.
+///
+/// The queue is bounded: Submit blocks while it is full, so a burst of
+/// captures slows the caller down instead of growing memory without limit.
+/// The writer may be used from any thread. Destroying it writes out every
+/// frame already submitted.
+class ICaptureWriter {
+ public:
+  virtual ~ICaptureWriter() = default;
+
+  /// @brief Queue a frame to be written to `file`.
+  /// @param frame A frame as produced by IAsyncCapture, rows bottom-up.
+  /// @param file Destination file; an existing file is overwritten.
+  /// @param options The format to write the frame in.
+  /// @return void once the frame is queued, kInvalidImage if the pixel count
+  /// doesn't match the frame's dimensions.
+  /// @note Blocks while the queue is full.
+  [[nodiscard]] virtual auto Submit(async_capture::CapturedFrame frame,
+                                    std::filesystem::path file,
+                                    const image::EncodeOptions& options = {})
+      -> types::Expected<void> = 0;
+
+  /// @brief Wait until every submitted frame has been written.
+  /// @return void if all of them were written since the last Flush,
+  /// the first error if any of them failed.
+  [[nodiscard]] virtual auto Flush() -> types::Expected<void> = 0;
+
+  /// @return the number of frames queued or being encoded.
+  [[nodiscard]] virtual auto GetPendingCount() const -> std::size_t = 0;
+};
+
+using ICaptureWriterPtr = std::unique_ptr<ICaptureWriter>;
+
+/// @brief Create a capture writer and start its workers.
+/// @param options Worker and queue sizes.
+/// @return the writer on success, kGLErrorInvalidValue if either size is 0.
+DLLEXPORT [[nodiscard]] auto CreateICaptureWriter(
+    const CaptureWriterOptions& options = {})
+    -> types::Expected<ICaptureWriterPtr>;
+
+}  // namespace graphics_engine::capture_writer
+
+#endif  // ENGINE_LIB_I_CAPTURE_WRITER_H_
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_COMMAND_BUFFER_H_
+#define ENGINE_LIB_I_COMMAND_BUFFER_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "dll-export.h"
+#include "gl-types.h"
+#include "i-gl-clear-flags.h"
+#include "types.h"
+
+namespace graphics_engine::command_buffer {
+
+/// @brief A list of gl_wrappers calls recorded now and executed later.
+///
+/// Recording does not touch OpenGL, so it may happen on any thread; only one
+/// thread may record into a given buffer at a time. Execute must be called on
+/// the thread that owns the OpenGL context. Storage is reserved when the
+/// buffer is created and recording never allocates: once the command or
+/// payload capacity is used up, the record functions return
+/// kCommandBufferFull and leave the buffer unchanged.
+class ICommandBuffer {
+ public:
+  virtual ~ICommandBuffer() = default;
+
+  [[nodiscard]] virtual auto BindBuffer(gl_types::GLBufferTarget target,
+                                        unsigned int buffer)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto BindVertexArray(unsigned int array)
+      -> types::Expected<void> = 0;
+
+  /// @note `size` bytes are copied from `data` into the buffer's payload
+  /// storage, so `data` need not outlive the call. A null `data` only
+  /// allocates the GL buffer, as with glBufferData.
+  [[nodiscard]] virtual auto BufferData(gl_types::GLBufferTarget target,
+                                        long long int size, const void* data,
+                                        gl_types::GLDataUsagePattern usage)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto Clear(const gl_clear_flags::IGLClearFlags& flags)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto DrawArrays(gl_types::GLDrawMode mode, int first,
+                                        int count) -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto EnableVertexAttribArray(unsigned int index)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto UseProgram(unsigned int program)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto VertexAttribPointer(unsigned int index, int size,
+                                                 gl_types::GLDataType type,
+                                                 unsigned char normalized,
+                                                 int stride,
+                                                 const void* pointer)
+      -> types::Expected<void> = 0;
+
+  /// @brief Issue the recorded calls, in order, through gl_wrappers.
+  /// @return void on success, the first error otherwise. Execution stops at
+  /// the first failing call.
+  [[nodiscard]] virtual auto Execute() const -> types::Expected<void> = 0;
+
+  /// @brief Drop all recorded commands, keeping the reserved storage.
+  virtual auto Reset() -> void = 0;
+
+  [[nodiscard]] virtual auto GetNumCommands() const -> std::size_t = 0;
+  [[nodiscard]] virtual auto GetPayloadSize() const -> std::size_t = 0;
+};
+
+using ICommandBufferPtr = std::unique_ptr<ICommandBuffer>;
+
+/// @brief Create a command buffer.
+/// @param max_commands The number of commands the buffer can hold.
+/// @param max_payload_bytes The number of bytes BufferData calls can copy.
+DLLEXPORT [[nodiscard]] auto CreateICommandBuffer(std::size_t max_commands,
+                                                  std::size_t max_payload_bytes)
+    -> ICommandBufferPtr;
+
+}  // namespace graphics_engine::command_buffer
+
+#endif  // ENGINE_LIB_I_COMMAND_BUFFER_H_
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_COMMAND_QUEUE_H_
+#define ENGINE_LIB_I_COMMAND_QUEUE_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "dll-export.h"
+#include "i-command-buffer.h"
+#include "types.h"
+
+namespace graphics_engine::command_queue {
+
+/// @brief Collects command buffers from any thread and executes them on the
+/// OpenGL context thread in the order they were submitted.
+class ICommandQueue {
+ public:
+  virtual ~ICommandQueue() = default;
+
+  /// @brief Queue a recorded buffer. Safe to call from any thread.
+  /// @param buffer The buffer to execute. It is not copied, so it must stay
+  /// alive and unmodified until ExecuteSubmitted has run.
+  /// @return void on success, kCommandQueueFull if the queue has no room.
+  [[nodiscard]] virtual auto Submit(
+      const command_buffer::ICommandBuffer& buffer)
+      -> types::Expected<void> = 0;
+
+  /// @brief Execute every queued buffer in submission order and empty the
+  /// queue. Must be called on the thread that owns the OpenGL context.
+  /// @return void on success, the first error otherwise. Buffers after the
+  /// failing one are discarded.
+  [[nodiscard]] virtual auto ExecuteSubmitted() -> types::Expected<void> = 0;
+
+  [[nodiscard]] virtual auto GetNumSubmitted() const -> std::size_t = 0;
+};
+
+using ICommandQueuePtr = std::unique_ptr<ICommandQueue>;
+
+/// @brief Create a command queue.
+/// @param max_buffers The number of buffers that can wait for execution.
+DLLEXPORT [[nodiscard]] auto CreateICommandQueue(std::size_t max_buffers)
+    -> ICommandQueuePtr;
+
+}  // namespace graphics_engine::command_queue
+
+#endif  // ENGINE_LIB_I_COMMAND_QUEUE_H_
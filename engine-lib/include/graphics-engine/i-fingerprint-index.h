@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_FINGERPRINT_INDEX_H_
+#define ENGINE_LIB_I_FINGERPRINT_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dll-export.h"
+#include "image-fingerprint.h"
+#include "types.h"
+
+namespace graphics_engine::image_fingerprint {
+
+/// @brief An entry found by IFingerprintIndex::FindSimilar.
+struct FingerprintMatch {
+  std::string key;
+  ImageFingerprint fingerprint;
+  /// HammingDistance between the perceptual hashes.
+  int distance{};
+};
+
+/// @brief Fingerprints of reference images by key, usually the reference's
+/// path.
+///
+/// Answers "is this frame exactly the reference?" with a hash lookup and
+/// "which references look like this frame?" with a scan over 8 byte hashes,
+/// neither of which needs the reference images themselves.
+///
+/// Saved as text, one entry per line, so it diffs well under version control:
+/// the 16 hex digit content hash, the 16 hex digit perceptual hash, width,
+/// height and the key, which runs to the end of the line. The first line is
+/// the header "# graphics-engine fingerprint index 1".
+///
+/// Not thread-safe for writes; concurrent reads are fine.
+class IFingerprintIndex {
+ public:
+  virtual ~IFingerprintIndex() = default;
+
+  /// @brief Add or replace the entry for `key`. Keys can't contain line
+  /// breaks; those are replaced by spaces.
+  virtual auto Insert(std::string_view key,
+                      const ImageFingerprint& fingerprint) -> void = 0;
+
+  /// @return true if an entry for `key` was removed.
+  virtual auto Erase(std::string_view key) -> bool = 0;
+
+  [[nodiscard]] virtual auto Find(std::string_view key) const
+      -> std::optional<ImageFingerprint> = 0;
+
+  /// @return true if `key` has an entry with exactly this content.
+  [[nodiscard]] virtual auto MatchesExactly(
+      std::string_view key, const ImageFingerprint& fingerprint) const
+      -> bool = 0;
+
+  /// @return the keys of every entry with this content hash.
+  [[nodiscard]] virtual auto FindByContent(std::uint64_t content_hash) const
+      -> std::vector<std::string> = 0;
+
+  /// @return the entries whose perceptual hash is at most `max_distance`
+  /// bits from `perceptual_hash`, nearest first.
+  [[nodiscard]] virtual auto FindSimilar(std::uint64_t perceptual_hash,
+                                         int max_distance) const
+      -> std::vector<FingerprintMatch> = 0;
+
+  [[nodiscard]] virtual auto GetSize() const -> std::size_t = 0;
+
+  /// @brief Write the index to `file`, replacing it only once the new
+  /// contents are complete.
+  /// @return void on success, kFileIoError on failure.
+  [[nodiscard]] virtual auto Save(const std::filesystem::path& file) const
+      -> types::Expected<void> = 0;
+};
+
+using IFingerprintIndexPtr = std::unique_ptr<IFingerprintIndex>;
+
+/// @brief Create an empty index.
+DLLEXPORT [[nodiscard]] auto CreateIFingerprintIndex() -> IFingerprintIndexPtr;
+
+/// @brief Load an index written by IFingerprintIndex::Save.
+/// @return the index on success, kFileIoError if the file can't be read or is
+/// malformed.
+DLLEXPORT [[nodiscard]] auto LoadIFingerprintIndex(
+    const std::filesystem::path& file) -> types::Expected<IFingerprintIndexPtr>;
+
+}  // namespace graphics_engine::image_fingerprint
+
+#endif  // ENGINE_LIB_I_FINGERPRINT_INDEX_H_
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_FRAME_RECORDER_H_
+#define ENGINE_LIB_I_FRAME_RECORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "dll-export.h"
+#include "types.h"
+
+namespace graphics_engine::frame_recorder {
+
+/// @brief Options for CreateIFrameRecorder.
+struct FrameRecorderOptions {
+  /// Number of frames that may wait in memory for the disk writer. Together
+  /// with the readback buffers this bounds the recorder's memory use.
+  std::size_t pool_size{8};
+
+  /// Number of kPixelPack buffers frames are read back into; 2 or 3 covers
+  /// the frames a driver usually keeps in flight.
+  std::size_t readback_buffers{3};
+};
+
+/// @brief Counters describing a recording.
+struct FrameRecorderStats {
+  /// Calls to CaptureFrame.
+  std::uint64_t frames_captured{};
+  /// Frames written to the file.
+  std::uint64_t frames_written{};
+  /// Frames skipped because every readback buffer was still in flight, every
+  /// pool buffer was waiting for the writer, or the viewport size changed.
+  std::uint64_t frames_dropped{};
+  std::uint64_t bytes_written{};
+};
+
+/// @brief Streams every rendered frame into a single file.
+///
+/// Each CaptureFrame queues an asynchronous read of the viewport. Finished
+/// reads are copied into a fixed pool of frame buffers and appended to the
+/// file, in order, by one writer thread. When the GPU or the disk can't keep
+/// up, frames are dropped and counted rather than stalling the render loop
+/// or growing memory; the frame numbers stored in the index show where the
+/// gaps are.
+///
+/// File layout, all integers little-endian:
+///  - A 32 byte header: the magic "GEFRAMES", then u32 version (1), width,
+///    height, channel count (4, RGBA8), flags (bit 0: rows are bottom-up) and
+///    a reserved u32.
+///  - The frames, width * height * 4 bytes each, back to back.
+///  - The index: per written frame a u64 frame number (the CaptureFrame call
+///    it came from, counting from 0), u64 file offset and i64 nanoseconds
+///    since the recorder was created.
+///  - A 24 byte footer: u64 index offset, u64 frame count and the magic
+///    "GEINDEX1".
+///
+/// All calls except GetStats must be made on the OpenGL context thread, and
+/// the recorder must be destroyed while that context is current.
+class IFrameRecorder {
+ public:
+  virtual ~IFrameRecorder() = default;
+
+  /// @brief Queue the current contents of the viewport for recording. Call
+  /// once per frame after rendering it.
+  /// @return void on success, even if the frame had to be dropped, error on
+  /// failure.
+  [[nodiscard]] virtual auto CaptureFrame() -> types::Expected<void> = 0;
+
+  /// @brief Hand reads the GPU has finished to the writer, without waiting.
+  /// CaptureFrame does this too.
+  /// @return void on success, error on failure.
+  [[nodiscard]] virtual auto Poll() -> types::Expected<void> = 0;
+
+  /// @brief Wait for every queued frame to be written, then write the index
+  /// and close the file. Later calls to CaptureFrame fail.
+  /// @return the final counters on success, kFileIoError if writing failed.
+  [[nodiscard]] virtual auto Finish()
+      -> types::Expected<FrameRecorderStats> = 0;
+
+  /// @return the counters so far. May be called from any thread.
+  [[nodiscard]] virtual auto GetStats() const -> FrameRecorderStats = 0;
+};
+
+using IFrameRecorderPtr = std::unique_ptr<IFrameRecorder>;
+
+/// @brief Start recording to `file` at the current viewport size.
+/// @param file The recording to create; an existing file is overwritten.
+/// @param options Buffer counts.
+/// @return the recorder on success, kGLErrorInvalidValue if a count is 0,
+/// kFileIoError if the file can't be created, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateIFrameRecorder(
+    const std::filesystem::path& file, const FrameRecorderOptions& options = {})
+    -> types::Expected<IFrameRecorderPtr>;
+
+/// @brief One frame of a recording.
+struct RecordedFrame {
+  std::uint64_t frame_number{};
+  /// Where the frame's pixels start in the file.
+  std::uint64_t offset{};
+  std::int64_t timestamp_ns{};
+};
+
+/// @brief The dimensions and index of a recording.
+struct RecordingIndex {
+  int width{};
+  int height{};
+  int channels{};
+  bool bottom_up{};
+  std::vector<RecordedFrame> frames;
+};
+
+/// @brief Read the header and index of a file written by IFrameRecorder.
+/// @param file The recording.
+/// @return the index on success, kFileIoError if the file can't be read or
+/// isn't a finished recording.
+DLLEXPORT [[nodiscard]] auto ReadRecordingIndex(
+    const std::filesystem::path& file) -> types::Expected<RecordingIndex>;
+
+}  // namespace graphics_engine::frame_recorder
+
+#endif  // ENGINE_LIB_I_FRAME_RECORDER_H_
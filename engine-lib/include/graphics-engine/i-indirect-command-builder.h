@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_INDIRECT_COMMAND_BUILDER_H_
+#define ENGINE_LIB_I_INDIRECT_COMMAND_BUILDER_H_
+
+#include <memory>
+#include <span>
+
+#include "dll-export.h"
+#include "gl-types.h"
+#include "types.h"
+
+namespace graphics_engine::indirect_command_builder {
+
+/// @brief One record of a MultiDrawArraysIndirect call, laid out as OpenGL
+/// expects it.
+struct DrawArraysIndirectCommand {
+  unsigned int count{};
+  unsigned int instance_count{1};
+  unsigned int first{};
+  unsigned int base_instance{};
+};
+
+/// @brief One record of a MultiDrawElementsIndirect call, laid out as OpenGL
+/// expects it.
+struct DrawElementsIndirectCommand {
+  unsigned int count{};
+  unsigned int instance_count{1};
+  unsigned int first_index{};
+  int base_vertex{};
+  unsigned int base_instance{};
+};
+
+/// @brief Packs the draws of many objects that share a vertex array and a
+/// program into one indirect buffer, so they cost one GL draw call per kind.
+///
+/// Adding commands only touches CPU memory. Draw uploads them to a
+/// kDrawIndirect buffer owned by the builder and must run on the OpenGL
+/// context thread with the shared program and vertex array bound. The builder
+/// must be destroyed while that context is current.
+class IIndirectCommandBuilder {
+ public:
+  virtual ~IIndirectCommandBuilder() = default;
+
+  virtual auto AddDrawArrays(const DrawArraysIndirectCommand& command)
+      -> void = 0;
+  virtual auto AddDrawElements(const DrawElementsIndirectCommand& command)
+      -> void = 0;
+
+  /// @brief Drop all commands, keeping the CPU and GPU storage for reuse.
+  virtual auto Clear() -> void = 0;
+
+  [[nodiscard]] virtual auto GetDrawArraysCommands() const
+      -> std::span<const DrawArraysIndirectCommand> = 0;
+  [[nodiscard]] virtual auto GetDrawElementsCommands() const
+      -> std::span<const DrawElementsIndirectCommand> = 0;
+
+  /// @brief Upload the commands and issue one MultiDrawArraysIndirect for the
+  /// DrawArrays commands and one MultiDrawElementsIndirect for the
+  /// DrawElements commands. Empty lists issue nothing.
+  /// @param mode The primitive type of every command.
+  /// @param index_type The type of the indices in the bound kElementArray
+  /// buffer; ignored when there are no DrawElements commands.
+  /// @return void on success, error on failure.
+  [[nodiscard]] virtual auto Draw(gl_types::GLDrawMode mode,
+                                  gl_types::GLDataType index_type)
+      -> types::Expected<void> = 0;
+};
+
+using IIndirectCommandBuilderPtr = std::unique_ptr<IIndirectCommandBuilder>;
+DLLEXPORT [[nodiscard]] auto CreateIIndirectCommandBuilder()
+    -> IIndirectCommandBuilderPtr;
+
+}  // namespace graphics_engine::indirect_command_builder
+
+#endif  // ENGINE_LIB_I_INDIRECT_COMMAND_BUILDER_H_
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_INSTANCE_BUFFER_H_
+#define ENGINE_LIB_I_INSTANCE_BUFFER_H_
+
+#include <array>
+#include <memory>
+#include <span>
+
+#include "dll-export.h"
+#include "gl-types.h"
+#include "types.h"
+
+namespace graphics_engine::instance_buffer {
+
+/// @brief The per-instance attributes streamed by an IInstanceBuffer.
+struct InstanceData {
+  /// Column-major 4x4 model matrix, as glm stores a `mat4`.
+  std::array<float, 16> transform{1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F,
+                                  0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F};
+  /// RGBA color.
+  std::array<float, 4> color{1.F, 1.F, 1.F, 1.F};
+};
+
+/// @brief Streams one InstanceData per copy of a mesh, so N copies are drawn
+/// with a single instanced draw call.
+///
+/// BindAttributes records the per-instance attributes in the bound vertex
+/// array: the transform takes four consecutive locations starting at
+/// `first_location` (one per column, `layout(location = N) in mat4`) and the
+/// color takes the location after them (`in vec4`). Every draw uploads the
+/// instances added since the last Clear to a kArray buffer owned by the
+/// instance buffer. All GL work must run on the OpenGL context thread, and
+/// the instance buffer must be destroyed while that context is current.
+class IInstanceBuffer {
+ public:
+  virtual ~IInstanceBuffer() = default;
+
+  virtual auto Add(const InstanceData& instance) -> void = 0;
+
+  /// @brief Drop all instances, keeping the CPU and GPU storage for reuse.
+  virtual auto Clear() -> void = 0;
+
+  [[nodiscard]] virtual auto GetInstances() const
+      -> std::span<const InstanceData> = 0;
+
+  /// @brief Point attributes `first_location` to `first_location + 4` of the
+  /// bound vertex array at this buffer, advancing once per instance.
+  /// @return void on success, error on failure.
+  [[nodiscard]] virtual auto BindAttributes(unsigned int first_location)
+      -> types::Expected<void> = 0;
+
+  /// @brief Draw the vertices [first, first + count) once per instance.
+  [[nodiscard]] virtual auto DrawArrays(gl_types::GLDrawMode mode, int first,
+                                        int count)
+      -> types::Expected<void> = 0;
+
+  /// @brief Draw `count` indices of the bound kElementArray buffer once per
+  /// instance.
+  [[nodiscard]] virtual auto DrawElements(gl_types::GLDrawMode mode, int count,
+                                          gl_types::GLDataType type,
+                                          long long int index_offset)
+      -> types::Expected<void> = 0;
+};
+
+using IInstanceBufferPtr = std::unique_ptr<IInstanceBuffer>;
+DLLEXPORT [[nodiscard]] auto CreateIInstanceBuffer() -> IInstanceBufferPtr;
+
+}  // namespace graphics_engine::instance_buffer
+
+#endif  // ENGINE_LIB_I_INSTANCE_BUFFER_H_
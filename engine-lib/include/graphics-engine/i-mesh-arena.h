@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_MESH_ARENA_H_
+#define ENGINE_LIB_I_MESH_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "dll-export.h"
+#include "gl-types.h"
+#include "types.h"
+
+namespace graphics_engine::mesh_arena {
+
+using MeshHandle = std::uint32_t;
+
+/// @brief Where a mesh lives in the arena's shared buffers.
+///
+/// The fields map directly onto DrawElementsBaseVertex and onto a
+/// DrawElementsIndirectCommand, so many arena meshes can also be drawn with
+/// one MultiDrawElementsIndirect call.
+struct MeshRange {
+  int base_vertex{};           ///< First vertex in the vertex buffer.
+  int vertex_count{};          ///< Number of vertices.
+  unsigned int first_index{};  ///< First index in the index buffer.
+  int index_count{};           ///< Number of kUnsignedInt indices.
+};
+
+/// @brief Occupancy of an arena's buffers.
+struct MeshArenaStats {
+  std::size_t mesh_count{};
+  long long int used_vertices{};
+  long long int used_indices{};
+  /// Gaps left by removed meshes plus the free tail. More than one means
+  /// Compact can merge free space.
+  std::size_t free_vertex_blocks{};
+  std::size_t free_index_blocks{};
+};
+
+/// @brief Sub-allocates the vertices and indices of many meshes from one
+/// vertex buffer and one index buffer that share a single vertex array.
+///
+/// Indices stay relative to their own mesh and are offset with base-vertex
+/// draws, so switching meshes needs no vertex array or buffer binding.
+/// Removed meshes leave gaps that later meshes reuse first-fit; Compact packs
+/// the live meshes to the front of the buffers. All calls must be made on the
+/// OpenGL context thread, and the arena must be destroyed while that context
+/// is current.
+class IMeshArena {
+ public:
+  virtual ~IMeshArena() = default;
+
+  /// @brief Copy a mesh into the arena.
+  /// @param vertices Interleaved vertex data, a whole number of vertices of
+  /// the arena's stride.
+  /// @param indices Triangle list indices starting at 0 for the first vertex.
+  /// @return the handle on success, kMeshArenaFull if no gap is large enough
+  /// (Compact may make room), kGLErrorInvalidValue if the data is malformed,
+  /// error on failure.
+  [[nodiscard]] virtual auto Add(std::span<const std::byte> vertices,
+                                 std::span<const std::uint32_t> indices)
+      -> types::Expected<MeshHandle> = 0;
+
+  /// @brief Release a mesh's ranges for reuse.
+  /// @return void on success, kGLErrorInvalidValue for an unknown handle.
+  [[nodiscard]] virtual auto Remove(MeshHandle mesh)
+      -> types::Expected<void> = 0;
+
+  /// @return the mesh's range on success, kGLErrorInvalidValue for an unknown
+  /// handle. Ranges change when the arena is compacted.
+  [[nodiscard]] virtual auto GetRange(MeshHandle mesh) const
+      -> types::Expected<MeshRange> = 0;
+
+  /// @brief Bind the arena's vertex array, and its vertex buffer to kArray,
+  /// e.g. to describe the vertex layout with VertexAttribPointer once.
+  [[nodiscard]] virtual auto Bind() -> types::Expected<void> = 0;
+
+  /// @brief Bind the arena's vertex array and draw one mesh.
+  [[nodiscard]] virtual auto Draw(MeshHandle mesh, gl_types::GLDrawMode mode)
+      -> types::Expected<void> = 0;
+
+  /// @brief Move every live mesh to the front of the buffers so the free
+  /// space becomes one block. Handles stay valid.
+  /// @return void on success, error on failure.
+  [[nodiscard]] virtual auto Compact() -> types::Expected<void> = 0;
+
+  [[nodiscard]] virtual auto GetStats() const -> MeshArenaStats = 0;
+  [[nodiscard]] virtual auto GetVertexArrayId() const -> unsigned int = 0;
+};
+
+using IMeshArenaPtr = std::unique_ptr<IMeshArena>;
+
+/// @brief Create the shared buffers of a mesh arena.
+/// @param vertex_stride Size of one vertex in bytes.
+/// @param vertex_capacity Number of vertices the arena can hold.
+/// @param index_capacity Number of indices the arena can hold.
+/// @return the arena on success, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateIMeshArena(int vertex_stride,
+                                              long long int vertex_capacity,
+                                              long long int index_capacity)
+    -> types::Expected<IMeshArenaPtr>;
+
+}  // namespace graphics_engine::mesh_arena
+
+#endif  // ENGINE_LIB_I_MESH_ARENA_H_
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_RING_BUFFER_H_
+#define ENGINE_LIB_I_RING_BUFFER_H_
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+#include "dll-export.h"
+#include "types.h"
+
+namespace graphics_engine::ring_buffer {
+
+/// @brief A sub-range of a ring buffer handed out for the current frame.
+struct RingBufferAllocation {
+  /// Mapped memory to write the data into. Writes are visible to OpenGL
+  /// without any flush or upload call.
+  std::span<std::byte> data;
+
+  /// Byte offset of `data` in the GL buffer, e.g. for VertexAttribPointer or
+  /// the `first` argument of a draw.
+  long long int offset{};
+};
+
+/// @brief A GL buffer that stays mapped for its whole lifetime, used to
+/// stream per-frame data (dynamic vertices, indices, uniforms) without
+/// re-specifying the buffer.
+///
+/// Allocations are carved out of the buffer in order and wrap around at the
+/// end. EndFrame places a fence after the frame's commands; a later
+/// allocation that would overwrite that frame's data first waits for the
+/// fence, so the CPU never writes memory the GPU may still read.
+class IRingBuffer {
+ public:
+  virtual ~IRingBuffer() = default;
+
+  /// @brief Reserve `size` bytes for the current frame.
+  /// @param alignment Required alignment of the offset, a power of two.
+  /// @return the allocation on success, kRingBufferFull if `size` or the
+  /// current frame alone would need more than the whole buffer,
+  /// kGLErrorInvalidValue if `size` isn't positive or `alignment` isn't a
+  /// power of two, error on failure.
+  [[nodiscard]] virtual auto Allocate(long long int size,
+                                      long long int alignment)
+      -> types::Expected<RingBufferAllocation> = 0;
+
+  /// @brief Fence everything allocated since the previous EndFrame. Call it
+  /// after the draws that read the frame's allocations have been issued.
+  [[nodiscard]] virtual auto EndFrame() -> types::Expected<void> = 0;
+
+  [[nodiscard]] virtual auto GetBufferId() const -> unsigned int = 0;
+  [[nodiscard]] virtual auto GetCapacity() const -> long long int = 0;
+};
+
+using IRingBufferPtr = std::unique_ptr<IRingBuffer>;
+
+/// @brief Create a persistently and coherently mapped ring buffer.
+/// @param capacity The size of the buffer in bytes. A few frames' worth of
+/// data avoids waiting on fences.
+/// @return the ring buffer on success, kGLExtensionUnavailable if the context
+/// lacks GL_ARB_buffer_storage, error on failure.
+/// @note Must be called, used and destroyed on the OpenGL context thread. The
+/// buffer can be bound to any GLBufferTarget afterwards.
+DLLEXPORT [[nodiscard]] auto CreateIRingBuffer(long long int capacity)
+    -> types::Expected<IRingBufferPtr>;
+
+}  // namespace graphics_engine::ring_buffer
+
+#endif  // ENGINE_LIB_I_RING_BUFFER_H_
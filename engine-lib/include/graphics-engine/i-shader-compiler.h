@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_SHADER_COMPILER_H_
+#define ENGINE_LIB_I_SHADER_COMPILER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "dll-export.h"
+#include "i-shader.h"
+#include "types.h"
+
+namespace graphics_engine::shader_compiler {
+
+using ShaderCompileHandle = std::uint32_t;
+
+/// @brief How an IShaderCompiler overlaps compilation with the caller.
+enum class ShaderCompileMode : std::uint8_t {
+  /// The driver compiles on its own threads (KHR_parallel_shader_compile)
+  /// and Poll asks it without blocking.
+  kParallelExtension,
+  /// A worker thread with its own shared context compiles and links.
+  kWorkerContext,
+  /// Compiles are issued on the calling thread and their status isn't
+  /// queried until Wait, so drivers that compile lazily or on internal
+  /// threads aren't serialized. Poll can't tell whether Wait will block.
+  kDeferredStatus,
+};
+
+/// @brief Options for CreateIShaderCompiler.
+struct ShaderCompilerOptions {
+  /// Use KHR_parallel_shader_compile when the driver has it.
+  bool prefer_parallel_extension{true};
+
+  /// Maximum compiler threads the driver may use with the extension; 0 lets
+  /// the driver decide.
+  unsigned int max_driver_threads{};
+
+  /// Called once on the worker thread to make current a context that shares
+  /// objects with the caller's, e.g. glfwMakeContextCurrent on a hidden
+  /// window created with the main window as `share`. Returns false if it
+  /// can't. Used only without the extension; if it's empty or fails,
+  /// compilation falls back to kDeferredStatus.
+  std::function<bool()> make_worker_context_current{};
+
+  /// Called on the worker thread before it exits, e.g. to release the
+  /// context.
+  std::function<void()> release_worker_context{};
+};
+
+/// @brief Compiles many shader programs at once without blocking the caller.
+///
+/// Submit issues every compile and the link without asking for their
+/// status, which would force the driver to finish them one at a time. The
+/// program is picked up later with Poll and Wait, so a loading screen can
+/// submit hundreds of programs and collect them as they complete.
+///
+/// All calls must be made on the thread whose OpenGL context the programs
+/// are for, and the compiler must be destroyed while that context is
+/// current.
+class IShaderCompiler {
+ public:
+  virtual ~IShaderCompiler() = default;
+
+  /// @brief Start compiling and linking `sources`. Returns immediately; a
+  /// program in the binary cache is restored right away.
+  /// @param options The binary cache to use, as for CreateIShader.
+  /// @return the handle to Poll and Wait on.
+  [[nodiscard]] virtual auto Submit(const types::ShaderSourceMap& sources,
+                                    const shader::ShaderOptions& options = {})
+      -> ShaderCompileHandle = 0;
+
+  /// @return true if Wait on `program` won't block, including when it
+  /// failed or the handle is unknown.
+  [[nodiscard]] virtual auto Poll(ShaderCompileHandle program) -> bool = 0;
+
+  /// @brief Block until `program` is done and take it. The handle is
+  /// released.
+  /// @return the shader on success, kShaderError if a stage failed to
+  /// compile or the program failed to link (the logs are printed),
+  /// kGLErrorInvalidValue for an unknown handle.
+  [[nodiscard]] virtual auto Wait(ShaderCompileHandle program)
+      -> types::Expected<shader::IShaderPtr> = 0;
+
+  /// @return the number of submitted programs not yet taken with Wait.
+  [[nodiscard]] virtual auto GetPendingCount() const -> std::size_t = 0;
+
+  [[nodiscard]] virtual auto GetMode() const -> ShaderCompileMode = 0;
+};
+
+using IShaderCompilerPtr = std::unique_ptr<IShaderCompiler>;
+
+/// @brief Create a shader compiler, picking the best mode the driver and
+/// `options` allow.
+/// @return the compiler on success, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateIShaderCompiler(
+    ShaderCompilerOptions options = {})
+    -> types::Expected<IShaderCompilerPtr>;
+
+}  // namespace graphics_engine::shader_compiler
+
+#endif  // ENGINE_LIB_I_SHADER_COMPILER_H_
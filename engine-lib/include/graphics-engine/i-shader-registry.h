@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_SHADER_REGISTRY_H_
+#define ENGINE_LIB_I_SHADER_REGISTRY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "dll-export.h"
+#include "i-shader.h"
+#include "types.h"
+
+namespace graphics_engine::shader_registry {
+
+/// @brief A program shared by every user that asked for the same sources,
+/// so uniforms set through one copy are seen by all of them. The program is
+/// deleted when the last copy goes away, which must happen on the thread
+/// whose OpenGL context it belongs to.
+using SharedShader = std::shared_ptr<shader::IShader>;
+
+struct ShaderRegistryStats {
+  /// Programs with at least one user.
+  std::size_t live_programs;
+  /// Acquire calls answered with a program that was already live.
+  std::size_t hits;
+  /// Acquire calls that compiled, or restored from the binary cache, a new
+  /// program.
+  std::size_t misses;
+};
+
+/// @brief Hands out one program per distinct set of shader sources.
+///
+/// Sources are keyed by a hash of their normalized text: stages in shader
+/// type order, line endings converted to '\n' and trailing whitespace
+/// removed from every line, so sources that differ only in formatting share
+/// a program. Because equal sources get the same program id, sorting draws
+/// by GetProgramId also groups them into as few program switches as
+/// possible.
+///
+/// All calls must be made on the thread whose OpenGL context the programs
+/// are for. Programs may outlive the registry.
+class IShaderRegistry {
+ public:
+  virtual ~IShaderRegistry() = default;
+
+  /// @brief Get the program for `sources`, compiling it if no live program
+  /// has the same normalized sources.
+  /// @param options Used only when the program has to be created.
+  /// @return the shared program on success, error on failure.
+  [[nodiscard]] virtual auto Acquire(const types::ShaderSourceMap& sources,
+                                     const shader::ShaderOptions& options = {})
+      -> types::Expected<SharedShader> = 0;
+
+  /// @return the key `sources` are registered under.
+  [[nodiscard]] virtual auto GetKey(const types::ShaderSourceMap& sources) const
+      -> std::uint64_t = 0;
+
+  [[nodiscard]] virtual auto GetStats() const -> ShaderRegistryStats = 0;
+};
+
+using IShaderRegistryPtr = std::unique_ptr<IShaderRegistry>;
+
+/// @brief Create an empty shader registry.
+/// @return the registry on success, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateIShaderRegistry()
+    -> types::Expected<IShaderRegistryPtr>;
+
+}  // namespace graphics_engine::shader_registry
+
+#endif  // ENGINE_LIB_I_SHADER_REGISTRY_H_
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_SHADER_RELOADER_H_
+#define ENGINE_LIB_I_SHADER_RELOADER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+
+#include "dll-export.h"
+#include "gl-types.h"
+#include "i-shader-compiler.h"
+#include "i-shader.h"
+#include "types.h"
+
+namespace graphics_engine::shader_reloader {
+
+using ShaderFileMap =
+    std::unordered_map<gl_types::GLShaderType, std::filesystem::path>;
+
+/// @brief A shader whose program is replaced when its files change. It is
+/// deleted when the last copy goes away, which must happen on the thread
+/// whose OpenGL context it belongs to.
+using ReloadableShader = std::shared_ptr<shader::IShader>;
+
+/// @brief Options for CreateIShaderReloader.
+struct ShaderReloaderOptions {
+  /// How changed shaders are compiled. Without KHR_parallel_shader_compile,
+  /// a worker context keeps the compile off the render thread entirely;
+  /// otherwise the compile is issued there and collected a frame later.
+  shader_compiler::ShaderCompilerOptions compiler{};
+};
+
+struct ShaderReloaderStats {
+  /// Shaders loaded and still in use.
+  std::size_t watched_shaders;
+  /// Recompiles submitted and not yet collected.
+  std::size_t pending_compiles;
+  /// Programs swapped in after their files changed.
+  std::uint64_t reloads;
+  /// Changes that failed to read, compile or link; the previous program was
+  /// kept.
+  std::uint64_t failures;
+};
+
+/// @brief Loads shaders from files and reloads them when the files change.
+///
+/// The files are watched (with inotify on Linux). When one changes, every
+/// shader using it is recompiled and linked in the background by an
+/// IShaderCompiler. Update, called once per frame between frames, swaps a
+/// new program into its shader only if it linked, so rendering keeps using
+/// the previous program while the compile is in flight or after it failed.
+/// Failures are printed with the compile and link logs.
+///
+/// A reload resets the shader's uniforms and may move their locations, so
+/// look locations up again after an Update that returned a nonzero count.
+///
+/// All calls must be made on the thread whose OpenGL context the programs
+/// are for.
+class IShaderReloader {
+ public:
+  virtual ~IShaderReloader() = default;
+
+  /// @brief Read, compile and link `files` now and start watching them.
+  /// @param options Also used for every reload.
+  /// @return the shader on success, kFileIoError if a file can't be read or
+  /// watched, kShaderError if it fails to compile or link.
+  [[nodiscard]] virtual auto Load(const ShaderFileMap& files,
+                                  const shader::ShaderOptions& options = {})
+      -> types::Expected<ReloadableShader> = 0;
+
+  /// @brief Swap in the programs whose recompile finished and linked, then
+  /// start recompiling shaders whose files changed since the last call.
+  /// @return the number of shaders whose program was swapped.
+  virtual auto Update() -> std::size_t = 0;
+
+  [[nodiscard]] virtual auto GetStats() const -> ShaderReloaderStats = 0;
+};
+
+using IShaderReloaderPtr = std::unique_ptr<IShaderReloader>;
+
+/// @brief Create a shader reloader.
+/// @return the reloader on success, kFileIoError if the files can't be
+/// watched, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateIShaderReloader(
+    ShaderReloaderOptions options = {})
+    -> types::Expected<IShaderReloaderPtr>;
+
+}  // namespace graphics_engine::shader_reloader
+
+#endif  // ENGINE_LIB_I_SHADER_RELOADER_H_
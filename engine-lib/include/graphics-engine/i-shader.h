@@ -5,23 +5,136 @@
 #ifndef ENGINE_LIB_I_SHADER_H_
 #define ENGINE_LIB_I_SHADER_H_
 
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <span>
+#include <string_view>
 
 #include "dll-export.h"
+#include "glm/mat3x3.hpp"
+#include "glm/mat4x4.hpp"
+#include "glm/vec2.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
 #include "types.h"
 
 namespace graphics_engine::shader {
 
+/// @brief Options for CreateIShader.
+struct ShaderOptions {
+  /// Directory linked program binaries are cached in, created on first use.
+  /// A program found there is restored with glProgramBinary instead of being
+  /// compiled and linked. Entries are keyed by the sources and the driver's
+  /// vendor, renderer and version, so edited shaders and driver updates get
+  /// new entries; corrupt or rejected entries fall back to compiling. Empty
+  /// disables the cache, as does a driver without GL_ARB_get_program_binary.
+  std::filesystem::path binary_cache_directory{};
+};
+
+/// @brief The value types an active uniform can be set with.
+enum class UniformType : std::uint8_t {
+  kFloat,
+  kVec2,
+  kVec3,
+  kVec4,
+  kMat3,
+  kMat4,
+  /// int and bool uniforms.
+  kInt,
+  /// Sampler uniforms, set to a texture unit with the int setter.
+  kSampler,
+  /// Reflected, but there is no typed setter for it.
+  kUnsupported,
+};
+
+/// @brief An active uniform of a linked program.
+struct UniformInfo {
+  /// HashUniformName of the name, without the "[0]" of arrays.
+  std::uint32_t name_hash;
+  int location;
+  UniformType type;
+  /// The number of elements if the uniform is an array, otherwise 1.
+  int array_size;
+};
+
+/// @brief Counts of the uniform setter calls on one shader.
+struct UniformStats {
+  std::uint64_t issued{};   ///< Calls that changed a value and reached OpenGL.
+  std::uint64_t skipped{};  ///< Calls skipped because the value was unchanged.
+};
+
+/// @brief Hash a uniform name for IShader::GetUniformLocation.
+/// @note constexpr, so names can be hashed once at compile time.
+[[nodiscard]] constexpr auto HashUniformName(std::string_view name)
+    -> std::uint32_t {
+  // 32-bit FNV-1a.
+  std::uint32_t hash = 0x811C9DC5U;
+  for (const char c : name) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 0x01000193U;
+  }
+  return hash;
+}
+
+/// @brief A linked program and its active uniforms.
+///
+/// The active uniforms are reflected once when the program is linked or
+/// restored. The setters take a location from GetUniformLocation and skip
+/// the OpenGL call when the uniform already holds the value, so they can be
+/// called for every draw. They set the program's uniforms directly when the
+/// context has GL_ARB_separate_shader_objects; otherwise they make the
+/// program current first.
 class IShader {
  public:
   virtual ~IShader() = default;
 
   [[nodiscard]] virtual auto GetProgramId() const -> unsigned int = 0;
+
+  /// @return true if the program was restored from the binary cache rather
+  /// than compiled.
+  [[nodiscard]] virtual auto IsFromBinaryCache() const -> bool = 0;
+
+  /// @return the active uniforms outside of uniform blocks, sorted by name
+  /// hash.
+  [[nodiscard]] virtual auto GetUniforms() const
+      -> std::span<const UniformInfo> = 0;
+
+  /// @param name_hash HashUniformName of the uniform's name.
+  /// @return the uniform's location, -1 if the program has no such active
+  /// uniform. The setters ignore -1, as glUniform does.
+  [[nodiscard]] virtual auto GetUniformLocation(std::uint32_t name_hash) const
+      -> int = 0;
+
+  /// @brief Set the uniform at `location`, or the first element if it is an
+  /// array.
+  /// @return void on success, kGLErrorInvalidOperation if `location` isn't
+  /// an active uniform of the program or its type doesn't match the value.
+  [[nodiscard]] virtual auto SetUniform(int location, float value)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto SetUniform(int location, const glm::vec2& value)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto SetUniform(int location, const glm::vec3& value)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto SetUniform(int location, const glm::vec4& value)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto SetUniform(int location, const glm::mat3& value)
+      -> types::Expected<void> = 0;
+  [[nodiscard]] virtual auto SetUniform(int location, const glm::mat4& value)
+      -> types::Expected<void> = 0;
+  /// @note Also sets bool and sampler uniforms; a sampler takes the index
+  /// of a texture unit.
+  [[nodiscard]] virtual auto SetUniform(int location, int value)
+      -> types::Expected<void> = 0;
+
+  /// @return the setter calls issued and skipped since the program was
+  /// created.
+  [[nodiscard]] virtual auto GetUniformStats() const -> UniformStats = 0;
 };
 
 using IShaderPtr = std::unique_ptr<IShader>;
 DLLEXPORT [[nodiscard]] auto CreateIShader(
-    const types::ShaderSourceMap& sources) -> IShaderPtr;
+    const types::ShaderSourceMap& sources, const ShaderOptions& options = {})
+    -> IShaderPtr;
 
 }  // namespace graphics_engine::shader
 
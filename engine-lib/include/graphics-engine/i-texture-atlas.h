@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_TEXTURE_ATLAS_H_
+#define ENGINE_LIB_I_TEXTURE_ATLAS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "dll-export.h"
+#include "image.h"
+#include "types.h"
+
+namespace graphics_engine::texture_atlas {
+
+using AtlasHandle = std::uint32_t;
+
+/// @brief Options for CreateITextureAtlas.
+struct TextureAtlasOptions {
+  /// Width and height of each page in pixels.
+  int page_size{2048};
+
+  /// Pages the atlas may create before Add fails with kTextureAtlasFull.
+  int max_pages{4};
+
+  /// Pixels of border around each image, filled by repeating its edge
+  /// pixels, so linear filtering near an edge doesn't pull in a neighbour.
+  int padding{2};
+
+  /// Mipmap levels per page, including level 0. Each image's padded block is
+  /// aligned to 2^(mip_levels - 1) pixels so no texel of any level mixes two
+  /// images; padding of 2^(mip_levels - 2) also keeps linear filtering on
+  /// the smallest level inside the border.
+  int mip_levels{3};
+};
+
+/// @brief Where an image ended up in the atlas.
+struct AtlasRegion {
+  /// Index of the page, see ITextureAtlas::GetTextureId.
+  int page{};
+
+  /// The image's pixels on the page, excluding padding.
+  int x{};
+  int y{};
+  int width{};
+  int height{};
+
+  /// Texture coordinates of the image's corners. (u0, v0) is the first
+  /// pixel of the image's first row; row 0 of the page is at v = 0, so like
+  /// ITextureLoader's textures images are upside down in OpenGL's bottom-up
+  /// convention.
+  float u0{};
+  float v0{};
+  float u1{};
+  float v1{};
+};
+
+/// @brief Occupancy of an atlas.
+struct TextureAtlasStats {
+  std::size_t image_count{};
+  int page_count{};
+  /// Pixels covered by padded image blocks, over all pages.
+  long long int used_pixels{};
+  /// Pages with pixels not yet uploaded.
+  int dirty_pages{};
+};
+
+/// @brief Packs many small images into a few large textures, so a scene can
+/// draw them all with a handful of texture binds.
+///
+/// Add places an image with a skyline bin-packer and copies it into a CPU
+/// copy of its page; earlier images never move, so images can be added at
+/// any time without repacking. Upload sends each changed page to OpenGL in a
+/// single glTexSubImage2D covering everything added since the last upload,
+/// then regenerates its mipmaps. All calls must be made on the OpenGL context
+/// thread, and the atlas must be destroyed while that context is current.
+class ITextureAtlas {
+ public:
+  virtual ~ITextureAtlas() = default;
+
+  /// @brief Pack `image` and copy it into its page. The page's texture isn't
+  /// updated until the next Upload.
+  /// @param image The pixels; any channel count is expanded to RGBA.
+  /// @return the handle on success, kGLErrorInvalidValue if `image` is
+  /// malformed or too large for a page with its padding, kTextureAtlasFull
+  /// if no page has room and max_pages are in use.
+  [[nodiscard]] virtual auto Add(const image::ImageView& image)
+      -> types::Expected<AtlasHandle> = 0;
+
+  /// @return the image's region on success, kGLErrorInvalidValue for an
+  /// unknown handle.
+  [[nodiscard]] virtual auto GetRegion(AtlasHandle image) const
+      -> types::Expected<AtlasRegion> = 0;
+
+  /// @brief Upload the changed part of every page that was added to, one
+  /// texture update per page, and regenerate their mipmaps.
+  /// @return void on success, error on failure.
+  [[nodiscard]] virtual auto Upload() -> types::Expected<void> = 0;
+
+  /// @return the RGBA8 texture of `page`, or 0 if the page doesn't exist or
+  /// hasn't been uploaded yet.
+  [[nodiscard]] virtual auto GetTextureId(int page) const -> unsigned int = 0;
+
+  [[nodiscard]] virtual auto GetStats() const -> TextureAtlasStats = 0;
+};
+
+using ITextureAtlasPtr = std::unique_ptr<ITextureAtlas>;
+
+/// @brief Create an empty texture atlas. Pages are created as images need
+/// them.
+/// @param options Page size and count, padding and mipmap levels.
+/// @return the atlas on success, kGLErrorInvalidValue if an option is out of
+/// range, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateITextureAtlas(
+    const TextureAtlasOptions& options = {})
+    -> types::Expected<ITextureAtlasPtr>;
+
+}  // namespace graphics_engine::texture_atlas
+
+#endif  // ENGINE_LIB_I_TEXTURE_ATLAS_H_
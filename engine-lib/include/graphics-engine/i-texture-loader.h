@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_I_TEXTURE_LOADER_H_
+#define ENGINE_LIB_I_TEXTURE_LOADER_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <future>
+#include <memory>
+
+#include "dll-export.h"
+#include "types.h"
+
+namespace graphics_engine::texture_loader {
+
+/// @brief Options for CreateITextureLoader.
+struct TextureLoaderOptions {
+  /// Number of threads decoding image files.
+  std::size_t worker_count{2};
+
+  /// Number of decoded images that may wait for upload. Workers pause when
+  /// it is reached, bounding memory while many files are queued.
+  std::size_t decoded_capacity{8};
+
+  /// Number of kPixelUnpack buffers uploads are staged in. A buffer is
+  /// reused only once the GPU has finished reading it.
+  std::size_t staging_buffers{3};
+
+  /// Bytes of pixels Poll hands to the driver per call. At least one texture
+  /// is uploaded per call even if it is larger.
+  std::size_t upload_budget_bytes{std::size_t{16} << 20U};
+
+  /// Allocate a full mipmap chain and fill it with glGenerateMipmap.
+  bool generate_mipmaps{true};
+};
+
+/// @brief A loaded 2D texture. The caller owns it and frees it with
+/// DeleteTexture.
+struct Texture {
+  /// OpenGL texture name, RGBA8 with immutable storage where
+  /// GL_ARB_texture_storage is available.
+  unsigned int id{};
+  int width{};
+  int height{};
+  /// Number of mipmap levels allocated.
+  int levels{};
+};
+
+using TextureFuture = std::future<types::Expected<Texture>>;
+
+/// @brief Loads image files into textures without blocking the render loop.
+///
+/// Files are read and decoded to RGBA8 with stb_image on worker threads.
+/// Each Poll on the render thread copies a bounded number of decoded images
+/// into pixel unpack buffers and issues the texture uploads from them, so the
+/// driver can transfer the pixels asynchronously. A texture's future is ready
+/// as soon as its upload is issued; it can be used by later commands on the
+/// same context right away.
+///
+/// The first row of an image file is stored as row 0 of the texture, so
+/// files appear upside down with OpenGL's bottom-up texture coordinates.
+///
+/// Load and GetPendingCount may be called from any thread; Poll, Flush and
+/// the destructor need the OpenGL context current.
+class ITextureLoader {
+ public:
+  virtual ~ITextureLoader() = default;
+
+  /// @brief Queue `file` for decoding.
+  /// @return a future for the texture. It holds kStbErrorLoad if the file
+  /// can't be read or decoded, or the OpenGL error that failed the upload.
+  [[nodiscard]] virtual auto Load(std::filesystem::path file)
+      -> TextureFuture = 0;
+
+  /// @brief Upload decoded images within the per-call budget, without
+  /// waiting for decoders or the GPU. Call once per frame.
+  /// @return void on success, error if an upload failed.
+  [[nodiscard]] virtual auto Poll() -> types::Expected<void> = 0;
+
+  /// @brief Wait until every queued file has been decoded and uploaded.
+  /// @return void on success, the first upload error otherwise.
+  [[nodiscard]] virtual auto Flush() -> types::Expected<void> = 0;
+
+  /// @return the number of textures whose future isn't ready yet.
+  [[nodiscard]] virtual auto GetPendingCount() const -> std::size_t = 0;
+};
+
+using ITextureLoaderPtr = std::unique_ptr<ITextureLoader>;
+
+/// @brief Create a texture loader and start its workers.
+/// @param options Thread, buffer and budget sizes.
+/// @return the loader on success, kGLErrorInvalidValue if a count or the
+/// budget is 0, error on failure.
+DLLEXPORT [[nodiscard]] auto CreateITextureLoader(
+    const TextureLoaderOptions& options = {})
+    -> types::Expected<ITextureLoaderPtr>;
+
+/// @brief Delete a texture made by ITextureLoader and reset `texture`.
+DLLEXPORT auto DeleteTexture(Texture& texture) -> void;
+
+}  // namespace graphics_engine::texture_loader
+
+#endif  // ENGINE_LIB_I_TEXTURE_LOADER_H_
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_IMAGE_FINGERPRINT_H_
+#define ENGINE_LIB_IMAGE_FINGERPRINT_H_
+
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+
+#include "dll-export.h"
+#include "image.h"
+#include "types.h"
+
+namespace graphics_engine::image_fingerprint {
+
+/// @brief Hashes identifying an image without keeping its pixels.
+struct ImageFingerprint {
+  /// Hash of the dimensions and the pixels as top-down RGBA, so the same
+  /// picture hashes the same whatever its channel count, row order or file
+  /// format. Equal hashes mean identical images, barring collisions.
+  std::uint64_t content_hash{};
+
+  /// Difference hash (dHash) of the image's luminance scaled down to 9x8:
+  /// each bit tells whether a cell is brighter than its right neighbour.
+  /// Similar images have hashes a small HammingDistance apart.
+  std::uint64_t perceptual_hash{};
+
+  int width{};
+  int height{};
+
+  auto operator==(const ImageFingerprint&) const -> bool = default;
+};
+
+/// @brief Fingerprint pixels in memory.
+/// @param image The pixels to fingerprint.
+/// @return the fingerprint on success, kInvalidImage if `image` is
+/// malformed.
+DLLEXPORT [[nodiscard]] auto ComputeFingerprint(const image::ImageView& image)
+    -> types::Expected<ImageFingerprint>;
+
+/// @brief Fingerprint an image file in any format image::CompareImages reads.
+/// @param file The image to fingerprint.
+/// @return the fingerprint on success, kStbErrorLoad if the file can't be
+/// read or decoded.
+DLLEXPORT [[nodiscard]] auto ComputeFingerprint(
+    const std::filesystem::path& file) -> types::Expected<ImageFingerprint>;
+
+/// @return the number of bits in which two perceptual hashes differ, from 0
+/// for near-identical images to 64. Below about 10 the images usually look
+/// alike.
+[[nodiscard]] constexpr auto HammingDistance(std::uint64_t hash0,
+                                             std::uint64_t hash1) -> int {
+  return std::popcount(hash0 ^ hash1);
+}
+
+}  // namespace graphics_engine::image_fingerprint
+
+#endif  // ENGINE_LIB_IMAGE_FINGERPRINT_H_
@@ -5,30 +5,170 @@
 #ifndef ENGINE_LIB_IMAGE_H_
 #define ENGINE_LIB_IMAGE_H_
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
 
 #include "dll-export.h"
 #include "types.h"
 
 namespace graphics_engine::image {
 
-/// @brief Determine if two png files are identical.
-/// @param png0 The first png file to compare.
-/// @param png1 The second png file to compare.
+/// @brief A rectangle of pixels. x grows to the right and y downwards from the
+/// top-left corner of the image.
+struct PixelRect {
+  int x{};
+  int y{};
+  int width{};
+  int height{};
+};
+
+/// @brief File formats images can be written in.
+enum class ImageFormat {
+  /// Deflate-compressed, readable everywhere; the slowest to write.
+  kPng,
+  /// The "Quite OK Image" format: lossless and much faster to encode than
+  /// png, usually at a similar size.
+  kQoi,
+  /// Netpbm PAM (P7): an uncompressed header plus raw pixels, keeping alpha.
+  kPam,
+  /// Netpbm PPM (P6): an uncompressed header plus raw RGB; alpha is dropped.
+  kPpm,
+};
+
+/// @brief How to write an image.
+struct EncodeOptions {
+  ImageFormat format{ImageFormat::kPng};
+
+  /// For kPng, from 0 to 9. 0 skips filtering and compression entirely,
+  /// 1 to 4 use one cheap filter and the fastest deflate setting, 5 to 9 pick
+  /// the best filter per row and search harder for matches as the level
+  /// rises.
+  int png_compression_level{8};
+};
+
+/// @brief Pixels to encode, 8 bits per channel.
+struct ImageView {
+  int width{};
+  int height{};
+  /// 1 (gray), 2 (gray, alpha), 3 (RGB) or 4 (RGBA).
+  int channels{};
+  /// width * height * channels bytes, rows tightly packed.
+  ::std::span<const ::std::byte> pixels{};
+  /// true if the first row is the bottom one, as glReadPixels returns them.
+  bool bottom_up{};
+};
+
+/// @return the file extension for `format`, including the dot.
+DLLEXPORT [[nodiscard]] auto GetExtension(ImageFormat format)
+    -> ::std::string_view;
+
+/// @brief Encode an image in memory.
+/// @param image The pixels to encode.
+/// @param options The format and its settings.
+/// @return the encoded file contents, kInvalidImage if `image` is
+/// malformed, kStbErrorWritePng if png compression fails.
+DLLEXPORT [[nodiscard]] auto EncodeImage(const ImageView& image,
+                                         const EncodeOptions& options = {})
+    -> ::graphics_engine::types::Expected<::std::vector<::std::byte>>;
+
+/// @brief Options for CompareImages.
+struct CompareOptions {
+  /// Largest difference allowed per channel (R, G, B, A, or the image's own
+  /// channel order) before a pixel counts as mismatching.
+  ::std::array<::std::uint8_t, 4> tolerance{};
+
+  /// Pixels inside any of these rectangles are never compared, e.g. to skip a
+  /// frame counter or a blinking cursor.
+  ::std::vector<PixelRect> ignore_regions{};
+
+  /// If set, an RGBA png is written here showing mismatching pixels in red
+  /// (brighter for larger differences), ignored pixels in blue and matching
+  /// pixels as a dimmed gray copy of the first image. Requires a full pass
+  /// over the images.
+  ::std::optional<::std::filesystem::path> heatmap{};
+
+  /// Write the heatmap only if the images have the same dimensions and
+  /// differ. Matching images then skip the heatmap's full pass; mismatching
+  /// ones get it without being decoded again.
+  bool heatmap_only_on_mismatch{};
+
+  /// Stop at the first mismatching pixel; the result then only tells whether
+  /// the images match. Ignored when a heatmap is requested.
+  bool stop_at_first_mismatch{};
+};
+
+/// @brief The outcome of CompareImages.
+struct CompareResult {
+  /// true if both images have the same width, height and channel count.
+  bool same_dimensions{};
+
+  /// Number of pixels differing by more than the tolerance outside of the
+  /// ignored regions. 0 if the dimensions differ.
+  ::std::size_t mismatch_count{};
+
+  /// Smallest rectangle containing every mismatching pixel; empty if there are
+  /// none.
+  PixelRect mismatch_bounds{};
+
+  /// @return true if the images match within the tolerance.
+  [[nodiscard]] auto Matches() const -> bool {
+    return same_dimensions && mismatch_count == 0;
+  }
+};
+
+/// @brief Determine if two image files are identical.
+/// @param png0 The first file to compare.
+/// @param png1 The second file to compare.
 /// @return true if the files are identical, false if they differ, and error if
 /// something went wrong while trying to compare them.
 DLLEXPORT [[nodiscard]] auto AreIdentical(const ::std::filesystem::path& png0,
                                           const ::std::filesystem::path& png1)
     -> ::graphics_engine::types::Expected<bool>;
 
+/// @brief Compare two image files pixel by pixel.
+/// @param png0 The first file to compare, also used for the heatmap.
+/// @param png1 The second file to compare.
+/// @param options Tolerance, ignored regions and heatmap output.
+/// @return the comparison on success, kStbErrorLoad if a file can't be
+/// decoded, kFileIoError if the heatmap can't be written.
+/// @note Both files are decoded in parallel. Any ImageFormat can be read, as
+/// can the other formats stb_image supports; a file's format is detected from
+/// its contents, so the two files may differ in format.
+DLLEXPORT [[nodiscard]] auto CompareImages(
+    const ::std::filesystem::path& png0, const ::std::filesystem::path& png1,
+    const CompareOptions& options = {})
+    -> ::graphics_engine::types::Expected<CompareResult>;
+
+/// @brief Compare pixels in memory, such as a frame just read back, with an
+/// image file.
+/// @param image The pixels to compare, also used for the heatmap.
+/// @param reference The file to compare them with.
+/// @param options Tolerance, ignored regions and heatmap output.
+/// @return the comparison on success, kInvalidImage if `image` is
+/// malformed, kStbErrorLoad if `reference` can't be decoded,
+/// kFileIoError if the heatmap can't be written.
+/// @note `reference` is decoded while `image` is brought into top-down order.
+DLLEXPORT [[nodiscard]] auto CompareImages(
+    const ImageView& image, const ::std::filesystem::path& reference,
+    const CompareOptions& options = {})
+    -> ::graphics_engine::types::Expected<CompareResult>;
+
 /// @brief Capture a screenshot of the current rendering context.
 /// @param dest Optional destination path for the screenshot.
+/// @param options The file format to write.
 /// @return path to screenshot on success, error on failure.
 /// @note If `dest` is not provided, the screenshot will be saved to
-/// std::filesystem::temp_directory_path()/"screenshot.png"
+/// std::filesystem::temp_directory_path()/"screenshot" plus the format's
+/// extension.
 DLLEXPORT [[nodiscard]] auto CaptureScreenshot(
-    const ::std::optional<::std::filesystem::path>& dest = ::std::nullopt)
+    const ::std::optional<::std::filesystem::path>& dest = ::std::nullopt,
+    const EncodeOptions& options = {})
     -> ::graphics_engine::types::Expected<void>;
 
 }  // namespace graphics_engine::image
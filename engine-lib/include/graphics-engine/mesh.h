@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_MESH_H_
+#define ENGINE_LIB_MESH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "dll-export.h"
+#include "gl-types.h"
+#include "types.h"
+
+namespace graphics_engine::mesh {
+
+/// @brief An index buffer uploaded by UploadIndices.
+struct IndexBuffer {
+  unsigned int buffer{};  ///< The GL buffer name, owned by the caller.
+  gl_types::GLDataType type{gl_types::GLDataType::kUnsignedInt};
+  int count{};  ///< Number of indices in the buffer.
+};
+
+/// @brief Pick the smallest index type able to address `vertex_count`
+/// vertices.
+/// @return kUnsignedShort if every index fits in 16 bits, kUnsignedInt
+/// otherwise. 0xFFFF is left unused so it stays free as a primitive restart
+/// index.
+DLLEXPORT [[nodiscard]] auto SelectIndexType(std::size_t vertex_count)
+    -> gl_types::GLDataType;
+
+/// @brief Create a kElementArray buffer holding `indices`, narrowed to 16 bits
+/// when SelectIndexType allows it.
+/// @param indices Indices into a vertex buffer of `vertex_count` vertices.
+/// @param vertex_count Number of vertices the indices refer to.
+/// @param usage The usage hint passed to BufferData.
+/// @return the index buffer on success, kGLErrorInvalidValue if an index is
+/// out of range, error on failure.
+/// @note The buffer is left bound to kElementArray, so it is recorded in the
+/// currently bound vertex array. Draw it with DrawElements or
+/// DrawElementsBaseVertex using the returned type and count.
+DLLEXPORT [[nodiscard]] auto UploadIndices(
+    std::span<const std::uint32_t> indices, std::size_t vertex_count,
+    gl_types::GLDataUsagePattern usage) -> types::Expected<IndexBuffer>;
+
+}  // namespace graphics_engine::mesh
+
+#endif  // ENGINE_LIB_MESH_H_
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_QUANTIZE_H_
+#define ENGINE_LIB_QUANTIZE_H_
+
+#include <cstdint>
+#include <span>
+
+#include "dll-export.h"
+#include "gl-types.h"
+#include "types.h"
+
+namespace graphics_engine::quantize {
+
+/// @brief The VertexAttribPointer arguments for a packed attribute.
+struct AttributeFormat {
+  int size{};
+  gl_types::GLDataType type{};
+  unsigned char normalized{};
+  int bytes{};  ///< Size of one packed attribute, for computing strides.
+};
+
+/// Positions packed by PackPositions: x, y, z and a padding 1.0 as halves.
+inline constexpr AttributeFormat kPositionFormat{
+    .size = 4, .type = gl_types::GLDataType::kHalfFloat, .bytes = 8};
+/// Texture coordinates packed by PackHalf.
+inline constexpr AttributeFormat kUvFormat{
+    .size = 2, .type = gl_types::GLDataType::kHalfFloat, .bytes = 4};
+/// Normals and tangents packed by PackNormals.
+inline constexpr AttributeFormat kNormalFormat{
+    .size = 4,
+    .type = gl_types::GLDataType::kInt_2_10_10_10_Rev,
+    .normalized = 1,
+    .bytes = 4};
+/// Colors packed by PackColors.
+inline constexpr AttributeFormat kColorFormat{
+    .size = 4,
+    .type = gl_types::GLDataType::kUnsignedInt_2_10_10_10_Rev,
+    .normalized = 1,
+    .bytes = 4};
+
+/// Largest relative error of a finite float within the half-float range after
+/// a round trip through FloatToHalf.
+inline constexpr float kHalfRelativeError = 1.F / 2048.F;
+/// Largest absolute error of a component in [-1, 1] packed by PackNormals.
+inline constexpr float kNormalMaxError = 0.5F / 511.F;
+/// Largest absolute error of r, g or b in [0, 1] packed by PackColors.
+inline constexpr float kColorMaxError = 0.5F / 1023.F;
+/// Largest absolute error of alpha in [0, 1] packed by PackColors.
+inline constexpr float kAlphaMaxError = 0.5F / 3.F;
+
+/// @brief Convert a float to an IEEE 754 half, rounding to nearest even.
+/// Values beyond the half range become infinity.
+DLLEXPORT [[nodiscard]] auto FloatToHalf(float value) -> std::uint16_t;
+
+/// @brief Convert an IEEE 754 half to a float. Exact.
+DLLEXPORT [[nodiscard]] auto HalfToFloat(std::uint16_t half) -> float;
+
+/// @brief Pack x, y, z and w as signed normalized values, matching
+/// kInt_2_10_10_10_Rev. Components are clamped to [-1, 1].
+DLLEXPORT [[nodiscard]] auto PackSnorm2101010(float x, float y, float z,
+                                              float w) -> std::uint32_t;
+
+/// @brief Pack x, y, z and w as unsigned normalized values, matching
+/// kUnsignedInt_2_10_10_10_Rev. Components are clamped to [0, 1].
+DLLEXPORT [[nodiscard]] auto PackUnorm2101010(float x, float y, float z,
+                                              float w) -> std::uint32_t;
+
+/// @brief Convert every value to a half, e.g. texture coordinates.
+/// @return void on success, kGLErrorInvalidValue if the spans differ in size.
+DLLEXPORT [[nodiscard]] auto PackHalf(std::span<const float> values,
+                                      std::span<std::uint16_t> halves)
+    -> types::Expected<void>;
+
+/// @brief Convert x, y, z positions to four halves each (kPositionFormat),
+/// padding with w = 1 so every vertex stays 8-byte aligned.
+/// @return void on success, kGLErrorInvalidValue unless `positions` holds
+/// whole vertices and `halves` four halves per vertex.
+DLLEXPORT [[nodiscard]] auto PackPositions(std::span<const float> positions,
+                                           std::span<std::uint16_t> halves)
+    -> types::Expected<void>;
+
+/// @brief Pack unit x, y, z normals (kNormalFormat) with w = 0.
+/// @return void on success, kGLErrorInvalidValue unless `normals` holds one
+/// x, y, z triple per element of `packed`.
+DLLEXPORT [[nodiscard]] auto PackNormals(std::span<const float> normals,
+                                         std::span<std::uint32_t> packed)
+    -> types::Expected<void>;
+
+/// @brief Pack r, g, b, a colors (kColorFormat).
+/// @return void on success, kGLErrorInvalidValue unless `colors` holds one
+/// r, g, b, a quadruple per element of `packed`.
+DLLEXPORT [[nodiscard]] auto PackColors(std::span<const float> colors,
+                                        std::span<std::uint32_t> packed)
+    -> types::Expected<void>;
+
+}  // namespace graphics_engine::quantize
+
+#endif  // ENGINE_LIB_QUANTIZE_H_
@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_TEXTURE_CONTAINER_H_
+#define ENGINE_LIB_TEXTURE_CONTAINER_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "dll-export.h"
+#include "i-texture-loader.h"
+#include "image.h"
+#include "types.h"
+
+namespace graphics_engine::texture_container {
+
+/// @brief Pixel formats a container can hold.
+enum class TexturePixelFormat : std::uint32_t {
+  /// 8 bits per channel RGBA, uploaded as GL_RGBA8.
+  kRgba8 = 1,
+};
+
+/// @brief Options for writing a container.
+struct TextureContainerOptions {
+  /// Store a full mipmap chain, box-filtered from the image, instead of only
+  /// the image itself.
+  bool generate_mipmaps{true};
+};
+
+/// @brief Where one mip level lives in a container.
+struct TextureContainerLevel {
+  int width{};
+  int height{};
+  std::uint64_t offset{};
+  std::uint64_t size{};
+};
+
+/// @brief The header and level table of a container.
+struct TextureContainerInfo {
+  TexturePixelFormat format{TexturePixelFormat::kRgba8};
+  int width{};
+  int height{};
+  std::vector<TextureContainerLevel> levels;
+};
+
+/// @brief Write `image` as a container: a pre-decoded texture laid out so
+/// loading is a memory mapping and one glTexSubImage2D per mip level, with
+/// no decoding and no intermediate copy.
+///
+/// File layout, all integers little-endian:
+///  - A 32 byte header: the magic "GETEXTR1", then u32 version (1), pixel
+///    format (TexturePixelFormat), width, height, mip level count and the
+///    alignment of the level data in bytes (64).
+///  - The level table: per level a u64 file offset and u64 byte size.
+///    Level n is max(1, width >> n) by max(1, height >> n) pixels.
+///  - The levels, each starting on an aligned offset, rows tightly packed
+///    and top row first like ITextureLoader's textures. RGBA8 rows are a
+///    multiple of 4 bytes, OpenGL's default unpack alignment.
+///
+/// @param image The pixels; any channel count is expanded to RGBA.
+/// @param file The container to create; an existing file is overwritten.
+/// @param options Whether to store mipmaps.
+/// @return void on success, kInvalidImage if `image` is malformed,
+/// kFileIoError if the file can't be written.
+DLLEXPORT [[nodiscard]] auto WriteTextureContainer(
+    const image::ImageView& image, const std::filesystem::path& file,
+    const TextureContainerOptions& options = {}) -> types::Expected<void>;
+
+/// @brief Convert any image stb_image, or image::CompareImages, can read
+/// into a container. Meant for asset build steps.
+/// @return void on success, kStbErrorLoad if `source` can't be decoded,
+/// kFileIoError if `destination` can't be written.
+DLLEXPORT [[nodiscard]] auto ConvertToTextureContainer(
+    const std::filesystem::path& source,
+    const std::filesystem::path& destination,
+    const TextureContainerOptions& options = {}) -> types::Expected<void>;
+
+/// @brief Read and validate the header and level table of a container.
+/// @return the info on success, kFileIoError if the file can't be mapped or
+/// isn't a well-formed container.
+DLLEXPORT [[nodiscard]] auto ReadTextureContainerInfo(
+    const std::filesystem::path& file) -> types::Expected<TextureContainerInfo>;
+
+/// @brief Map a container and upload it into a new texture, straight from
+/// the mapping. Must be called with the OpenGL context current.
+/// @return the texture on success, kFileIoError if the file can't be mapped
+/// or is malformed, error if the upload fails. Free it with
+/// texture_loader::DeleteTexture.
+DLLEXPORT [[nodiscard]] auto LoadTextureContainer(
+    const std::filesystem::path& file)
+    -> types::Expected<texture_loader::Texture>;
+
+}  // namespace graphics_engine::texture_container
+
+#endif  // ENGINE_LIB_TEXTURE_CONTAINER_H_
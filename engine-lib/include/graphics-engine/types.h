@@ -27,6 +27,14 @@ enum class ErrorCode : std::uint8_t {
   kShaderError,
   kStbErrorLoad,
   kStbErrorWritePng,
+  kCommandBufferFull,
+  kCommandQueueFull,
+  kGLExtensionUnavailable,
+  kRingBufferFull,
+  kMeshArenaFull,
+  kFileIoError,
+  kTextureAtlasFull,
+  kInvalidImage,
   kNumErrorCodes  // Sentinel value to track enum size
 };
 
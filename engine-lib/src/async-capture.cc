@@ -0,0 +1,156 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "async-capture.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+
+#include "error.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::cerr;
+using std::size_t;
+using std::unexpected;
+
+namespace graphics_engine::async_capture {
+
+AsyncCapture::~AsyncCapture() {
+  // Complete every future rather than leaving waiters with a broken promise.
+  (void)Flush();
+}
+
+auto AsyncCapture::Initialize(size_t buffer_count) -> Expected<void> {
+  if (buffer_count == 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  slots_.resize(buffer_count);
+  for (size_t i = 0; i < buffer_count; ++i) {
+    Expected<void> result = slots_[i].readback.Initialize();
+    if (!result.has_value()) {
+      return result;
+    }
+    free_.push_back(i);
+  }
+
+  return {};
+}
+
+auto AsyncCapture::Capture() -> Expected<CaptureFuture> {
+  Expected<void> polled = Poll();
+  if (!polled.has_value()) {
+    return unexpected(polled.error());
+  }
+
+  if (free_.empty()) {
+    Expected<bool> resolved = Resolve(true);
+    if (!resolved.has_value()) {
+      return unexpected(resolved.error());
+    }
+  }
+
+  array<GLint, 4> viewport{};
+  glGetIntegerv(GL_VIEWPORT, viewport.data());
+
+  const size_t index = free_.front();
+  Slot& slot = slots_[index];
+  Expected<void> result = slot.readback.Issue(viewport[2], viewport[3]);
+  if (!result.has_value()) {
+    return unexpected(result.error());
+  }
+
+  slot.promise = {};
+  CaptureFuture future = slot.promise.get_future();
+  free_.pop_front();
+  pending_.push_back(index);
+  return future;
+}
+
+auto AsyncCapture::Resolve(bool block) -> Expected<bool> {
+  assert(!pending_.empty());
+  const size_t index = pending_.front();
+  Slot& slot = slots_[index];
+
+  Expected<bool> finished = slot.readback.Wait(block);
+  if (finished.has_value() && !*finished) {
+    return false;
+  }
+  pending_.pop_front();
+  free_.push_back(index);
+
+  CapturedFrame frame{.width = slot.readback.GetWidth(),
+                      .height = slot.readback.GetHeight(),
+                      .pixels = {}};
+  Expected<void> result{};
+  if (!finished.has_value()) {
+    result = unexpected(finished.error());
+  } else {
+    frame.pixels.resize(slot.readback.GetSize());
+    result = slot.readback.CopyTo(frame.pixels);
+  }
+
+  if (!result.has_value()) {
+    frame.pixels.clear();
+    slot.promise.set_value(unexpected(result.error()));
+    return unexpected(result.error());
+  }
+
+  slot.promise.set_value(std::move(frame));
+  return true;
+}
+
+auto AsyncCapture::Poll() -> Expected<void> {
+  while (!pending_.empty()) {
+    Expected<bool> resolved = Resolve(false);
+    if (!resolved.has_value()) {
+      return unexpected(resolved.error());
+    }
+    if (!*resolved) {
+      break;
+    }
+  }
+
+  return {};
+}
+
+auto AsyncCapture::Flush() -> Expected<void> {
+  // Keep going after an error so every fence is deleted and every future
+  // completed; Resolve pops the slot either way.
+  Expected<void> result{};
+  while (!pending_.empty()) {
+    Expected<bool> resolved = Resolve(true);
+    if (!resolved.has_value() && result.has_value()) {
+      result = unexpected(resolved.error());
+    }
+  }
+
+  return result;
+}
+
+auto AsyncCapture::GetPendingCount() const -> size_t {
+  return pending_.size();
+}
+
+auto CreateIAsyncCapture(size_t buffer_count) -> Expected<IAsyncCapturePtr> {
+  auto capture = std::make_unique<AsyncCapture>();
+  Expected<void> result = capture->Initialize(buffer_count);
+  if (!result.has_value()) {
+    cerr << "Async capture initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+
+  return capture;
+}
+
+}  // namespace graphics_engine::async_capture
@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_ASYNC_CAPTURE_H_
+#define ENGINE_LIB_ASYNC_CAPTURE_H_
+
+#include <deque>
+#include <future>
+#include <vector>
+
+#include "graphics-engine/i-async-capture.h"
+#include "graphics-engine/types.h"
+#include "readback-slot.h"
+
+namespace graphics_engine::async_capture {
+
+class AsyncCapture : public IAsyncCapture {
+ public:
+  AsyncCapture() = default;
+  ~AsyncCapture() override;
+
+  AsyncCapture(const AsyncCapture&) = delete;
+  AsyncCapture(AsyncCapture&&) = delete;
+  auto operator=(const AsyncCapture&) -> AsyncCapture& = delete;
+  auto operator=(AsyncCapture&&) -> AsyncCapture& = delete;
+
+  [[nodiscard]] auto Initialize(std::size_t buffer_count)
+      -> types::Expected<void>;
+
+  [[nodiscard]] auto Capture() -> types::Expected<CaptureFuture> override;
+  [[nodiscard]] auto Poll() -> types::Expected<void> override;
+  [[nodiscard]] auto Flush() -> types::Expected<void> override;
+
+  [[nodiscard]] auto GetPendingCount() const -> std::size_t override;
+
+ private:
+  // A readback and the future of the frame queued into it, if any.
+  struct Slot {
+    readback_slot::ReadbackSlot readback;
+    std::promise<types::Expected<CapturedFrame>> promise;
+  };
+
+  // Complete the oldest pending read. Returns false if it is still running
+  // and `block` is false.
+  [[nodiscard]] auto Resolve(bool block) -> types::Expected<bool>;
+
+  std::vector<Slot> slots_;
+  std::deque<std::size_t> pending_;  // Slot indices, oldest first.
+  std::deque<std::size_t> free_;
+};
+
+}  // namespace graphics_engine::async_capture
+
+#endif  // ENGINE_LIB_ASYNC_CAPTURE_H_
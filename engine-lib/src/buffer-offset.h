@@ -0,0 +1,21 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_BUFFER_OFFSET_H_
+#define ENGINE_LIB_BUFFER_OFFSET_H_
+
+#include <cstdint>
+
+namespace graphics_engine::buffer_offset {
+
+// Buffer-relative offsets are passed to GL as pointers.
+[[nodiscard]] inline auto OffsetToPointer(long long int offset)
+    -> const void* {
+  // NOLINTNEXTLINE(*-reinterpret-cast,*-no-int-to-ptr)
+  return reinterpret_cast<const void*>(static_cast<std::intptr_t>(offset));
+}
+
+}  // namespace graphics_engine::buffer_offset
+
+#endif  // ENGINE_LIB_BUFFER_OFFSET_H_
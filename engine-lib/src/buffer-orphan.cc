@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "buffer-orphan.h"
+
+#include <algorithm>
+
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+
+using graphics_engine::gl_types::GLBufferTarget;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::types::Expected;
+
+namespace graphics_engine::buffer_orphan {
+
+auto OrphanBuffer(GLBufferTarget target, long long int size,
+                  long long int& capacity) -> Expected<void> {
+  const long long int new_capacity = std::max(size, capacity);
+  Expected<void> result =
+      BufferData(target, new_capacity, nullptr, kStreamDraw);
+  if (result.has_value()) {
+    capacity = new_capacity;
+  }
+  return result;
+}
+
+}  // namespace graphics_engine::buffer_orphan
@@ -0,0 +1,24 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_BUFFER_ORPHAN_H_
+#define ENGINE_LIB_BUFFER_ORPHAN_H_
+
+#include "graphics-engine/gl-types.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::buffer_orphan {
+
+// Re-specifies the store of the buffer bound to `target` before it is
+// refilled with BufferSubData. The driver can then hand out fresh memory
+// instead of waiting for draws that still read the previous contents. The
+// store never shrinks: it is sized to the larger of `size` and `capacity`,
+// and `capacity` is updated to match.
+[[nodiscard]] auto OrphanBuffer(gl_types::GLBufferTarget target,
+                                long long int size, long long int& capacity)
+    -> types::Expected<void>;
+
+}  // namespace graphics_engine::buffer_orphan
+
+#endif  // ENGINE_LIB_BUFFER_ORPHAN_H_
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "capture-writer.h"
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+#include "error.h"
+#include "image-codec.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::async_capture::CapturedFrame;
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::image::EncodeOptions;
+using graphics_engine::image_codec::WriteImage;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::lock_guard;
+using std::size_t;
+using std::unexpected;
+using std::unique_lock;
+using std::filesystem::path;
+
+namespace graphics_engine::capture_writer {
+
+namespace {
+
+constexpr int kChannels = 4;
+
+}  // namespace
+
+CaptureWriter::CaptureWriter(const CaptureWriterOptions& options)
+    : queue_capacity_{options.queue_capacity} {
+  workers_.reserve(options.worker_count);
+  for (size_t i = 0; i < options.worker_count; ++i) {
+    workers_.emplace_back([this]() { RunWorker(); });
+  }
+}
+
+CaptureWriter::~CaptureWriter() {
+  {
+    lock_guard lock{mutex_};
+    stopping_ = true;
+  }
+  job_available_.notify_all();
+
+  // Workers drain the queue before they exit.
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+auto CaptureWriter::Submit(CapturedFrame frame, path file,
+                           const EncodeOptions& options) -> Expected<void> {
+  const auto size = static_cast<size_t>(frame.width) *
+                    static_cast<size_t>(frame.height) * kChannels;
+  if (frame.width <= 0 || frame.height <= 0 || frame.pixels.size() != size) {
+    return unexpected(MakeErrorCode(kInvalidImage));
+  }
+
+  {
+    unique_lock lock{mutex_};
+    space_available_.wait(lock,
+                          [this]() { return queue_.size() < queue_capacity_; });
+    queue_.push_back({.frame = std::move(frame),
+                      .file = std::move(file),
+                      .options = options});
+  }
+  job_available_.notify_one();
+
+  return {};
+}
+
+auto CaptureWriter::Flush() -> Expected<void> {
+  unique_lock lock{mutex_};
+  idle_.wait(lock, [this]() { return queue_.empty() && active_ == 0; });
+
+  if (first_error_.has_value()) {
+    const std::error_code error = *first_error_;
+    first_error_.reset();
+    return unexpected(error);
+  }
+
+  return {};
+}
+
+auto CaptureWriter::GetPendingCount() const -> size_t {
+  lock_guard lock{mutex_};
+  return queue_.size() + active_;
+}
+
+auto CaptureWriter::RunWorker() -> void {
+  while (true) {
+    Job job;
+    {
+      unique_lock lock{mutex_};
+      job_available_.wait(lock,
+                          [this]() { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;  // Stopping and nothing left to write.
+      }
+      job = std::move(queue_.front());
+      queue_.pop_front();
+      ++active_;
+    }
+    space_available_.notify_one();
+
+    // Encoding is the expensive part and runs without the lock.
+    Expected<void> result = WriteImage(job.file,
+                                       {.width = job.frame.width,
+                                        .height = job.frame.height,
+                                        .channels = kChannels,
+                                        .pixels = job.frame.pixels,
+                                        .bottom_up = true},
+                                       job.options);
+    if (!result.has_value()) {
+      cerr << "Failed to write capture to " << job.file << '\n';
+    }
+
+    // Release the pixels before Flush can observe the job as done.
+    job = {};
+
+    bool idle = false;
+    {
+      lock_guard lock{mutex_};
+      if (!result.has_value() && !first_error_.has_value()) {
+        first_error_ = result.error();
+      }
+      --active_;
+      idle = queue_.empty() && active_ == 0;
+    }
+    if (idle) {
+      idle_.notify_all();
+    }
+  }
+}
+
+auto CreateICaptureWriter(const CaptureWriterOptions& options)
+    -> Expected<ICaptureWriterPtr> {
+  if (options.worker_count == 0 || options.queue_capacity == 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  return std::make_unique<CaptureWriter>(options);
+}
+
+}  // namespace graphics_engine::capture_writer
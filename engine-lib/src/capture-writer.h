@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_CAPTURE_WRITER_H_
+#define ENGINE_LIB_CAPTURE_WRITER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "graphics-engine/i-capture-writer.h"
+#include "graphics-engine/image.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::capture_writer {
+
+class CaptureWriter : public ICaptureWriter {
+ public:
+  explicit CaptureWriter(const CaptureWriterOptions& options);
+  ~CaptureWriter() override;
+
+  CaptureWriter(const CaptureWriter&) = delete;
+  CaptureWriter(CaptureWriter&&) = delete;
+  auto operator=(const CaptureWriter&) -> CaptureWriter& = delete;
+  auto operator=(CaptureWriter&&) -> CaptureWriter& = delete;
+
+  [[nodiscard]] auto Submit(async_capture::CapturedFrame frame,
+                            std::filesystem::path file,
+                            const image::EncodeOptions& options)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto Flush() -> types::Expected<void> override;
+
+  [[nodiscard]] auto GetPendingCount() const -> std::size_t override;
+
+ private:
+  struct Job {
+    async_capture::CapturedFrame frame;
+    std::filesystem::path file;
+    image::EncodeOptions options;
+  };
+
+  auto RunWorker() -> void;
+
+  std::size_t queue_capacity_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable job_available_;  // Signalled to workers.
+  std::condition_variable space_available_;  // Signalled to Submit.
+  std::condition_variable idle_;  // Signalled to Flush.
+  std::deque<Job> queue_;
+  std::size_t active_{};  // Jobs taken by a worker and not finished yet.
+  std::optional<std::error_code> first_error_;
+  bool stopping_{};
+
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace graphics_engine::capture_writer
+
+#endif  // ENGINE_LIB_CAPTURE_WRITER_H_
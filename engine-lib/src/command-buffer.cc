@@ -0,0 +1,210 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "command-buffer.h"
+
+#include <array>
+#include <cstring>
+#include <span>
+#include <utility>
+
+#include "error.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLClearBit;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::gl_clear_flags::GLClearFlags;
+using graphics_engine::gl_clear_flags::IGLClearFlags;
+using graphics_engine::gl_types::GLBufferTarget;
+using graphics_engine::gl_types::GLDataType;
+using graphics_engine::gl_types::GLDataUsagePattern;
+using graphics_engine::gl_types::GLDrawMode;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::byte;
+using std::size_t;
+using std::span;
+using std::unexpected;
+
+namespace graphics_engine::command_buffer {
+
+namespace {
+
+// Issues one recorded command through gl_wrappers.
+class CommandExecutor {
+ public:
+  explicit CommandExecutor(const std::vector<byte>& payload)
+      : payload_(payload) {}
+
+  auto operator()(const BindBufferCommand& cmd) const -> Expected<void> {
+    return gl_wrappers::BindBuffer(cmd.target, cmd.buffer);
+  }
+
+  auto operator()(const BindVertexArrayCommand& cmd) const -> Expected<void> {
+    return gl_wrappers::BindVertexArray(cmd.array);
+  }
+
+  auto operator()(const BufferDataCommand& cmd) const -> Expected<void> {
+    const void* data =
+        cmd.has_data ? span(payload_).subspan(cmd.payload_offset).data()
+                     : nullptr;
+    return gl_wrappers::BufferData(cmd.target, cmd.size, data, cmd.usage);
+  }
+
+  auto operator()(const ClearCommand& cmd) const -> Expected<void> {
+    return gl_wrappers::Clear(cmd.flags);
+  }
+
+  auto operator()(const DrawArraysCommand& cmd) const -> Expected<void> {
+    return gl_wrappers::DrawArrays(cmd.mode, cmd.first, cmd.count);
+  }
+
+  auto operator()(const EnableVertexAttribArrayCommand& cmd) const
+      -> Expected<void> {
+    return gl_wrappers::EnableVertexAttribArray(cmd.index);
+  }
+
+  auto operator()(const UseProgramCommand& cmd) const -> Expected<void> {
+    return gl_wrappers::UseProgram(cmd.program);
+  }
+
+  auto operator()(const VertexAttribPointerCommand& cmd) const
+      -> Expected<void> {
+    return gl_wrappers::VertexAttribPointer(cmd.index, cmd.size, cmd.type,
+                                            cmd.normalized, cmd.stride,
+                                            cmd.pointer);
+  }
+
+ private:
+  const std::vector<byte>& payload_;
+};
+
+}  // namespace
+
+CommandBuffer::CommandBuffer(size_t max_commands, size_t max_payload_bytes)
+    : max_commands_(max_commands), payload_(max_payload_bytes) {
+  commands_.reserve(max_commands);
+}
+
+auto CommandBuffer::Record(const Command& command) -> Expected<void> {
+  if (commands_.size() == max_commands_) {
+    return unexpected(MakeErrorCode(kCommandBufferFull));
+  }
+
+  // The capacity was reserved up front, so this never allocates.
+  commands_.push_back(command);
+  return {};
+}
+
+auto CommandBuffer::BindBuffer(GLBufferTarget target, unsigned int buffer)
+    -> Expected<void> {
+  return Record(BindBufferCommand{.target = target, .buffer = buffer});
+}
+
+auto CommandBuffer::BindVertexArray(unsigned int array) -> Expected<void> {
+  return Record(BindVertexArrayCommand{.array = array});
+}
+
+auto CommandBuffer::BufferData(GLBufferTarget target, long long int size,
+                               const void* data, GLDataUsagePattern usage)
+    -> Expected<void> {
+  if (size < 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  const bool has_data = data != nullptr;
+  const auto sz_size = static_cast<size_t>(size);
+  if (has_data && sz_size > payload_.size() - payload_size_) {
+    return unexpected(MakeErrorCode(kCommandBufferFull));
+  }
+
+  Expected<void> result =
+      Record(BufferDataCommand{.target = target,
+                               .size = size,
+                               .payload_offset = payload_size_,
+                               .has_data = has_data,
+                               .usage = usage});
+  if (!result.has_value()) {
+    return result;
+  }
+
+  if (has_data) {
+    std::memcpy(span(payload_).subspan(payload_size_).data(), data, sz_size);
+    payload_size_ += sz_size;
+  }
+
+  return {};
+}
+
+auto CommandBuffer::Clear(const IGLClearFlags& flags) -> Expected<void> {
+  // Copy the flags so the caller's object need not outlive the recording.
+  ClearCommand command;
+  for (auto bit : array{kColor, kDepth, kStencil}) {
+    if (flags.Test(bit)) {
+      command.flags.Set(bit);
+    }
+  }
+
+  return Record(command);
+}
+
+auto CommandBuffer::DrawArrays(GLDrawMode mode, int first, int count)
+    -> Expected<void> {
+  return Record(
+      DrawArraysCommand{.mode = mode, .first = first, .count = count});
+}
+
+auto CommandBuffer::EnableVertexAttribArray(unsigned int index)
+    -> Expected<void> {
+  return Record(EnableVertexAttribArrayCommand{.index = index});
+}
+
+auto CommandBuffer::UseProgram(unsigned int program) -> Expected<void> {
+  return Record(UseProgramCommand{.program = program});
+}
+
+auto CommandBuffer::VertexAttribPointer(unsigned int index, int size,
+                                        GLDataType type,
+                                        unsigned char normalized, int stride,
+                                        const void* pointer) -> Expected<void> {
+  return Record(VertexAttribPointerCommand{.index = index,
+                                           .size = size,
+                                           .type = type,
+                                           .normalized = normalized,
+                                           .stride = stride,
+                                           .pointer = pointer});
+}
+
+auto CommandBuffer::Execute() const -> Expected<void> {
+  const CommandExecutor executor(payload_);
+  for (const Command& command : commands_) {
+    Expected<void> result = std::visit(executor, command);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  return {};
+}
+
+auto CommandBuffer::Reset() -> void {
+  commands_.clear();
+  payload_size_ = 0;
+}
+
+auto CommandBuffer::GetNumCommands() const -> size_t {
+  return commands_.size();
+}
+
+auto CommandBuffer::GetPayloadSize() const -> size_t { return payload_size_; }
+
+auto CreateICommandBuffer(size_t max_commands, size_t max_payload_bytes)
+    -> ICommandBufferPtr {
+  return std::make_unique<CommandBuffer>(max_commands, max_payload_bytes);
+}
+
+}  // namespace graphics_engine::command_buffer
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_COMMAND_BUFFER_H_
+#define ENGINE_LIB_COMMAND_BUFFER_H_
+
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "gl-clear-flags.h"
+#include "graphics-engine/gl-types.h"
+#include "graphics-engine/i-command-buffer.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::command_buffer {
+
+struct BindBufferCommand {
+  gl_types::GLBufferTarget target;
+  unsigned int buffer;
+};
+
+struct BindVertexArrayCommand {
+  unsigned int array;
+};
+
+struct BufferDataCommand {
+  gl_types::GLBufferTarget target;
+  long long int size;
+  std::size_t payload_offset;  // Only meaningful when has_data is true.
+  bool has_data;
+  gl_types::GLDataUsagePattern usage;
+};
+
+struct ClearCommand {
+  gl_clear_flags::GLClearFlags flags;
+};
+
+struct DrawArraysCommand {
+  gl_types::GLDrawMode mode;
+  int first;
+  int count;
+};
+
+struct EnableVertexAttribArrayCommand {
+  unsigned int index;
+};
+
+struct UseProgramCommand {
+  unsigned int program;
+};
+
+struct VertexAttribPointerCommand {
+  unsigned int index;
+  int size;
+  gl_types::GLDataType type;
+  unsigned char normalized;
+  int stride;
+  const void* pointer;
+};
+
+using Command =
+    std::variant<BindBufferCommand, BindVertexArrayCommand, BufferDataCommand,
+                 ClearCommand, DrawArraysCommand,
+                 EnableVertexAttribArrayCommand, UseProgramCommand,
+                 VertexAttribPointerCommand>;
+
+class CommandBuffer : public ICommandBuffer {
+ public:
+  CommandBuffer(std::size_t max_commands, std::size_t max_payload_bytes);
+  ~CommandBuffer() override = default;
+
+  [[nodiscard]] auto BindBuffer(gl_types::GLBufferTarget target,
+                                unsigned int buffer)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto BindVertexArray(unsigned int array)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto BufferData(gl_types::GLBufferTarget target,
+                                long long int size, const void* data,
+                                gl_types::GLDataUsagePattern usage)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto Clear(const gl_clear_flags::IGLClearFlags& flags)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto DrawArrays(gl_types::GLDrawMode mode, int first,
+                                int count) -> types::Expected<void> override;
+  [[nodiscard]] auto EnableVertexAttribArray(unsigned int index)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto UseProgram(unsigned int program)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto VertexAttribPointer(unsigned int index, int size,
+                                         gl_types::GLDataType type,
+                                         unsigned char normalized, int stride,
+                                         const void* pointer)
+      -> types::Expected<void> override;
+
+  [[nodiscard]] auto Execute() const -> types::Expected<void> override;
+  auto Reset() -> void override;
+
+  [[nodiscard]] auto GetNumCommands() const -> std::size_t override;
+  [[nodiscard]] auto GetPayloadSize() const -> std::size_t override;
+
+ private:
+  [[nodiscard]] auto Record(const Command& command) -> types::Expected<void>;
+
+  std::size_t max_commands_;
+  std::vector<Command> commands_;
+  std::vector<std::byte> payload_;
+  std::size_t payload_size_{};
+};
+
+}  // namespace graphics_engine::command_buffer
+
+#endif  // ENGINE_LIB_COMMAND_BUFFER_H_
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "command-queue.h"
+
+#include "error.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::command_buffer::ICommandBuffer;
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::types::Expected;
+
+using std::lock_guard;
+using std::mutex;
+using std::size_t;
+using std::unexpected;
+
+namespace graphics_engine::command_queue {
+
+CommandQueue::CommandQueue(size_t max_buffers) : max_buffers_(max_buffers) {
+  submitted_.reserve(max_buffers);
+  executing_.reserve(max_buffers);
+}
+
+auto CommandQueue::Submit(const ICommandBuffer& buffer) -> Expected<void> {
+  const lock_guard<mutex> lock(mutex_);
+  if (submitted_.size() == max_buffers_) {
+    return unexpected(MakeErrorCode(kCommandQueueFull));
+  }
+
+  submitted_.push_back(&buffer);
+  return {};
+}
+
+auto CommandQueue::ExecuteSubmitted() -> Expected<void> {
+  {
+    const lock_guard<mutex> lock(mutex_);
+    submitted_.swap(executing_);
+  }
+
+  Expected<void> result;
+  for (const ICommandBuffer* buffer : executing_) {
+    result = buffer->Execute();
+    if (!result.has_value()) {
+      break;
+    }
+  }
+
+  executing_.clear();
+  return result;
+}
+
+auto CommandQueue::GetNumSubmitted() const -> size_t {
+  const lock_guard<mutex> lock(mutex_);
+  return submitted_.size();
+}
+
+auto CreateICommandQueue(size_t max_buffers) -> ICommandQueuePtr {
+  return std::make_unique<CommandQueue>(max_buffers);
+}
+
+}  // namespace graphics_engine::command_queue
@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_COMMAND_QUEUE_H_
+#define ENGINE_LIB_COMMAND_QUEUE_H_
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "graphics-engine/i-command-buffer.h"
+#include "graphics-engine/i-command-queue.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::command_queue {
+
+class CommandQueue : public ICommandQueue {
+ public:
+  explicit CommandQueue(std::size_t max_buffers);
+  ~CommandQueue() override = default;
+
+  [[nodiscard]] auto Submit(const command_buffer::ICommandBuffer& buffer)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto ExecuteSubmitted() -> types::Expected<void> override;
+  [[nodiscard]] auto GetNumSubmitted() const -> std::size_t override;
+
+ private:
+  std::size_t max_buffers_;
+  mutable std::mutex mutex_;
+
+  // Guarded by mutex_.
+  std::vector<const command_buffer::ICommandBuffer*> submitted_;
+
+  // Only touched by the context thread. Swapped with submitted_ so buffers
+  // execute without holding the lock; both keep their reserved capacity.
+  std::vector<const command_buffer::ICommandBuffer*> executing_;
+};
+
+}  // namespace graphics_engine::command_queue
+
+#endif  // ENGINE_LIB_COMMAND_QUEUE_H_
@@ -5,6 +5,7 @@
 #include "graphics-engine/engine.h"
 
 #include "error.h"
+#include "gl-state-cache.h"
 #include "glad/glad.h"
 #include "graphics-engine/gl-wrappers.h"
 
@@ -12,6 +13,7 @@ using ::glm::vec4;
 
 using ::graphics_engine::error::CheckGLError;
 using ::graphics_engine::error::MakeErrorCode;
+using ::graphics_engine::gl_state_cache::GetGLStateCache;
 using enum ::graphics_engine::types::ErrorCode;
 using ::graphics_engine::types::Expected;
 
@@ -24,17 +26,25 @@ auto InitializeEngine() -> Expected<void> {
     return unexpected(MakeErrorCode(kGladLoadGL));
   }
 
+  // A new context starts from its own defaults.
+  GetGLStateCache().Invalidate();
+
   return {};
 }
 
 auto Render() -> Expected<void> {
   glClear(GL_COLOR_BUFFER_BIT);
-  assert(glGetError() == GL_NO_ERROR);
+  CheckGLError();
 
   return {};
 }
 
 auto SetBackgroundColor(const vec4& color) -> void {
+  if (!GetGLStateCache().ShouldSetClearColor(
+          {color[0], color[1], color[2], color[3]})) {
+    return;
+  }
+
   glClearColor(color[0], color[1], color[2], color[3]);
 }
 
@@ -4,18 +4,63 @@
 
 #include "error.h"
 
+#include <algorithm>
+#include <array>
+#include <iostream>
 #include <utility>
 
+using ::graphics_engine::gl_types::GLErrorPolicy;
+using enum ::graphics_engine::gl_types::GLErrorPolicy;
 using ::graphics_engine::types::ErrorCode;
 using enum ::graphics_engine::types::ErrorCode;
+using ::graphics_engine::types::Expected;
 
+using std::array;
+using std::cerr;
 using std::error_category;
 using std::error_code;
+using std::min;
+using std::size_t;
 using std::string;
+using std::string_view;
 using std::to_underlying;
+using std::unexpected;
 
 namespace graphics_engine::error {
 
+namespace {
+
+#if defined(ENGINE_LIB_GL_ERROR_POLICY_NONE)
+constexpr GLErrorPolicy kDefaultGLErrorPolicy = kCheckNone;
+#elif defined(ENGINE_LIB_GL_ERROR_POLICY_DEFERRED)
+constexpr GLErrorPolicy kDefaultGLErrorPolicy = kCheckDeferred;
+#else
+constexpr GLErrorPolicy kDefaultGLErrorPolicy = kCheckEveryCall;
+#endif
+
+constexpr size_t kNumRecentCalls = 8;
+
+// glGetError holds at most one flag per error kind, so a handful of reads
+// drains it. The cap protects against a context that keeps reporting errors.
+constexpr int kMaxQueuedErrors = 16;
+
+struct DeferredCalls {
+  array<const char*, kNumRecentCalls> recent{};
+  size_t count{};
+};
+
+auto GetPolicy() -> GLErrorPolicy& {
+  static GLErrorPolicy policy = kDefaultGLErrorPolicy;
+  return policy;
+}
+
+auto GetDeferredCalls() -> DeferredCalls& {
+  static DeferredCalls calls;
+  return calls;
+}
+
+}  // namespace
+
 class ErrorCategory : public error_category {
  public:
   [[nodiscard]] auto name() const noexcept -> const char* override {
@@ -23,7 +68,7 @@ class ErrorCategory : public error_category {
   }
 
   [[nodiscard]] auto message(int condition) const -> string override {
-    constexpr int expectedCount = 12;
+    constexpr int expectedCount = 20;
     static_assert(to_underlying(kNumErrorCodes) == expectedCount,
                   "Update the switch statement below!");
 
@@ -35,6 +80,8 @@ class ErrorCategory : public error_category {
         return "glad failed to load OpenGL.";
       case kGLError:
         return "OpenGL Error";
+      case kGLErrorInvalidEnum:
+        return "OpenGL Error: Invalid Enum.";
       case kGLErrorInvalidOperation:
         return "OpenGL Error: Invalid Operation.";
       case kGLErrorInvalidValue:
@@ -47,6 +94,22 @@ class ErrorCategory : public error_category {
         return "Stb Error: Failed to load file.";
       case kStbErrorWritePng:
         return "Stb Error: Failed to write png file.";
+      case kCommandBufferFull:
+        return "Command buffer is full.";
+      case kCommandQueueFull:
+        return "Command queue is full.";
+      case kGLExtensionUnavailable:
+        return "OpenGL Error: Required extension is not available.";
+      case kRingBufferFull:
+        return "Ring buffer is full.";
+      case kMeshArenaFull:
+        return "Mesh arena is full.";
+      case kFileIoError:
+        return "Failed to read or write a file.";
+      case kTextureAtlasFull:
+        return "Texture atlas is full.";
+      case kInvalidImage:
+        return "Image size, channel count or pixel data is invalid.";
     }
   }
 };
@@ -56,10 +119,104 @@ auto GetErrorCategory() -> const ErrorCategory& {
   return instance;
 }
 
-auto CheckGLError() -> void { assert(glGetError() == GL_NO_ERROR); }
+auto CheckGLError() -> void {
+  assert(GetPolicy() != kCheckEveryCall || glGetError() == GL_NO_ERROR);
+}
 
 auto MakeErrorCode(ErrorCode code) -> error_code {
   return {to_underlying(code), GetErrorCategory()};
 }
 
+auto ConvertGLError(GLenum error) -> ErrorCode {
+  switch (error) {
+    default:
+      return kGLError;
+    case GL_INVALID_ENUM:
+      return kGLErrorInvalidEnum;
+    case GL_INVALID_OPERATION:
+      return kGLErrorInvalidOperation;
+    case GL_INVALID_VALUE:
+      return kGLErrorInvalidValue;
+    case GL_OUT_OF_MEMORY:
+      return kGLErrorOutOfMemory;
+  }
+}
+
+auto GetGLErrorPolicy() -> GLErrorPolicy { return GetPolicy(); }
+
+auto SetGLErrorPolicy(GLErrorPolicy policy) -> void {
+  GetPolicy() = policy;
+  GetDeferredCalls().count = 0;
+}
+
+auto PollGLError(const char* function_name) -> GLenum {
+  switch (GetPolicy()) {
+    default:
+      assert(false);  // If we get here, add a new case to the switch.
+      [[fallthrough]];
+    case kCheckEveryCall:
+      return glGetError();
+    case kCheckDeferred: {
+      DeferredCalls& calls = GetDeferredCalls();
+      calls.recent.at(calls.count % kNumRecentCalls) = function_name;
+      ++calls.count;
+      return GL_NO_ERROR;
+    }
+    case kCheckNone:
+      return GL_NO_ERROR;
+  }
+}
+
+auto CheckGLCall(const char* function_name) -> Expected<void> {
+  if (GLenum error = PollGLError(function_name); error != GL_NO_ERROR) {
+    cerr << function_name << " failed with error code " << error << '\n';
+    return unexpected(MakeErrorCode(ConvertGLError(error)));
+  }
+  return {};
+}
+
+auto CheckDeferredGLErrors(string_view scope) -> Expected<void> {
+  DeferredCalls& calls = GetDeferredCalls();
+  if (GetPolicy() != kCheckDeferred) {
+    calls.count = 0;
+    return {};
+  }
+
+  GLenum first_error = GL_NO_ERROR;
+  for (int i = 0; i < kMaxQueuedErrors; ++i) {
+    GLenum error = glGetError();
+    if (error == GL_NO_ERROR) {
+      break;
+    }
+
+    if (first_error == GL_NO_ERROR) {
+      first_error = error;
+    }
+
+    cerr << "OpenGL error code " << error << " detected in scope '" << scope
+         << "'\n";
+  }
+
+  if (first_error == GL_NO_ERROR) {
+    calls.count = 0;
+    return {};
+  }
+
+  // glGetError cannot say which call raised the error, so report the calls
+  // that were issued since the last check, most recent first.
+  cerr << "  " << calls.count << " call(s) since the last check";
+  const size_t num_recent = min(calls.count, kNumRecentCalls);
+  if (num_recent > 0) {
+    cerr << ", most recent first:";
+  }
+  cerr << '\n';
+  for (size_t i = 0; i < num_recent; ++i) {
+    const size_t index = (calls.count - 1 - i) % kNumRecentCalls;
+    cerr << "    " << calls.recent.at(index) << '\n';
+  }
+
+  calls.count = 0;
+  return unexpected(MakeErrorCode(ConvertGLError(first_error)));
+}
+
 }  // namespace graphics_engine::error
@@ -7,9 +7,11 @@
 
 #include <cassert>
 #include <cstdint>
+#include <string_view>
 #include <system_error>
 
 #include "glad/glad.h"
+#include "graphics-engine/gl-types.h"
 #include "graphics-engine/types.h"
 
 namespace graphics_engine::error {
@@ -17,6 +19,25 @@ namespace graphics_engine::error {
 auto CheckGLError() -> void;
 auto MakeErrorCode(::graphics_engine::types::ErrorCode code) -> std::error_code;
 
+auto ConvertGLError(GLenum error) -> ::graphics_engine::types::ErrorCode;
+auto GetGLErrorPolicy() -> ::graphics_engine::gl_types::GLErrorPolicy;
+auto SetGLErrorPolicy(::graphics_engine::gl_types::GLErrorPolicy policy)
+    -> void;
+
+// Returns the result of glGetError under kCheckEveryCall. Under the other
+// policies GL_NO_ERROR is returned without touching the driver; in
+// kCheckDeferred the function name is remembered so that a later
+// CheckDeferredGLErrors can say which calls may have raised an error.
+auto PollGLError(const char* function_name) -> GLenum;
+
+// PollGLError for calls whose exact error code doesn't change how the caller
+// recovers: logs the error and converts it with ConvertGLError.
+auto CheckGLCall(const char* function_name)
+    -> ::graphics_engine::types::Expected<void>;
+
+auto CheckDeferredGLErrors(std::string_view scope)
+    -> ::graphics_engine::types::Expected<void>;
+
 }  // namespace graphics_engine::error
 
 #endif  // ENGINE_LIB_ERROR_H_
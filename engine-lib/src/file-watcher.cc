@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "file-watcher.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <system_error>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "error.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::unexpected;
+using std::vector;
+using std::filesystem::path;
+using std::ranges::contains;
+
+namespace graphics_engine::file_watcher {
+
+auto FileWatcher::Normalize(const path& file) -> path {
+  std::error_code ignored;
+  path absolute = std::filesystem::absolute(file, ignored);
+  return (absolute.empty() ? file : absolute).lexically_normal();
+}
+
+#ifdef __linux__
+
+FileWatcher::~FileWatcher() {
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+}
+
+auto FileWatcher::Initialize() -> Expected<void> {
+  fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd_ < 0) {
+    cerr << "inotify_init1 failed: " << std::strerror(errno) << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  return {};
+}
+
+auto FileWatcher::Watch(const path& file) -> Expected<void> {
+  const path normalized = Normalize(file);
+  if (contains(files_, normalized)) {
+    return {};
+  }
+
+  // Watching the directory rather than the file keeps working when an
+  // editor replaces the file, which would drop a watch on its inode.
+  const path directory = normalized.parent_path();
+  const int wd = inotify_add_watch(fd_, directory.c_str(),
+                                   IN_CLOSE_WRITE | IN_MOVED_TO);
+  if (wd < 0) {
+    cerr << "Failed to watch " << directory << ": " << std::strerror(errno)
+         << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  // Adding a directory twice returns its existing descriptor.
+  directories_[wd] = directory;
+  files_.push_back(normalized);
+  return {};
+}
+
+auto FileWatcher::Poll() -> vector<path> {
+  vector<path> changed;
+  alignas(inotify_event) std::array<char, 4096> buffer{};
+  while (true) {
+    const ssize_t length = read(fd_, buffer.data(), buffer.size());
+    if (length < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        // Events may have been lost, so report every file as changed.
+        cerr << "Failed to read file events: " << std::strerror(errno)
+             << '\n';
+        changed = files_;
+      }
+      break;
+    }
+    if (length == 0) {
+      break;
+    }
+    for (ssize_t offset = 0; offset < length;) {
+      inotify_event event{};
+      std::memcpy(&event, buffer.data() + offset, sizeof(event));
+      const char* name = buffer.data() + offset + sizeof(event);
+      offset += static_cast<ssize_t>(sizeof(event) + event.len);
+
+      if ((event.mask & IN_Q_OVERFLOW) != 0) {
+        // The kernel dropped events, so report every file as changed.
+        cerr << "File event queue overflowed\n";
+        changed = files_;
+        continue;
+      }
+      const auto directory = directories_.find(event.wd);
+      if (event.len == 0 || directory == directories_.end()) {
+        continue;
+      }
+      path file = directory->second / name;
+      if (contains(files_, file) && !contains(changed, file)) {
+        changed.push_back(std::move(file));
+      }
+    }
+  }
+  return changed;
+}
+
+#else
+
+namespace {
+
+auto GetLastWriteTime(const path& file) -> std::filesystem::file_time_type {
+  std::error_code error;
+  const auto time = std::filesystem::last_write_time(file, error);
+  return error ? std::filesystem::file_time_type::min() : time;
+}
+
+}  // namespace
+
+FileWatcher::~FileWatcher() = default;
+
+auto FileWatcher::Initialize() -> Expected<void> { return {}; }
+
+auto FileWatcher::Watch(const path& file) -> Expected<void> {
+  const path normalized = Normalize(file);
+  if (contains(files_, normalized, &WatchedFile::file)) {
+    return {};
+  }
+  if (!std::filesystem::is_directory(normalized.parent_path())) {
+    cerr << "Failed to watch " << normalized.parent_path() << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  files_.push_back({.file = normalized,
+                    .last_write_time = GetLastWriteTime(normalized)});
+  return {};
+}
+
+auto FileWatcher::Poll() -> vector<path> {
+  vector<path> changed;
+  for (WatchedFile& watched : files_) {
+    const auto time = GetLastWriteTime(watched.file);
+    if (time != watched.last_write_time) {
+      watched.last_write_time = time;
+      if (time != std::filesystem::file_time_type::min()) {
+        changed.push_back(watched.file);
+      }
+    }
+  }
+  return changed;
+}
+
+#endif
+
+}  // namespace graphics_engine::file_watcher
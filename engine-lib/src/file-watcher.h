@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_FILE_WATCHER_H_
+#define ENGINE_LIB_FILE_WATCHER_H_
+
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::file_watcher {
+
+// Reports files that were written since the last Poll, without blocking.
+//
+// On Linux the directories holding the files are watched with inotify, so
+// files replaced by a rename, as many editors save them, are still noticed.
+// Elsewhere Poll compares each file's last write time.
+class FileWatcher {
+ public:
+  FileWatcher() = default;
+  ~FileWatcher();
+
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher(FileWatcher&&) = delete;
+  auto operator=(const FileWatcher&) -> FileWatcher& = delete;
+  auto operator=(FileWatcher&&) -> FileWatcher& = delete;
+
+  [[nodiscard]] auto Initialize() -> types::Expected<void>;
+
+  // Starts watching `file`, which needn't exist yet but whose directory
+  // must. Returns kFileIoError if the directory can't be watched.
+  [[nodiscard]] auto Watch(const std::filesystem::path& file)
+      -> types::Expected<void>;
+
+  // Returns each watched file written since the last call once, as the
+  // path Watch normalized it to. Returns every watched file if events were
+  // lost.
+  [[nodiscard]] auto Poll() -> std::vector<std::filesystem::path>;
+
+  // Returns the absolute, lexically normal form of `file` that Watch and
+  // Poll use.
+  [[nodiscard]] static auto Normalize(const std::filesystem::path& file)
+      -> std::filesystem::path;
+
+ private:
+#ifdef __linux__
+  int fd_{-1};
+  // Watched directories by watch descriptor.
+  std::unordered_map<int, std::filesystem::path> directories_;
+  std::vector<std::filesystem::path> files_;
+#else
+  struct WatchedFile {
+    std::filesystem::path file;
+    // file_time_type::min() while the file doesn't exist.
+    std::filesystem::file_time_type last_write_time;
+  };
+  std::vector<WatchedFile> files_;
+#endif
+};
+
+}  // namespace graphics_engine::file_watcher
+
+#endif  // ENGINE_LIB_FILE_WATCHER_H_
@@ -0,0 +1,235 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "fingerprint-index.h"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+#include "error.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::optional;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::uint64_t;
+using std::unexpected;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::image_fingerprint {
+
+namespace {
+
+constexpr string_view kHeader = "# graphics-engine fingerprint index 1";
+constexpr int kHashDigits = 16;
+
+auto ParseHex(string_view text, uint64_t& value) -> bool {
+  const auto* end = text.data() + text.size();
+  auto [ptr, ec] = std::from_chars(text.data(), end, value, 16);
+  return ec == std::errc{} && ptr == end && text.size() == kHashDigits;
+}
+
+auto ParseInt(string_view text, int& value) -> bool {
+  const auto* end = text.data() + text.size();
+  auto [ptr, ec] = std::from_chars(text.data(), end, value);
+  return ec == std::errc{} && ptr == end && value > 0;
+}
+
+auto AppendHex(string& out, uint64_t value) -> void {
+  constexpr string_view kHexDigits = "0123456789abcdef";
+  for (int shift = (kHashDigits - 1) * 4; shift >= 0; shift -= 4) {
+    out += kHexDigits[(value >> static_cast<unsigned>(shift)) & 0xFU];
+  }
+}
+
+// Reads a line, dropping the carriage return of CRLF line endings.
+auto GetLine(std::istream& stream, string& line) -> bool {
+  if (!std::getline(stream, line)) {
+    return false;
+  }
+  if (line.ends_with('\r')) {
+    line.pop_back();
+  }
+  return true;
+}
+
+// Splits the next space-separated field off the front of `line`.
+auto NextField(string_view& line) -> string_view {
+  const size_t end = std::min(line.find(' '), line.size());
+  const string_view field = line.substr(0, end);
+  line.remove_prefix(std::min(end + 1, line.size()));
+  return field;
+}
+
+}  // namespace
+
+auto FingerprintIndex::Load(const path& file) -> Expected<void> {
+  std::ifstream stream{file, std::ios::binary};
+  string line;
+  if (!stream || !GetLine(stream, line) || line != kHeader) {
+    cerr << "Failed to read fingerprint index " << file << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  for (int line_number = 2; GetLine(stream, line); ++line_number) {
+    if (line.empty()) {
+      continue;
+    }
+    string_view rest = line;
+    ImageFingerprint fingerprint{};
+    if (!ParseHex(NextField(rest), fingerprint.content_hash) ||
+        !ParseHex(NextField(rest), fingerprint.perceptual_hash) ||
+        !ParseInt(NextField(rest), fingerprint.width) ||
+        !ParseInt(NextField(rest), fingerprint.height) || rest.empty()) {
+      cerr << file << ':' << line_number << ": malformed entry\n";
+      return unexpected(MakeErrorCode(kFileIoError));
+    }
+    Insert(rest, fingerprint);
+  }
+  if (stream.bad()) {
+    cerr << "Failed to read fingerprint index " << file << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  return {};
+}
+
+auto FingerprintIndex::Insert(string_view key,
+                              const ImageFingerprint& fingerprint) -> void {
+  string normalized{key};
+  std::ranges::replace(normalized, '\n', ' ');
+  std::ranges::replace(normalized, '\r', ' ');
+
+  Erase(normalized);
+  by_content_.emplace(fingerprint.content_hash, normalized);
+  entries_.emplace(std::move(normalized), fingerprint);
+}
+
+auto FingerprintIndex::Erase(string_view key) -> bool {
+  const auto entry = entries_.find(key);
+  if (entry == entries_.end()) {
+    return false;
+  }
+  auto [first, last] = by_content_.equal_range(entry->second.content_hash);
+  for (; first != last; ++first) {
+    if (first->second == key) {
+      by_content_.erase(first);
+      break;
+    }
+  }
+  entries_.erase(entry);
+  return true;
+}
+
+auto FingerprintIndex::Find(string_view key) const
+    -> optional<ImageFingerprint> {
+  const auto entry = entries_.find(key);
+  if (entry == entries_.end()) {
+    return std::nullopt;
+  }
+  return entry->second;
+}
+
+auto FingerprintIndex::MatchesExactly(
+    string_view key, const ImageFingerprint& fingerprint) const -> bool {
+  const auto entry = entries_.find(key);
+  return entry != entries_.end() &&
+         entry->second.content_hash == fingerprint.content_hash &&
+         entry->second.width == fingerprint.width &&
+         entry->second.height == fingerprint.height;
+}
+
+auto FingerprintIndex::FindByContent(uint64_t content_hash) const
+    -> vector<string> {
+  vector<string> keys;
+  auto [first, last] = by_content_.equal_range(content_hash);
+  for (; first != last; ++first) {
+    keys.push_back(first->second);
+  }
+  std::ranges::sort(keys);
+  return keys;
+}
+
+auto FingerprintIndex::FindSimilar(uint64_t perceptual_hash,
+                                   int max_distance) const
+    -> vector<FingerprintMatch> {
+  vector<FingerprintMatch> matches;
+  for (const auto& [key, fingerprint] : entries_) {
+    const int distance =
+        HammingDistance(perceptual_hash, fingerprint.perceptual_hash);
+    if (distance <= max_distance) {
+      matches.push_back(
+          {.key = key, .fingerprint = fingerprint, .distance = distance});
+    }
+  }
+  // Entries are visited in key order, so ties stay sorted by key.
+  std::ranges::stable_sort(matches, {}, &FingerprintMatch::distance);
+  return matches;
+}
+
+auto FingerprintIndex::GetSize() const -> size_t { return entries_.size(); }
+
+auto FingerprintIndex::Save(const path& file) const -> Expected<void> {
+  string contents{kHeader};
+  contents += '\n';
+  for (const auto& [key, fingerprint] : entries_) {
+    AppendHex(contents, fingerprint.content_hash);
+    contents += ' ';
+    AppendHex(contents, fingerprint.perceptual_hash);
+    contents += ' ';
+    contents += std::to_string(fingerprint.width);
+    contents += ' ';
+    contents += std::to_string(fingerprint.height);
+    contents += ' ';
+    contents += key;
+    contents += '\n';
+  }
+
+  // Write beside the destination and rename, so readers never see a
+  // half-written index.
+  path temporary = file;
+  temporary += ".tmp";
+  {
+    std::ofstream stream{temporary, std::ios::binary | std::ios::trunc};
+    stream << contents;
+    stream.close();
+    if (!stream) {
+      cerr << "Failed to write fingerprint index " << temporary << '\n';
+      return unexpected(MakeErrorCode(kFileIoError));
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary, file, error);
+  if (error) {
+    cerr << "Failed to replace " << file << ": " << error.message() << '\n';
+    std::filesystem::remove(temporary, error);
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  return {};
+}
+
+auto CreateIFingerprintIndex() -> IFingerprintIndexPtr {
+  return std::make_unique<FingerprintIndex>();
+}
+
+auto LoadIFingerprintIndex(const path& file) -> Expected<IFingerprintIndexPtr> {
+  auto index = std::make_unique<FingerprintIndex>();
+  if (auto loaded = index->Load(file); !loaded) {
+    return unexpected(loaded.error());
+  }
+  return index;
+}
+
+}  // namespace graphics_engine::image_fingerprint
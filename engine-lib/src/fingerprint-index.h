@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_FINGERPRINT_INDEX_H_
+#define ENGINE_LIB_FINGERPRINT_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "graphics-engine/i-fingerprint-index.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::image_fingerprint {
+
+class FingerprintIndex : public IFingerprintIndex {
+ public:
+  ~FingerprintIndex() override = default;
+
+  // Reads entries saved by Save, adding them to this index.
+  [[nodiscard]] auto Load(const std::filesystem::path& file)
+      -> types::Expected<void>;
+
+  auto Insert(std::string_view key, const ImageFingerprint& fingerprint)
+      -> void override;
+  auto Erase(std::string_view key) -> bool override;
+
+  [[nodiscard]] auto Find(std::string_view key) const
+      -> std::optional<ImageFingerprint> override;
+  [[nodiscard]] auto MatchesExactly(std::string_view key,
+                                    const ImageFingerprint& fingerprint) const
+      -> bool override;
+  [[nodiscard]] auto FindByContent(std::uint64_t content_hash) const
+      -> std::vector<std::string> override;
+  [[nodiscard]] auto FindSimilar(std::uint64_t perceptual_hash,
+                                 int max_distance) const
+      -> std::vector<FingerprintMatch> override;
+
+  [[nodiscard]] auto GetSize() const -> std::size_t override;
+
+  [[nodiscard]] auto Save(const std::filesystem::path& file) const
+      -> types::Expected<void> override;
+
+ private:
+  // Ordered so saved indices diff cleanly.
+  std::map<std::string, ImageFingerprint, std::less<>> entries_;
+  // Content hash to the keys holding it.
+  std::unordered_multimap<std::uint64_t, std::string> by_content_;
+};
+
+}  // namespace graphics_engine::image_fingerprint
+
+#endif  // ENGINE_LIB_FINGERPRINT_INDEX_H_
@@ -0,0 +1,410 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "frame-recorder.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "error.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::byte;
+using std::cerr;
+using std::int64_t;
+using std::lock_guard;
+using std::size_t;
+using std::string_view;
+using std::uint64_t;
+using std::unexpected;
+using std::unique_lock;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::frame_recorder {
+
+namespace {
+
+constexpr int kChannels = 4;
+constexpr uint64_t kVersion = 1;
+constexpr uint64_t kFlagBottomUp = 1;
+constexpr size_t kHeaderSize = 32;
+constexpr size_t kIndexEntrySize = 24;
+constexpr size_t kFooterSize = 24;
+constexpr string_view kHeaderMagic = "GEFRAMES";
+constexpr string_view kFooterMagic = "GEINDEX1";
+
+auto AppendLittleEndian(vector<byte>& out, uint64_t value, size_t size)
+    -> void {
+  for (size_t i = 0; i < size; ++i) {
+    out.push_back(static_cast<byte>((value >> (8 * i)) & 0xFFU));
+  }
+}
+
+auto AppendMagic(vector<byte>& out, string_view magic) -> void {
+  for (const char c : magic) {
+    out.push_back(static_cast<byte>(c));
+  }
+}
+
+auto ReadLittleEndian(const byte* data, size_t size) -> uint64_t {
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value |= std::to_integer<uint64_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+auto HasMagic(const byte* data, string_view magic) -> bool {
+  return std::memcmp(data, magic.data(), magic.size()) == 0;
+}
+
+auto Write(std::ofstream& stream, const vector<byte>& data) -> bool {
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  stream.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+  return static_cast<bool>(stream);
+}
+
+}  // namespace
+
+FrameRecorder::~FrameRecorder() {
+  if (!finished_) {
+    (void)Finish();
+  }
+}
+
+auto FrameRecorder::Initialize(const path& file,
+                               const FrameRecorderOptions& options)
+    -> Expected<void> {
+  if (options.pool_size == 0 || options.readback_buffers == 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  array<GLint, 4> viewport{};
+  glGetIntegerv(GL_VIEWPORT, viewport.data());
+  width_ = viewport[2];
+  height_ = viewport[3];
+  if (width_ <= 0 || height_ <= 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+  frame_size_ = static_cast<size_t>(width_ * height_ * kChannels);
+
+  readbacks_.resize(options.readback_buffers);
+  for (size_t i = 0; i < readbacks_.size(); ++i) {
+    Expected<void> result = readbacks_[i].slot.Initialize(
+        static_cast<long long int>(frame_size_));
+    if (!result.has_value()) {
+      return result;
+    }
+    free_readbacks_.push_back(i);
+  }
+
+  stream_.open(file, std::ios::binary | std::ios::trunc);
+  vector<byte> header;
+  AppendMagic(header, kHeaderMagic);
+  AppendLittleEndian(header, kVersion, 4);
+  AppendLittleEndian(header, static_cast<uint64_t>(width_), 4);
+  AppendLittleEndian(header, static_cast<uint64_t>(height_), 4);
+  AppendLittleEndian(header, kChannels, 4);
+  AppendLittleEndian(header, kFlagBottomUp, 4);
+  AppendLittleEndian(header, 0, 4);
+  assert(header.size() == kHeaderSize);
+  if (!stream_ || !Write(stream_, header)) {
+    cerr << "Failed to create recording " << file << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  // Allocated up front so recording never allocates per frame.
+  pool_.resize(options.pool_size);
+  for (size_t i = 0; i < pool_.size(); ++i) {
+    pool_[i].resize(frame_size_);
+    free_buffers_.push_back(i);
+  }
+
+  start_ = std::chrono::steady_clock::now();
+  writer_ = std::thread([this]() { RunWriter(); });
+  return {};
+}
+
+auto FrameRecorder::CaptureFrame() -> Expected<void> {
+  if (finished_) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+  }
+
+  Expected<void> polled = Poll();
+  if (!polled.has_value()) {
+    return polled;
+  }
+
+  const uint64_t frame_number = next_frame_number_++;
+  array<GLint, 4> viewport{};
+  glGetIntegerv(GL_VIEWPORT, viewport.data());
+  const bool resized = viewport[2] != width_ || viewport[3] != height_;
+  {
+    lock_guard lock{mutex_};
+    ++stats_.frames_captured;
+    // Waiting for a buffer would stall the render loop on the GPU.
+    if (resized || free_readbacks_.empty()) {
+      ++stats_.frames_dropped;
+      return {};
+    }
+  }
+
+  const size_t index = free_readbacks_.front();
+  Readback& readback = readbacks_[index];
+  Expected<void> result = readback.slot.Issue(static_cast<int>(width_),
+                                              static_cast<int>(height_));
+  if (!result.has_value()) {
+    return result;
+  }
+
+  readback.frame_number = frame_number;
+  readback.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start_)
+                              .count();
+  free_readbacks_.pop_front();
+  in_flight_.push_back(index);
+  return {};
+}
+
+auto FrameRecorder::Resolve(bool block) -> Expected<bool> {
+  assert(!in_flight_.empty());
+  const size_t index = in_flight_.front();
+  Readback& readback = readbacks_[index];
+
+  Expected<bool> finished = readback.slot.Wait(block);
+  if (finished.has_value() && !*finished) {
+    return false;
+  }
+  in_flight_.pop_front();
+  free_readbacks_.push_back(index);
+  if (!finished.has_value()) {
+    return unexpected(finished.error());
+  }
+
+  size_t buffer = 0;
+  {
+    lock_guard lock{mutex_};
+    if (free_buffers_.empty()) {
+      // The writer has fallen behind.
+      ++stats_.frames_dropped;
+      return true;
+    }
+    buffer = free_buffers_.front();
+    free_buffers_.pop_front();
+  }
+
+  Expected<void> result = readback.slot.CopyTo(pool_[buffer]);
+
+  {
+    lock_guard lock{mutex_};
+    if (!result.has_value()) {
+      free_buffers_.push_back(buffer);
+      ++stats_.frames_dropped;
+      return unexpected(result.error());
+    }
+    jobs_.push_back({.buffer = buffer,
+                     .frame_number = readback.frame_number,
+                     .timestamp_ns = readback.timestamp_ns});
+  }
+  job_available_.notify_one();
+  return true;
+}
+
+auto FrameRecorder::Poll() -> Expected<void> {
+  while (!in_flight_.empty()) {
+    Expected<bool> resolved = Resolve(false);
+    if (!resolved.has_value()) {
+      return unexpected(resolved.error());
+    }
+    if (!*resolved) {
+      break;
+    }
+  }
+
+  return {};
+}
+
+auto FrameRecorder::Finish() -> Expected<FrameRecorderStats> {
+  if (finished_) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+  }
+  finished_ = true;
+
+  Expected<void> result{};
+  while (!in_flight_.empty() && result.has_value()) {
+    Expected<bool> resolved = Resolve(true);
+    if (!resolved.has_value()) {
+      result = unexpected(resolved.error());
+    }
+  }
+
+  {
+    lock_guard lock{mutex_};
+    stopping_ = true;
+  }
+  job_available_.notify_one();
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+
+  // The writer has exited, so its state may be used here.
+  const auto index_offset = static_cast<uint64_t>(stream_.tellp());
+  vector<byte> index;
+  index.reserve((index_.size() * kIndexEntrySize) + kFooterSize);
+  for (const RecordedFrame& frame : index_) {
+    AppendLittleEndian(index, frame.frame_number, 8);
+    AppendLittleEndian(index, frame.offset, 8);
+    AppendLittleEndian(index, static_cast<uint64_t>(frame.timestamp_ns), 8);
+  }
+  AppendLittleEndian(index, index_offset, 8);
+  AppendLittleEndian(index, index_.size(), 8);
+  AppendMagic(index, kFooterMagic);
+  const bool written = Write(stream_, index);
+  stream_.close();
+
+  if (!result.has_value()) {
+    return unexpected(result.error());
+  }
+  if (write_error_ || !written || !stream_) {
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  return GetStats();
+}
+
+auto FrameRecorder::GetStats() const -> FrameRecorderStats {
+  lock_guard lock{mutex_};
+  return stats_;
+}
+
+auto FrameRecorder::RunWriter() -> void {
+  uint64_t offset = kHeaderSize;
+  while (true) {
+    WriteJob job;
+    {
+      unique_lock lock{mutex_};
+      job_available_.wait(lock,
+                          [this]() { return stopping_ || !jobs_.empty(); });
+      if (jobs_.empty()) {
+        return;  // Stopping and nothing left to write.
+      }
+      job = jobs_.front();
+      jobs_.pop_front();
+    }
+
+    // Frames go to disk back to back, so the file is written sequentially.
+    const bool written = !write_error_ && Write(stream_, pool_[job.buffer]);
+    if (written) {
+      index_.push_back({.frame_number = job.frame_number,
+                        .offset = offset,
+                        .timestamp_ns = job.timestamp_ns});
+      offset += frame_size_;
+    }
+
+    lock_guard lock{mutex_};
+    free_buffers_.push_back(job.buffer);
+    if (written) {
+      ++stats_.frames_written;
+      stats_.bytes_written += frame_size_;
+    } else {
+      if (!write_error_) {
+        cerr << "Failed to write frame " << job.frame_number << '\n';
+        write_error_ = MakeErrorCode(kFileIoError);
+      }
+      ++stats_.frames_dropped;
+    }
+  }
+}
+
+auto CreateIFrameRecorder(const path& file, const FrameRecorderOptions& options)
+    -> Expected<IFrameRecorderPtr> {
+  auto recorder = std::make_unique<FrameRecorder>();
+  Expected<void> result = recorder->Initialize(file, options);
+  if (!result.has_value()) {
+    cerr << "Frame recorder initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+
+  return recorder;
+}
+
+auto ReadRecordingIndex(const path& file) -> Expected<RecordingIndex> {
+  std::ifstream stream(file, std::ios::binary | std::ios::ate);
+  if (!stream) {
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  const auto size = static_cast<uint64_t>(stream.tellg());
+  if (size < kHeaderSize + kFooterSize) {
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  auto read = [&stream](uint64_t offset, size_t count) -> vector<byte> {
+    vector<byte> data(count);
+    stream.seekg(static_cast<std::streamoff>(offset));
+    // NOLINTNEXTLINE(*-reinterpret-cast)
+    stream.read(reinterpret_cast<char*>(data.data()),
+                static_cast<std::streamsize>(count));
+    return data;
+  };
+
+  const vector<byte> header = read(0, kHeaderSize);
+  const vector<byte> footer = read(size - kFooterSize, kFooterSize);
+  if (!stream || !HasMagic(header.data(), kHeaderMagic) ||
+      ReadLittleEndian(&header[8], 4) != kVersion ||
+      !HasMagic(&footer[16], kFooterMagic)) {
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  RecordingIndex index;
+  index.width = static_cast<int>(ReadLittleEndian(&header[12], 4));
+  index.height = static_cast<int>(ReadLittleEndian(&header[16], 4));
+  index.channels = static_cast<int>(ReadLittleEndian(&header[20], 4));
+  index.bottom_up = (ReadLittleEndian(&header[24], 4) & kFlagBottomUp) != 0;
+
+  const uint64_t index_offset = ReadLittleEndian(footer.data(), 8);
+  const uint64_t frame_count = ReadLittleEndian(&footer[8], 8);
+  // The entries must fill the space between the frames and the footer
+  // exactly. Bounding frame_count first keeps the product from overflowing.
+  const uint64_t index_end = size - kFooterSize;
+  if (index_offset < kHeaderSize || index_offset > index_end ||
+      frame_count > (index_end - index_offset) / kIndexEntrySize ||
+      index_offset + (frame_count * kIndexEntrySize) != index_end) {
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  const vector<byte> entries =
+      read(index_offset, static_cast<size_t>(frame_count) * kIndexEntrySize);
+  if (!stream) {
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  index.frames.reserve(static_cast<size_t>(frame_count));
+  for (size_t i = 0; i < frame_count; ++i) {
+    const byte* entry = &entries[i * kIndexEntrySize];
+    index.frames.push_back(
+        {.frame_number = ReadLittleEndian(entry, 8),
+         .offset = ReadLittleEndian(entry + 8, 8),
+         .timestamp_ns =
+             static_cast<int64_t>(ReadLittleEndian(entry + 16, 8))});
+  }
+
+  return index;
+}
+
+}  // namespace graphics_engine::frame_recorder
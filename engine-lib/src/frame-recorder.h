@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_FRAME_RECORDER_H_
+#define ENGINE_LIB_FRAME_RECORDER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "graphics-engine/i-frame-recorder.h"
+#include "graphics-engine/types.h"
+#include "readback-slot.h"
+
+namespace graphics_engine::frame_recorder {
+
+class FrameRecorder : public IFrameRecorder {
+ public:
+  FrameRecorder() = default;
+  ~FrameRecorder() override;
+
+  FrameRecorder(const FrameRecorder&) = delete;
+  FrameRecorder(FrameRecorder&&) = delete;
+  auto operator=(const FrameRecorder&) -> FrameRecorder& = delete;
+  auto operator=(FrameRecorder&&) -> FrameRecorder& = delete;
+
+  [[nodiscard]] auto Initialize(const std::filesystem::path& file,
+                                const FrameRecorderOptions& options)
+      -> types::Expected<void>;
+
+  [[nodiscard]] auto CaptureFrame() -> types::Expected<void> override;
+  [[nodiscard]] auto Poll() -> types::Expected<void> override;
+  [[nodiscard]] auto Finish() -> types::Expected<FrameRecorderStats> override;
+
+  [[nodiscard]] auto GetStats() const -> FrameRecorderStats override;
+
+ private:
+  // A readback and the frame being read into it, if any.
+  struct Readback {
+    readback_slot::ReadbackSlot slot;
+    std::uint64_t frame_number{};
+    std::int64_t timestamp_ns{};
+  };
+
+  // A filled pool buffer waiting for the writer.
+  struct WriteJob {
+    std::size_t buffer{};
+    std::uint64_t frame_number{};
+    std::int64_t timestamp_ns{};
+  };
+
+  // Hand the oldest pending read to the writer. Returns false if it is still
+  // running and `block` is false.
+  [[nodiscard]] auto Resolve(bool block) -> types::Expected<bool>;
+
+  auto RunWriter() -> void;
+
+  std::int64_t width_{};
+  std::int64_t height_{};
+  std::size_t frame_size_{};
+  std::chrono::steady_clock::time_point start_;
+  std::uint64_t next_frame_number_{};
+  bool finished_{};
+
+  // Render thread only.
+  std::vector<Readback> readbacks_;
+  std::deque<std::size_t> in_flight_;  // Readback indices, oldest first.
+  std::deque<std::size_t> free_readbacks_;
+
+  // Writer thread only, until it has been joined.
+  std::ofstream stream_;
+  std::vector<RecordedFrame> index_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable job_available_;
+  std::vector<std::vector<std::byte>> pool_;
+  std::deque<std::size_t> free_buffers_;
+  std::deque<WriteJob> jobs_;
+  FrameRecorderStats stats_;
+  std::error_code write_error_;
+  bool stopping_{};
+
+  std::thread writer_;
+};
+
+}  // namespace graphics_engine::frame_recorder
+
+#endif  // ENGINE_LIB_FRAME_RECORDER_H_
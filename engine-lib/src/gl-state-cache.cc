@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "gl-state-cache.h"
+
+#include <algorithm>
+#include <cassert>
+
+using graphics_engine::gl_types::GLBufferTarget;
+using graphics_engine::gl_wrappers::StateCacheStats;
+
+using std::optional;
+using std::span;
+using std::to_underlying;
+
+namespace graphics_engine::gl_state_cache {
+
+template <typename T>
+auto GLStateCache::Update(optional<T>& cached, const T& value) -> bool {
+  if (cached == value) {
+    ++stats_.skipped;
+    return false;
+  }
+
+  cached = value;
+  ++stats_.issued;
+  return true;
+}
+
+auto GLStateCache::ShouldBindBuffer(GLBufferTarget target, unsigned int buffer)
+    -> bool {
+  assert(to_underlying(target) < kNumBufferTargets);
+  return Update(buffers_.at(to_underlying(target)), buffer);
+}
+
+auto GLStateCache::ShouldBindVertexArray(unsigned int array) -> bool {
+  if (!Update(vertex_array_, array)) {
+    return false;
+  }
+
+  // The element array binding is part of the vertex array object's state.
+  ForgetBuffer(GLBufferTarget::kElementArray);
+  return true;
+}
+
+auto GLStateCache::ShouldSetClearColor(const ClearColor& color) -> bool {
+  return Update(clear_color_, color);
+}
+
+auto GLStateCache::ShouldUseProgram(unsigned int program) -> bool {
+  return Update(program_, program);
+}
+
+auto GLStateCache::ForgetBuffer(GLBufferTarget target) -> void {
+  assert(to_underlying(target) < kNumBufferTargets);
+  buffers_.at(to_underlying(target)).reset();
+}
+
+auto GLStateCache::ForgetProgram() -> void { program_.reset(); }
+
+auto GLStateCache::ForgetVertexArray() -> void {
+  vertex_array_.reset();
+  ForgetBuffer(GLBufferTarget::kElementArray);
+}
+
+auto GLStateCache::OnBuffersDeleted(span<const unsigned int> buffers) -> void {
+  for (optional<unsigned int>& bound : buffers_) {
+    if (bound.has_value() && *bound != 0 &&
+        std::ranges::find(buffers, *bound) != buffers.end()) {
+      bound = 0U;
+    }
+  }
+}
+
+auto GLStateCache::OnVertexArraysDeleted(span<const unsigned int> arrays)
+    -> void {
+  if (vertex_array_.has_value() && *vertex_array_ != 0 &&
+      std::ranges::find(arrays, *vertex_array_) != arrays.end()) {
+    vertex_array_ = 0U;
+    ForgetBuffer(GLBufferTarget::kElementArray);
+  }
+}
+
+auto GLStateCache::Invalidate() -> void {
+  buffers_.fill(std::nullopt);
+  clear_color_.reset();
+  program_.reset();
+  vertex_array_.reset();
+}
+
+auto GLStateCache::GetStats() const -> StateCacheStats { return stats_; }
+
+auto GLStateCache::ResetStats() -> void { stats_ = {}; }
+
+auto GetGLStateCache() -> GLStateCache& {
+  static GLStateCache instance;
+  return instance;
+}
+
+}  // namespace graphics_engine::gl_state_cache
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_GL_STATE_CACHE_H_
+#define ENGINE_LIB_GL_STATE_CACHE_H_
+
+#include <array>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "graphics-engine/gl-types.h"
+#include "graphics-engine/gl-wrappers.h"
+
+namespace graphics_engine::gl_state_cache {
+
+// Shadow copy of the GL binding state that the wrappers touch. Each Should*
+// function returns true when the call has to reach GL (the value differs from
+// the cached one or is unknown) and records the new value; false means the
+// call would be redundant and can be skipped.
+class GLStateCache {
+ public:
+  using ClearColor = std::array<float, 4>;
+
+  [[nodiscard]] auto ShouldBindBuffer(gl_types::GLBufferTarget target,
+                                      unsigned int buffer) -> bool;
+  [[nodiscard]] auto ShouldBindVertexArray(unsigned int array) -> bool;
+  [[nodiscard]] auto ShouldSetClearColor(const ClearColor& color) -> bool;
+  [[nodiscard]] auto ShouldUseProgram(unsigned int program) -> bool;
+
+  // Forget individual bindings, e.g. after the GL call that set them failed.
+  auto ForgetBuffer(gl_types::GLBufferTarget target) -> void;
+  auto ForgetProgram() -> void;
+  auto ForgetVertexArray() -> void;
+
+  // Deleting a bound buffer reverts its bindings to 0.
+  auto OnBuffersDeleted(std::span<const unsigned int> buffers) -> void;
+  // Deleting the bound vertex array reverts the binding to 0.
+  auto OnVertexArraysDeleted(std::span<const unsigned int> arrays) -> void;
+
+  // Forget everything; the next call of each kind is issued.
+  auto Invalidate() -> void;
+
+  [[nodiscard]] auto GetStats() const -> gl_wrappers::StateCacheStats;
+  auto ResetStats() -> void;
+
+ private:
+  static constexpr std::size_t kNumBufferTargets =
+      std::to_underlying(gl_types::GLBufferTarget::kNumTargets);
+
+  template <typename T>
+  auto Update(std::optional<T>& cached, const T& value) -> bool;
+
+  std::array<std::optional<unsigned int>, kNumBufferTargets> buffers_;
+  std::optional<ClearColor> clear_color_;
+  std::optional<unsigned int> program_;
+  std::optional<unsigned int> vertex_array_;
+  gl_wrappers::StateCacheStats stats_;
+};
+
+// The cache for the current GL context.
+auto GetGLStateCache() -> GLStateCache&;
+
+}  // namespace graphics_engine::gl_state_cache
+
+#endif  // ENGINE_LIB_GL_STATE_CACHE_H_
@@ -5,11 +5,16 @@
 #include "graphics-engine/gl-wrappers.h"
 
 #include <cassert>
+#include <cstdint>
 #include <iostream>
+#include <span>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 
+#include "buffer-offset.h"
 #include "error.h"
+#include "gl-state-cache.h"
 #include "glad/glad.h"
 #include "graphics-engine/gl-types.h"
 #include "graphics-engine/types.h"
@@ -23,18 +28,27 @@ using enum graphics_engine::gl_types::GLDrawMode;
 using enum graphics_engine::gl_types::GLShaderObjectParameter;
 using enum graphics_engine::gl_types::GLShaderType;
 
+using graphics_engine::buffer_offset::OffsetToPointer;
+using graphics_engine::error::CheckDeferredGLErrors;
+using graphics_engine::error::GetGLErrorPolicy;
 using graphics_engine::error::MakeErrorCode;
+using graphics_engine::error::PollGLError;
+using graphics_engine::error::SetGLErrorPolicy;
 using graphics_engine::gl_clear_flags::IGLClearFlags;
+using graphics_engine::gl_state_cache::GetGLStateCache;
 using graphics_engine::gl_types::GLBufferTarget;
 using graphics_engine::gl_types::GLDataType;
 using graphics_engine::gl_types::GLDataUsagePattern;
 using graphics_engine::gl_types::GLDrawMode;
+using graphics_engine::gl_types::GLErrorPolicy;
 using graphics_engine::gl_types::GLShaderObjectParameter;
 using graphics_engine::gl_types::GLShaderType;
 using graphics_engine::types::Expected;
 
 using std::cerr;
 using std::is_same_v;
+using std::span;
+using std::string_view;
 using std::to_underlying;
 using std::unexpected;
 
@@ -75,6 +89,8 @@ auto ConvertGLBufferTarget(GLBufferTarget target) -> GLenum {
       return GL_COPY_READ_BUFFER;
     case kCopyWrite:
       return GL_COPY_WRITE_BUFFER;
+    case kDrawIndirect:
+      return GL_DRAW_INDIRECT_BUFFER;
     case kElementArray:
       return GL_ELEMENT_ARRAY_BUFFER;
     case kPixelPack:
@@ -214,7 +230,7 @@ auto ConvertGLShaderType(GLShaderType shader_type) -> GLenum {
 
 auto AttachShader(unsigned int program, unsigned int shader) -> Expected<void> {
   glAttachShader(program, shader);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glAttachShader"); error != GL_NO_ERROR) {
     cerr << "glAttachShader failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -231,9 +247,14 @@ auto AttachShader(unsigned int program, unsigned int shader) -> Expected<void> {
 }
 
 auto BindBuffer(GLBufferTarget target, unsigned int buffer) -> Expected<void> {
+  if (!GetGLStateCache().ShouldBindBuffer(target, buffer)) {
+    return {};
+  }
+
   GLenum gl_target = ConvertGLBufferTarget(target);
   glBindBuffer(gl_target, buffer);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glBindBuffer"); error != GL_NO_ERROR) {
+    GetGLStateCache().ForgetBuffer(target);
     cerr << "glBindBuffer failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -250,8 +271,13 @@ auto BindBuffer(GLBufferTarget target, unsigned int buffer) -> Expected<void> {
 }
 
 auto BindVertexArray(unsigned int array) -> Expected<void> {
+  if (!GetGLStateCache().ShouldBindVertexArray(array)) {
+    return {};
+  }
+
   glBindVertexArray(array);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glBindVertexArray"); error != GL_NO_ERROR) {
+    GetGLStateCache().ForgetVertexArray();
     cerr << "glBindVertexArray failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -270,7 +296,7 @@ auto BufferData(GLBufferTarget target, long long int size, const void* data,
   GLenum gl_target = ConvertGLBufferTarget(target);
   GLenum gl_usage = ConvertGLDataUsagePattern(usage);
   glBufferData(gl_target, size, data, gl_usage);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glBufferData"); error != GL_NO_ERROR) {
     cerr << "glBufferData failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -290,6 +316,39 @@ auto BufferData(GLBufferTarget target, long long int size, const void* data,
   return {};
 }
 
+auto BufferSubData(GLBufferTarget target, long long int offset,
+                   long long int size, const void* data) -> Expected<void> {
+  GLenum gl_target = ConvertGLBufferTarget(target);
+  glBufferSubData(gl_target, offset, size, data);
+  if (GLenum error = PollGLError("glBufferSubData"); error != GL_NO_ERROR) {
+    cerr << "glBufferSubData failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
+auto CheckDeferredErrors(string_view scope) -> Expected<void> {
+  Expected<void> result = CheckDeferredGLErrors(scope);
+  if (!result.has_value()) {
+    // Any call since the last check may have failed, so the cached state can
+    // no longer be trusted.
+    GetGLStateCache().Invalidate();
+  }
+
+  return result;
+}
+
 auto Clear(const IGLClearFlags& flags) -> types::Expected<void> {
   GLbitfield mask = 0;
   if (flags.Test(kColor)) {
@@ -302,7 +361,7 @@ auto Clear(const IGLClearFlags& flags) -> types::Expected<void> {
     mask |= GL_STENCIL_BUFFER_BIT;
   }
   glClear(mask);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glClear"); error != GL_NO_ERROR) {
     cerr << "glClear failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -318,7 +377,7 @@ auto Clear(const IGLClearFlags& flags) -> types::Expected<void> {
 
 auto CompileShader(unsigned int shader) -> Expected<void> {
   glCompileShader(shader);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glCompileShader"); error != GL_NO_ERROR) {
     cerr << "glCompileShader failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -334,6 +393,32 @@ auto CompileShader(unsigned int shader) -> Expected<void> {
   return {};
 }
 
+auto CopyBufferSubData(GLBufferTarget read_target, GLBufferTarget write_target,
+                       long long int read_offset, long long int write_offset,
+                       long long int size) -> Expected<void> {
+  GLenum gl_read_target = ConvertGLBufferTarget(read_target);
+  GLenum gl_write_target = ConvertGLBufferTarget(write_target);
+  glCopyBufferSubData(gl_read_target, gl_write_target, read_offset,
+                      write_offset, size);
+  if (GLenum error = PollGLError("glCopyBufferSubData");
+      error != GL_NO_ERROR) {
+    cerr << "glCopyBufferSubData failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
 auto CreateProgram() -> Expected<unsigned int> {
   GLuint program_id = glCreateProgram();
   if (program_id == 0) {
@@ -347,7 +432,7 @@ auto CreateProgram() -> Expected<unsigned int> {
 auto CreateShader(GLShaderType shader_type) -> Expected<unsigned int> {
   GLenum gl_shader_type = ConvertGLShaderType(shader_type);
   GLuint shader = glCreateShader(gl_shader_type);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glCreateShader"); error != GL_NO_ERROR) {
     cerr << "glCreateShader failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -362,10 +447,47 @@ auto CreateShader(GLShaderType shader_type) -> Expected<unsigned int> {
   return shader;
 }
 
+auto DeleteBuffers(int n, const unsigned int* buffers) -> Expected<void> {
+  glDeleteBuffers(n, buffers);
+  if (GLenum error = PollGLError("glDeleteBuffers"); error != GL_NO_ERROR) {
+    cerr << "glDeleteBuffers failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  GetGLStateCache().OnBuffersDeleted(
+      span<const unsigned int>(buffers, static_cast<size_t>(n)));
+  return {};
+}
+
+auto DeleteVertexArrays(int n, const unsigned int* arrays) -> Expected<void> {
+  glDeleteVertexArrays(n, arrays);
+  if (GLenum error = PollGLError("glDeleteVertexArrays");
+      error != GL_NO_ERROR) {
+    cerr << "glDeleteVertexArrays failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  GetGLStateCache().OnVertexArraysDeleted(
+      span<const unsigned int>(arrays, static_cast<size_t>(n)));
+  return {};
+}
+
 auto DrawArrays(GLDrawMode mode, int first, int count) -> Expected<void> {
   GLenum gl_mode = ConvertGLDrawMode(mode);
   glDrawArrays(gl_mode, first, count);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glDrawArrays"); error != GL_NO_ERROR) {
     cerr << "glDrawArrays failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -383,9 +505,110 @@ auto DrawArrays(GLDrawMode mode, int first, int count) -> Expected<void> {
   return {};
 }
 
+auto DrawArraysInstanced(GLDrawMode mode, int first, int count,
+                         int instance_count) -> Expected<void> {
+  GLenum gl_mode = ConvertGLDrawMode(mode);
+  glDrawArraysInstanced(gl_mode, first, count, instance_count);
+  if (GLenum error = PollGLError("glDrawArraysInstanced");
+      error != GL_NO_ERROR) {
+    cerr << "glDrawArraysInstanced failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
+auto DrawElements(GLDrawMode mode, int count, GLDataType type,
+                  long long int index_offset) -> Expected<void> {
+  GLenum gl_mode = ConvertGLDrawMode(mode);
+  GLenum gl_type = ConvertGLDataType(type);
+  glDrawElements(gl_mode, count, gl_type, OffsetToPointer(index_offset));
+  if (GLenum error = PollGLError("glDrawElements"); error != GL_NO_ERROR) {
+    cerr << "glDrawElements failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
+auto DrawElementsBaseVertex(GLDrawMode mode, int count, GLDataType type,
+                            long long int index_offset, int base_vertex)
+    -> Expected<void> {
+  GLenum gl_mode = ConvertGLDrawMode(mode);
+  GLenum gl_type = ConvertGLDataType(type);
+  glDrawElementsBaseVertex(gl_mode, count, gl_type,
+                           OffsetToPointer(index_offset), base_vertex);
+  if (GLenum error = PollGLError("glDrawElementsBaseVertex");
+      error != GL_NO_ERROR) {
+    cerr << "glDrawElementsBaseVertex failed with error code " << error
+         << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
+auto DrawElementsInstanced(GLDrawMode mode, int count, GLDataType type,
+                           long long int index_offset, int instance_count)
+    -> Expected<void> {
+  GLenum gl_mode = ConvertGLDrawMode(mode);
+  GLenum gl_type = ConvertGLDataType(type);
+  glDrawElementsInstanced(gl_mode, count, gl_type,
+                          OffsetToPointer(index_offset), instance_count);
+  if (GLenum error = PollGLError("glDrawElementsInstanced");
+      error != GL_NO_ERROR) {
+    cerr << "glDrawElementsInstanced failed with error code " << error
+         << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
 auto EnableVertexAttribArray(unsigned int index) -> Expected<void> {
   glEnableVertexAttribArray(index);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glEnableVertexAttribArray");
+      error != GL_NO_ERROR) {
     cerr << "glEnableVertexAttribArray failed with error code " << error
          << '\n';
     switch (error) {
@@ -404,7 +627,7 @@ auto EnableVertexAttribArray(unsigned int index) -> Expected<void> {
 
 auto GenBuffers(int n, unsigned int* buffers) -> Expected<void> {
   glGenBuffers(n, buffers);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glGenBuffers"); error != GL_NO_ERROR) {
     cerr << "glGenBuffers failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -420,7 +643,7 @@ auto GenBuffers(int n, unsigned int* buffers) -> Expected<void> {
 
 auto GenVertexArrays(int n, unsigned int* arrays) -> Expected<void> {
   glGenVertexArrays(n, arrays);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glGenVertexArrays"); error != GL_NO_ERROR) {
     cerr << "glGenVertexArrays failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -434,12 +657,14 @@ auto GenVertexArrays(int n, unsigned int* arrays) -> Expected<void> {
   return {};
 }
 
+auto GetErrorPolicy() -> GLErrorPolicy { return GetGLErrorPolicy(); }
+
 DLLEXPORT [[nodiscard]] auto GetShaderInfoLog(unsigned int shader,
                                               int max_length, int* length,
                                               char* info_log)
     -> types::Expected<void> {
   glGetShaderInfoLog(shader, max_length, length, info_log);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glGetShaderInfoLog"); error != GL_NO_ERROR) {
     cerr << "glGetShaderInfoLog failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -460,7 +685,7 @@ DLLEXPORT [[nodiscard]] auto GetShaderiv(
     -> types::Expected<void> {
   GLenum gl_pname = ConvertGLShaderObjectParameter(pname);
   glGetShaderiv(shader, gl_pname, params);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glGetShaderiv"); error != GL_NO_ERROR) {
     cerr << "glGetShaderiv failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -478,9 +703,15 @@ DLLEXPORT [[nodiscard]] auto GetShaderiv(
   return {};
 }
 
+auto GetStateCacheStats() -> StateCacheStats {
+  return GetGLStateCache().GetStats();
+}
+
+auto InvalidateStateCache() -> void { GetGLStateCache().Invalidate(); }
+
 auto LinkProgram(unsigned int program) -> types::Expected<void> {
   glLinkProgram(program);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glLinkProgram"); error != GL_NO_ERROR) {
     cerr << "glLinkProgram failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -496,10 +727,78 @@ auto LinkProgram(unsigned int program) -> types::Expected<void> {
   return {};
 }
 
+auto MultiDrawArraysIndirect(GLDrawMode mode, long long int indirect_offset,
+                             int draw_count, int stride) -> Expected<void> {
+  if (GLAD_GL_ARB_multi_draw_indirect == 0) {
+    cerr << "glMultiDrawArraysIndirect requires GL_ARB_multi_draw_indirect\n";
+    return unexpected(MakeErrorCode(kGLExtensionUnavailable));
+  }
+
+  GLenum gl_mode = ConvertGLDrawMode(mode);
+  glMultiDrawArraysIndirect(gl_mode, OffsetToPointer(indirect_offset),
+                            draw_count, stride);
+  if (GLenum error = PollGLError("glMultiDrawArraysIndirect");
+      error != GL_NO_ERROR) {
+    cerr << "glMultiDrawArraysIndirect failed with error code " << error
+         << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
+auto MultiDrawElementsIndirect(GLDrawMode mode, GLDataType type,
+                               long long int indirect_offset, int draw_count,
+                               int stride) -> Expected<void> {
+  if (GLAD_GL_ARB_multi_draw_indirect == 0) {
+    cerr << "glMultiDrawElementsIndirect requires "
+            "GL_ARB_multi_draw_indirect\n";
+    return unexpected(MakeErrorCode(kGLExtensionUnavailable));
+  }
+
+  GLenum gl_mode = ConvertGLDrawMode(mode);
+  GLenum gl_type = ConvertGLDataType(type);
+  glMultiDrawElementsIndirect(gl_mode, gl_type,
+                              OffsetToPointer(indirect_offset), draw_count,
+                              stride);
+  if (GLenum error = PollGLError("glMultiDrawElementsIndirect");
+      error != GL_NO_ERROR) {
+    cerr << "glMultiDrawElementsIndirect failed with error code " << error
+         << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
+auto ResetStateCacheStats() -> void { GetGLStateCache().ResetStats(); }
+
+auto SetErrorPolicy(GLErrorPolicy policy) -> void { SetGLErrorPolicy(policy); }
+
 auto ShaderSource(unsigned int shader, int count, const char** string,
                   const int* length) -> Expected<void> {
   glShaderSource(shader, count, string, length);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glShaderSource"); error != GL_NO_ERROR) {
     cerr << "glShaderSource failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -516,8 +815,13 @@ auto ShaderSource(unsigned int shader, int count, const char** string,
 }
 
 auto UseProgram(unsigned int program) -> Expected<void> {
+  if (!GetGLStateCache().ShouldUseProgram(program)) {
+    return {};
+  }
+
   glUseProgram(program);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glUseProgram"); error != GL_NO_ERROR) {
+    GetGLStateCache().ForgetProgram();
     cerr << "glUseProgram failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -533,12 +837,33 @@ auto UseProgram(unsigned int program) -> Expected<void> {
   return {};
 }
 
+auto VertexAttribDivisor(unsigned int index, unsigned int divisor)
+    -> Expected<void> {
+  glVertexAttribDivisor(index, divisor);
+  if (GLenum error = PollGLError("glVertexAttribDivisor");
+      error != GL_NO_ERROR) {
+    cerr << "glVertexAttribDivisor failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+
+  return {};
+}
+
 auto VertexAttribPointer(unsigned int index, int size, GLDataType type,
                          unsigned char normalized, int stride,
                          const void* pointer) -> Expected<void> {
   GLenum gl_type = ConvertGLDataType(type);
   glVertexAttribPointer(index, size, gl_type, normalized, stride, pointer);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glVertexAttribPointer");
+      error != GL_NO_ERROR) {
     cerr << "glVertexAttribPointer failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -0,0 +1,524 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "graphics-engine/golden-runner.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "error.h"
+#include "glad/glad.h"
+#include "graphics-engine/i-async-capture.h"
+#include "graphics-engine/image-fingerprint.h"
+#include "graphics-engine/image.h"
+#include "image-codec.h"
+#include "offscreen-target.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::async_capture::CaptureFuture;
+using graphics_engine::async_capture::CreateIAsyncCapture;
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::image::CompareImages;
+using graphics_engine::image::CompareOptions;
+using graphics_engine::image::ImageView;
+using graphics_engine::image_fingerprint::ComputeFingerprint;
+using graphics_engine::image_fingerprint::IFingerprintIndex;
+using graphics_engine::image_codec::WriteImage;
+using graphics_engine::offscreen_target::OffscreenTarget;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::cerr;
+using std::ifstream;
+using std::lock_guard;
+using std::mutex;
+using std::ofstream;
+using std::ostream;
+using std::pair;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::unexpected;
+using std::unique_lock;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::golden_runner {
+
+namespace {
+
+constexpr int kChannels = 4;
+
+using Clock = std::chrono::steady_clock;
+
+auto SecondsSince(Clock::time_point start) -> double {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+auto ParseInt(string_view text, int& value) -> bool {
+  const auto* end = text.data() + text.size();
+  auto [ptr, ec] = std::from_chars(text.data(), end, value);
+  return ec == std::errc{} && ptr == end;
+}
+
+// Parses one field after the scene and reference into `golden_case`.
+auto ParseField(string_view field, GoldenCase& golden_case) -> bool {
+  constexpr string_view kTolerance = "tolerance=";
+  constexpr string_view kName = "name=";
+
+  if (field.starts_with(kTolerance)) {
+    int tolerance = 0;
+    if (!ParseInt(field.substr(kTolerance.size()), tolerance) ||
+        tolerance < 0 || tolerance > 255) {
+      return false;
+    }
+    golden_case.tolerance = static_cast<std::uint8_t>(tolerance);
+    return true;
+  }
+  if (field.starts_with(kName)) {
+    golden_case.name = field.substr(kName.size());
+    return !golden_case.name.empty();
+  }
+
+  const size_t x = field.find('x');
+  if (x == string_view::npos) {
+    return false;
+  }
+  int width = 0;
+  int height = 0;
+  if (!ParseInt(field.substr(0, x), width) ||
+      !ParseInt(field.substr(x + 1), height) || width <= 0 || height <= 0) {
+    return false;
+  }
+  golden_case.width = width;
+  golden_case.height = height;
+  return true;
+}
+
+// Compares one rendered frame with its reference, writing the frame and a
+// heatmap to the output directory if they differ. Runs on a worker thread.
+auto Compare(CaptureFuture frame_future, const GoldenRunOptions& options,
+             GoldenResult& result) -> void {
+  const auto start = Clock::now();
+  const GoldenCase& golden_case = result.golden_case;
+
+  auto frame = frame_future.get();
+  if (!frame) {
+    result.failure = "readback failed: " + frame.error().message();
+    result.seconds = SecondsSince(start);
+    return;
+  }
+
+  const ImageView view{.width = frame->width,
+                       .height = frame->height,
+                       .channels = kChannels,
+                       .pixels = frame->pixels,
+                       .bottom_up = true};
+
+  if (const IFingerprintIndex* fingerprints = options.fingerprints) {
+    auto fingerprint = ComputeFingerprint(view);
+    if (fingerprint && fingerprints->MatchesExactly(
+                           golden_case.reference.generic_string(),
+                           *fingerprint)) {
+      result.passed = true;
+      result.seconds = SecondsSince(start);
+      return;
+    }
+  }
+
+  // Only failures pay for the heatmap's full pass.
+  const path diff = options.output_dir / (golden_case.name + "-diff.png");
+  CompareOptions compare_options{.heatmap = diff,
+                                 .heatmap_only_on_mismatch = true};
+  compare_options.tolerance.fill(golden_case.tolerance);
+
+  auto compared = CompareImages(view, golden_case.reference, compare_options);
+  if (compared && !compared->Matches() && compared->same_dimensions) {
+    result.diff = diff;
+  }
+  if (!compared) {
+    result.failure = "comparison failed: " + compared.error().message();
+    result.seconds = SecondsSince(start);
+    return;
+  }
+
+  result.mismatch_count = compared->mismatch_count;
+  result.passed = compared->Matches();
+  if (!result.passed) {
+    result.failure = compared->same_dimensions
+                         ? std::to_string(compared->mismatch_count) +
+                               " pixels differ from the reference"
+                         : "size differs from the reference";
+    const path actual =
+        options.output_dir / (golden_case.name + "-actual.png");
+    if (WriteImage(actual, view, {})) {
+      result.actual = actual;
+    }
+  }
+  result.seconds = SecondsSince(start);
+}
+
+// Runs Compare for queued frames on a fixed set of threads.
+class ComparePool {
+ public:
+  ComparePool(size_t worker_count, const GoldenRunOptions& options,
+              vector<GoldenResult>& results)
+      : options_{options}, results_{results} {
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+      workers_.emplace_back([this]() { RunWorker(); });
+    }
+  }
+
+  // Waits for every queued comparison.
+  ~ComparePool() {
+    {
+      lock_guard lock{mutex_};
+      stopping_ = true;
+    }
+    job_available_.notify_all();
+    for (std::thread& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  ComparePool(const ComparePool&) = delete;
+  ComparePool(ComparePool&&) = delete;
+  auto operator=(const ComparePool&) -> ComparePool& = delete;
+  auto operator=(ComparePool&&) -> ComparePool& = delete;
+
+  auto Submit(size_t index, CaptureFuture frame) -> void {
+    {
+      lock_guard lock{mutex_};
+      jobs_.emplace_back(index, std::move(frame));
+    }
+    job_available_.notify_one();
+  }
+
+ private:
+  auto RunWorker() -> void {
+    for (;;) {
+      pair<size_t, CaptureFuture> job;
+      {
+        unique_lock lock{mutex_};
+        job_available_.wait(lock,
+                            [this]() { return stopping_ || !jobs_.empty(); });
+        if (jobs_.empty()) {
+          return;
+        }
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      // Each result is only touched by the worker that owns its job.
+      Compare(std::move(job.second), options_, results_[job.first]);
+    }
+  }
+
+  const GoldenRunOptions& options_;
+  vector<GoldenResult>& results_;
+
+  mutex mutex_;
+  std::condition_variable job_available_;
+  std::deque<pair<size_t, CaptureFuture>> jobs_;
+  bool stopping_{};
+
+  vector<std::thread> workers_;
+};
+
+auto EscapeXml(string_view text) -> string {
+  string escaped;
+  escaped.reserve(text.size());
+  for (const char c : text) {
+    switch (c) {
+      case '&':
+        escaped += "&amp;";
+        break;
+      case '<':
+        escaped += "&lt;";
+        break;
+      case '>':
+        escaped += "&gt;";
+        break;
+      case '"':
+        escaped += "&quot;";
+        break;
+      case '\'':
+        escaped += "&apos;";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+auto EscapeJson(string_view text) -> string {
+  constexpr string_view kHexDigits = "0123456789abcdef";
+  string escaped;
+  escaped.reserve(text.size());
+  for (const char c : text) {
+    const auto u = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (u < 0x20) {
+      escaped += "\\u00";
+      escaped += kHexDigits[u >> 4U];
+      escaped += kHexDigits[u & 0xFU];
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+auto WriteJsonPath(ostream& out, const std::optional<path>& file) -> void {
+  if (file) {
+    out << '"' << EscapeJson(file->generic_string()) << '"';
+  } else {
+    out << "null";
+  }
+}
+
+auto WriteReportFile(const path& file, const string& contents)
+    -> Expected<void> {
+  ofstream stream{file, std::ios::binary};
+  stream << contents;
+  stream.close();
+  if (!stream) {
+    cerr << "Failed to write report " << file << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  return {};
+}
+
+}  // namespace
+
+auto GoldenReport::GetFailureCount() const -> size_t {
+  return static_cast<size_t>(std::ranges::count_if(
+      results, [](const GoldenResult& result) { return !result.passed; }));
+}
+
+auto ParseGoldenManifest(const path& manifest)
+    -> Expected<vector<GoldenCase>> {
+  ifstream stream{manifest};
+  if (!stream) {
+    cerr << "Failed to open golden manifest " << manifest << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  const path base = manifest.parent_path();
+  vector<GoldenCase> cases;
+  // Names pick the output file names, so they must be unique.
+  std::set<string, std::less<>> names;
+  string line;
+  for (int line_number = 1; std::getline(stream, line); ++line_number) {
+    std::istringstream fields{line};
+    string scene;
+    if (!(fields >> scene) || scene.starts_with('#')) {
+      continue;
+    }
+
+    GoldenCase golden_case{.name = {}, .scene = scene, .reference = {}};
+    string reference;
+    if (!(fields >> reference)) {
+      cerr << manifest << ':' << line_number << ": missing reference image\n";
+      return unexpected(MakeErrorCode(kFileIoError));
+    }
+    golden_case.reference = base / path{reference};
+    golden_case.name = golden_case.reference.stem().string();
+
+    for (string field; fields >> field;) {
+      if (!ParseField(field, golden_case)) {
+        cerr << manifest << ':' << line_number << ": invalid field '"
+             << field << "'\n";
+        return unexpected(MakeErrorCode(kFileIoError));
+      }
+    }
+    if (!names.insert(golden_case.name).second) {
+      cerr << manifest << ':' << line_number << ": duplicate case name '"
+           << golden_case.name << "'\n";
+      return unexpected(MakeErrorCode(kFileIoError));
+    }
+    cases.push_back(std::move(golden_case));
+  }
+  if (stream.bad()) {
+    cerr << "Failed to read golden manifest " << manifest << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  return cases;
+}
+
+auto RunGoldenSuite(const vector<GoldenCase>& cases,
+                    const SceneRegistry& scenes,
+                    const GoldenRunOptions& options) -> Expected<GoldenReport> {
+  const auto start = Clock::now();
+
+  std::error_code error;
+  std::filesystem::create_directories(options.output_dir, error);
+  if (error) {
+    cerr << "Failed to create " << options.output_dir << ": "
+         << error.message() << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  GoldenReport report{};
+  report.results.resize(cases.size());
+  for (size_t i = 0; i < cases.size(); ++i) {
+    report.results[i].golden_case = cases[i];
+  }
+
+  auto capture = CreateIAsyncCapture();
+  if (!capture) {
+    return unexpected(capture.error());
+  }
+
+  GLint previous_framebuffer = 0;
+  array<GLint, 4> previous_viewport{};
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer);
+  glGetIntegerv(GL_VIEWPORT, previous_viewport.data());
+  auto restore = [&]() {
+    glBindFramebuffer(GL_FRAMEBUFFER,
+                      static_cast<GLuint>(previous_framebuffer));
+    glViewport(previous_viewport[0], previous_viewport[1],
+               previous_viewport[2], previous_viewport[3]);
+  };
+
+  size_t worker_count = options.worker_count;
+  if (worker_count == 0) {
+    worker_count = std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  Expected<void> status{};
+  {
+    OffscreenTarget target;
+    ComparePool pool{worker_count, options, report.results};
+
+    for (size_t i = 0; i < cases.size() && status; ++i) {
+      const GoldenCase& golden_case = cases[i];
+      GoldenResult& result = report.results[i];
+
+      const auto factory = scenes.find(golden_case.scene);
+      if (factory == scenes.end()) {
+        result.failure = "unknown scene '" + golden_case.scene + "'";
+        continue;
+      }
+      auto scene = factory->second();
+      if (!scene) {
+        result.failure = "scene creation failed: " + scene.error().message();
+        continue;
+      }
+
+      if (target.GetWidth() != golden_case.width ||
+          target.GetHeight() != golden_case.height) {
+        status = target.Initialize(golden_case.width, golden_case.height);
+      }
+      if (status) {
+        status = target.Bind();
+      }
+      if (!status) {
+        break;
+      }
+
+      if (auto rendered = (*scene)->Render(); !rendered) {
+        result.failure = "render failed: " + rendered.error().message();
+        continue;
+      }
+      auto frame = (*capture)->Capture();
+      if (!frame) {
+        status = unexpected(frame.error());
+        break;
+      }
+      pool.Submit(i, std::move(*frame));
+      status = (*capture)->Poll();
+    }
+
+    // Resolve the remaining reads so the workers' futures complete, even
+    // after an error.
+    if (auto flushed = (*capture)->Flush(); status && !flushed) {
+      status = flushed;
+    }
+    restore();
+  }
+
+  if (!status) {
+    return unexpected(status.error());
+  }
+  report.seconds = SecondsSince(start);
+  return report;
+}
+
+auto WriteJUnitReport(const GoldenReport& report, const path& file)
+    -> Expected<void> {
+  std::ostringstream out;
+  out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      << "<testsuite name=\"golden\" tests=\"" << report.results.size()
+      << "\" failures=\"" << report.GetFailureCount() << "\" time=\""
+      << report.seconds << "\">\n";
+  for (const GoldenResult& result : report.results) {
+    out << "  <testcase classname=\"golden\" name=\""
+        << EscapeXml(result.golden_case.name) << "\" time=\""
+        << result.seconds << '"';
+    if (result.passed) {
+      out << "/>\n";
+      continue;
+    }
+    out << ">\n    <failure message=\"" << EscapeXml(result.failure)
+        << "\">reference: "
+        << EscapeXml(result.golden_case.reference.generic_string());
+    if (result.actual) {
+      out << "\nactual: " << EscapeXml(result.actual->generic_string());
+    }
+    if (result.diff) {
+      out << "\ndiff: " << EscapeXml(result.diff->generic_string());
+    }
+    out << "</failure>\n  </testcase>\n";
+  }
+  out << "</testsuite>\n";
+  return WriteReportFile(file, out.str());
+}
+
+auto WriteJsonReport(const GoldenReport& report, const path& file)
+    -> Expected<void> {
+  std::ostringstream out;
+  out << "{\n  \"tests\": " << report.results.size()
+      << ",\n  \"failures\": " << report.GetFailureCount()
+      << ",\n  \"seconds\": " << report.seconds << ",\n  \"results\": [";
+  for (size_t i = 0; i < report.results.size(); ++i) {
+    const GoldenResult& result = report.results[i];
+    const GoldenCase& golden_case = result.golden_case;
+    out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \""
+        << EscapeJson(golden_case.name) << "\", \"scene\": \""
+        << EscapeJson(golden_case.scene) << "\", \"reference\": \""
+        << EscapeJson(golden_case.reference.generic_string())
+        << "\", \"passed\": " << (result.passed ? "true" : "false")
+        << ", \"failure\": \"" << EscapeJson(result.failure)
+        << "\", \"mismatch_count\": " << result.mismatch_count
+        << ", \"actual\": ";
+    WriteJsonPath(out, result.actual);
+    out << ", \"diff\": ";
+    WriteJsonPath(out, result.diff);
+    out << ", \"seconds\": " << result.seconds << '}';
+  }
+  out << "\n  ]\n}\n";
+  return WriteReportFile(file, out.str());
+}
+
+}  // namespace graphics_engine::golden_runner
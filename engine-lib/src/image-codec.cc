@@ -0,0 +1,788 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "image-codec.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "error.h"
+#include "stb/stb_image.h"
+
+// Part of stb_image_write's implementation, but not of its header. The
+// returned buffer is allocated with STBIW_MALLOC, i.e. malloc.
+extern "C" auto stbi_zlib_compress(unsigned char* data, int data_len,
+                                   int* out_len, int quality)
+    -> unsigned char*;
+
+using enum graphics_engine::image::ImageFormat;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::image::EncodeOptions;
+using graphics_engine::image::ImageView;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::byte;
+using std::nullopt;
+using std::optional;
+using std::size_t;
+using std::span;
+using std::string;
+using std::string_view;
+using std::uint32_t;
+using std::uint8_t;
+using std::unexpected;
+using std::unique_ptr;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::image_codec {
+
+namespace {
+
+// Rows of an ImageView in top-down order.
+class Rows {
+ public:
+  explicit Rows(const ImageView& image)
+      : image_{image},
+        row_size_{static_cast<size_t>(image.width) *
+                  static_cast<size_t>(image.channels)} {}
+
+  [[nodiscard]] auto operator[](int y) const -> const uint8_t* {
+    const int row = image_.bottom_up ? image_.height - 1 - y : y;
+    // NOLINTNEXTLINE(*-reinterpret-cast)
+    return reinterpret_cast<const uint8_t*>(image_.pixels.data()) +
+           (static_cast<size_t>(row) * row_size_);
+  }
+
+  [[nodiscard]] auto GetRowSize() const -> size_t { return row_size_; }
+
+ private:
+  const ImageView& image_;
+  size_t row_size_;
+};
+
+auto Append(vector<byte>& out, span<const uint8_t> data) -> void {
+  const size_t offset = out.size();
+  out.resize(offset + data.size());
+  std::memcpy(out.data() + offset, data.data(), data.size());
+}
+
+auto Append(vector<byte>& out, string_view text) -> void {
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  Append(out, span(reinterpret_cast<const uint8_t*>(text.data()), text.size()));
+}
+
+auto AppendU8(vector<byte>& out, uint32_t value) -> void {
+  out.push_back(static_cast<byte>(value & 0xFFU));
+}
+
+auto AppendU32BigEndian(vector<byte>& out, uint32_t value) -> void {
+  AppendU8(out, value >> 24U);
+  AppendU8(out, value >> 16U);
+  AppendU8(out, value >> 8U);
+  AppendU8(out, value);
+}
+
+// Expands 1 to 4 channels to RGBA the way QOI and PPM see them.
+struct Rgba {
+  uint8_t r{};
+  uint8_t g{};
+  uint8_t b{};
+  uint8_t a{255};
+
+  auto operator==(const Rgba&) const -> bool = default;
+};
+
+// The QOI spec starts every slot of the running index at zero, alpha
+// included, unlike the previous pixel, which starts opaque.
+constexpr Rgba kQoiIndexInitial{.a = 0};
+
+auto LoadRgba(const uint8_t* pixel, int channels) -> Rgba {
+  switch (channels) {
+    case 1:
+      return {.r = pixel[0], .g = pixel[0], .b = pixel[0], .a = 255};
+    case 2:
+      return {.r = pixel[0], .g = pixel[0], .b = pixel[0], .a = pixel[1]};
+    case 3:
+      return {.r = pixel[0], .g = pixel[1], .b = pixel[2], .a = 255};
+    default:
+      return {.r = pixel[0], .g = pixel[1], .b = pixel[2], .a = pixel[3]};
+  }
+}
+
+// ---------------------------------------------------------------------------
+// png
+
+constexpr array<uint8_t, 8> kPngSignature = {137, 80, 78, 71, 13, 10, 26, 10};
+
+// Deflate stored blocks hold at most 65535 bytes.
+constexpr size_t kMaxStoredBlock = 65535;
+
+// The largest prime smaller than 65536, and the number of bytes that can be
+// summed before the Adler-32 sums must be reduced to avoid overflow.
+constexpr uint32_t kAdlerModulus = 65521;
+constexpr size_t kAdlerBlock = 5552;
+
+constexpr auto MakeCrcTable() -> array<uint32_t, 256> {
+  array<uint32_t, 256> table{};
+  for (uint32_t n = 0; n < table.size(); ++n) {
+    uint32_t c = n;
+    for (int k = 0; k < 8; ++k) {
+      c = (c & 1U) != 0 ? 0xEDB88320U ^ (c >> 1U) : c >> 1U;
+    }
+    table[n] = c;
+  }
+  return table;
+}
+
+constexpr array<uint32_t, 256> kCrcTable = MakeCrcTable();
+
+auto Crc32(span<const byte> data) -> uint32_t {
+  uint32_t crc = 0xFFFFFFFFU;
+  for (const byte value : data) {
+    crc = kCrcTable[(crc ^ std::to_integer<uint32_t>(value)) & 0xFFU] ^
+          (crc >> 8U);
+  }
+  return crc ^ 0xFFFFFFFFU;
+}
+
+auto Adler32(span<const uint8_t> data) -> uint32_t {
+  uint32_t a = 1;
+  uint32_t b = 0;
+  while (!data.empty()) {
+    const size_t count = std::min(data.size(), kAdlerBlock);
+    for (const uint8_t value : data.first(count)) {
+      a += value;
+      b += a;
+    }
+    a %= kAdlerModulus;
+    b %= kAdlerModulus;
+    data = data.subspan(count);
+  }
+  return (b << 16U) | a;
+}
+
+auto AppendChunk(vector<byte>& out, string_view type, span<const uint8_t> data)
+    -> void {
+  AppendU32BigEndian(out, static_cast<uint32_t>(data.size()));
+  const size_t crc_start = out.size();
+  Append(out, type);
+  Append(out, data);
+  AppendU32BigEndian(out, Crc32(span(out).subspan(crc_start)));
+}
+
+// A zlib stream of stored (uncompressed) deflate blocks.
+auto StoreZlib(span<const uint8_t> data) -> vector<uint8_t> {
+  const size_t block_count = std::max<size_t>(
+      1, (data.size() + kMaxStoredBlock - 1) / kMaxStoredBlock);
+  vector<uint8_t> out;
+  out.reserve(data.size() + (block_count * 5) + 6);
+  out.push_back(0x78);  // Deflate, 32K window.
+  out.push_back(0x01);  // No preset dictionary, fastest; header checksum.
+
+  size_t offset = 0;
+  for (size_t i = 0; i < block_count; ++i) {
+    const size_t size = std::min(data.size() - offset, kMaxStoredBlock);
+    const bool last = i + 1 == block_count;
+    const auto length = static_cast<uint32_t>(size);
+    const uint32_t inverted = ~length & 0xFFFFU;
+    out.push_back(last ? 1 : 0);  // BFINAL, BTYPE = 00 (stored).
+    out.push_back(static_cast<uint8_t>(length & 0xFFU));
+    out.push_back(static_cast<uint8_t>(length >> 8U));
+    out.push_back(static_cast<uint8_t>(inverted & 0xFFU));
+    out.push_back(static_cast<uint8_t>(inverted >> 8U));
+    out.insert(out.end(), data.begin() + static_cast<std::ptrdiff_t>(offset),
+               data.begin() + static_cast<std::ptrdiff_t>(offset + size));
+    offset += size;
+  }
+
+  const uint32_t adler = Adler32(data);
+  out.push_back(static_cast<uint8_t>(adler >> 24U));
+  out.push_back(static_cast<uint8_t>((adler >> 16U) & 0xFFU));
+  out.push_back(static_cast<uint8_t>((adler >> 8U) & 0xFFU));
+  out.push_back(static_cast<uint8_t>(adler & 0xFFU));
+  return out;
+}
+
+enum class PngFilter : uint8_t { kNone, kSub, kUp, kAverage, kPaeth };
+
+auto Paeth(int a, int b, int c) -> int {
+  const int p = a + b - c;
+  const int pa = std::abs(p - a);
+  const int pb = std::abs(p - b);
+  const int pc = std::abs(p - c);
+  if (pa <= pb && pa <= pc) {
+    return a;
+  }
+  return pb <= pc ? b : c;
+}
+
+// Filters one row. `above` is null for the first row, which the png spec
+// treats as having a row of zeros above it.
+auto FilterRow(PngFilter filter, span<const uint8_t> row, const uint8_t* above,
+               size_t bytes_per_pixel, span<uint8_t> out) -> void {
+  const size_t size = row.size();
+  auto up = [above](size_t i) -> int { return above ? above[i] : 0; };
+  auto left = [&row, bytes_per_pixel](size_t i) -> int {
+    return i >= bytes_per_pixel ? row[i - bytes_per_pixel] : 0;
+  };
+  auto up_left = [above, bytes_per_pixel](size_t i) -> int {
+    return above && i >= bytes_per_pixel ? above[i - bytes_per_pixel] : 0;
+  };
+
+  switch (filter) {
+    case PngFilter::kNone:
+      std::memcpy(out.data(), row.data(), size);
+      break;
+    case PngFilter::kSub:
+      for (size_t i = 0; i < size; ++i) {
+        out[i] = static_cast<uint8_t>(row[i] - left(i));
+      }
+      break;
+    case PngFilter::kUp:
+      for (size_t i = 0; i < size; ++i) {
+        out[i] = static_cast<uint8_t>(row[i] - up(i));
+      }
+      break;
+    case PngFilter::kAverage:
+      for (size_t i = 0; i < size; ++i) {
+        out[i] = static_cast<uint8_t>(row[i] - ((left(i) + up(i)) >> 1));
+      }
+      break;
+    case PngFilter::kPaeth:
+      for (size_t i = 0; i < size; ++i) {
+        out[i] =
+            static_cast<uint8_t>(row[i] - Paeth(left(i), up(i), up_left(i)));
+      }
+      break;
+  }
+}
+
+// The usual heuristic, also used by stb_image_write: the filter whose output
+// has the smallest sum of absolute values, read as signed bytes.
+auto Cost(span<const uint8_t> filtered) -> long long int {
+  long long int cost = 0;
+  for (const uint8_t value : filtered) {
+    cost += std::abs(static_cast<int>(static_cast<std::int8_t>(value)));
+  }
+  return cost;
+}
+
+auto FilterImage(const ImageView& image, int level) -> vector<uint8_t> {
+  const Rows rows(image);
+  const size_t row_size = rows.GetRowSize();
+  const auto bytes_per_pixel = static_cast<size_t>(image.channels);
+  vector<uint8_t> filtered((row_size + 1) * static_cast<size_t>(image.height));
+  vector<uint8_t> candidate(row_size);
+
+  for (int y = 0; y < image.height; ++y) {
+    const span<const uint8_t> row(rows[y], row_size);
+    const uint8_t* above = y > 0 ? rows[y - 1] : nullptr;
+    uint8_t* out = filtered.data() + (static_cast<size_t>(y) * (row_size + 1));
+    const span<uint8_t> out_row(out + 1, row_size);
+
+    PngFilter filter = PngFilter::kNone;
+    if (level >= 5) {
+      long long int best_cost = std::numeric_limits<long long int>::max();
+      for (const PngFilter candidate_filter :
+           {PngFilter::kNone, PngFilter::kSub, PngFilter::kUp,
+            PngFilter::kAverage, PngFilter::kPaeth}) {
+        FilterRow(candidate_filter, row, above, bytes_per_pixel, candidate);
+        const long long int cost = Cost(candidate);
+        if (cost < best_cost) {
+          best_cost = cost;
+          filter = candidate_filter;
+          std::ranges::copy(candidate, out_row.begin());
+        }
+      }
+    } else {
+      if (level > 0) {
+        filter = above != nullptr ? PngFilter::kUp : PngFilter::kSub;
+      }
+      FilterRow(filter, row, above, bytes_per_pixel, out_row);
+    }
+    out[0] = static_cast<uint8_t>(filter);
+  }
+
+  return filtered;
+}
+
+struct FreeDeleter {
+  auto operator()(unsigned char* data) const -> void {
+    std::free(data);  // NOLINT(*-no-malloc,*-owning-memory)
+  }
+};
+
+auto EncodePng(const ImageView& image, int level) -> Expected<vector<byte>> {
+  level = std::clamp(level, 0, 9);
+
+  // Gray, gray + alpha, RGB and RGBA.
+  constexpr array<uint8_t, 5> kColorTypes = {0, 0, 4, 2, 6};
+
+  vector<uint8_t> filtered = FilterImage(image, level);
+  vector<uint8_t> stored;
+  unique_ptr<unsigned char, FreeDeleter> compressed;
+  span<const uint8_t> zlib;
+  if (level == 0) {
+    stored = StoreZlib(filtered);
+    zlib = stored;
+  } else {
+    if (filtered.size() > static_cast<size_t>(INT_MAX)) {
+      return unexpected(MakeErrorCode(kStbErrorWritePng));
+    }
+    int zlib_size = 0;
+    // stb's quality is the length of its hash chains; it clamps it to 5.
+    compressed.reset(stbi_zlib_compress(filtered.data(),
+                                        static_cast<int>(filtered.size()),
+                                        &zlib_size, level));
+    if (!compressed) {
+      return unexpected(MakeErrorCode(kStbErrorWritePng));
+    }
+    zlib = span(compressed.get(), static_cast<size_t>(zlib_size));
+  }
+
+  vector<byte> out;
+  out.reserve(zlib.size() + 64);
+  Append(out, kPngSignature);
+
+  vector<byte> header;
+  AppendU32BigEndian(header, static_cast<uint32_t>(image.width));
+  AppendU32BigEndian(header, static_cast<uint32_t>(image.height));
+  AppendU8(header, 8);  // Bit depth.
+  AppendU8(header, kColorTypes[static_cast<size_t>(image.channels)]);
+  AppendU8(header, 0);  // Deflate.
+  AppendU8(header, 0);  // Adaptive filtering.
+  AppendU8(header, 0);  // Not interlaced.
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  AppendChunk(out, "IHDR", span(reinterpret_cast<uint8_t*>(header.data()),
+                                header.size()));
+  AppendChunk(out, "IDAT", zlib);
+  AppendChunk(out, "IEND", {});
+  return out;
+}
+
+// ---------------------------------------------------------------------------
+// QOI, see https://qoiformat.org/qoi-specification.pdf
+
+constexpr string_view kQoiMagic = "qoif";
+constexpr size_t kQoiHeaderSize = 14;
+constexpr array<uint8_t, 8> kQoiEnd = {0, 0, 0, 0, 0, 0, 0, 1};
+
+constexpr uint8_t kQoiOpIndex = 0x00;
+constexpr uint8_t kQoiOpDiff = 0x40;
+constexpr uint8_t kQoiOpLuma = 0x80;
+constexpr uint8_t kQoiOpRun = 0xC0;
+constexpr uint8_t kQoiOpRgb = 0xFE;
+constexpr uint8_t kQoiOpRgba = 0xFF;
+constexpr uint8_t kQoiMask2 = 0xC0;
+constexpr int kQoiMaxRun = 62;
+
+// Decoders refuse larger images; the spec uses the same bound.
+constexpr size_t kQoiMaxPixels = 400'000'000;
+
+auto QoiHash(const Rgba& pixel) -> size_t {
+  return ((pixel.r * 3U) + (pixel.g * 5U) + (pixel.b * 7U) + (pixel.a * 11U)) %
+         64U;
+}
+
+auto EncodeQoi(const ImageView& image) -> vector<byte> {
+  const Rows rows(image);
+  const int channels = image.channels % 2 == 0 ? 4 : 3;
+  const size_t pixel_count =
+      static_cast<size_t>(image.width) * static_cast<size_t>(image.height);
+
+  vector<byte> out;
+  // Worst case: one tag byte plus every channel for each pixel.
+  out.reserve(kQoiHeaderSize + (pixel_count * (channels + 1)) + kQoiEnd.size());
+  Append(out, kQoiMagic);
+  AppendU32BigEndian(out, static_cast<uint32_t>(image.width));
+  AppendU32BigEndian(out, static_cast<uint32_t>(image.height));
+  AppendU8(out, static_cast<uint32_t>(channels));
+  AppendU8(out, 0);  // sRGB with linear alpha.
+
+  array<Rgba, 64> index{};
+  index.fill(kQoiIndexInitial);
+  Rgba previous{};
+  int run = 0;
+  for (int y = 0; y < image.height; ++y) {
+    const uint8_t* row = rows[y];
+    for (int x = 0; x < image.width; ++x) {
+      const Rgba pixel =
+          LoadRgba(row + (static_cast<size_t>(x) * image.channels),
+                   image.channels);
+      if (pixel == previous) {
+        ++run;
+        if (run == kQoiMaxRun) {
+          AppendU8(out, kQoiOpRun | static_cast<uint32_t>(run - 1));
+          run = 0;
+        }
+        continue;
+      }
+
+      if (run > 0) {
+        AppendU8(out, kQoiOpRun | static_cast<uint32_t>(run - 1));
+        run = 0;
+      }
+
+      const size_t hash = QoiHash(pixel);
+      if (index[hash] == pixel) {
+        AppendU8(out, kQoiOpIndex | static_cast<uint32_t>(hash));
+      } else {
+        index[hash] = pixel;
+        if (pixel.a == previous.a) {
+          const auto dr = static_cast<std::int8_t>(pixel.r - previous.r);
+          const auto dg = static_cast<std::int8_t>(pixel.g - previous.g);
+          const auto db = static_cast<std::int8_t>(pixel.b - previous.b);
+          const int dr_dg = dr - dg;
+          const int db_dg = db - dg;
+          if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 &&
+              db <= 1) {
+            AppendU8(out, kQoiOpDiff | static_cast<uint32_t>(
+                                           ((dr + 2) << 4) | ((dg + 2) << 2) |
+                                           (db + 2)));
+          } else if (dr_dg >= -8 && dr_dg <= 7 && dg >= -32 && dg <= 31 &&
+                     db_dg >= -8 && db_dg <= 7) {
+            AppendU8(out, kQoiOpLuma | static_cast<uint32_t>(dg + 32));
+            AppendU8(out, static_cast<uint32_t>(((dr_dg + 8) << 4) |
+                                                (db_dg + 8)));
+          } else {
+            AppendU8(out, kQoiOpRgb);
+            AppendU8(out, pixel.r);
+            AppendU8(out, pixel.g);
+            AppendU8(out, pixel.b);
+          }
+        } else {
+          AppendU8(out, kQoiOpRgba);
+          AppendU8(out, pixel.r);
+          AppendU8(out, pixel.g);
+          AppendU8(out, pixel.b);
+          AppendU8(out, pixel.a);
+        }
+      }
+      previous = pixel;
+    }
+  }
+  if (run > 0) {
+    AppendU8(out, kQoiOpRun | static_cast<uint32_t>(run - 1));
+  }
+
+  Append(out, kQoiEnd);
+  return out;
+}
+
+auto ReadU32BigEndian(span<const uint8_t> data) -> uint32_t {
+  return (uint32_t{data[0]} << 24U) | (uint32_t{data[1]} << 16U) |
+         (uint32_t{data[2]} << 8U) | uint32_t{data[3]};
+}
+
+auto DecodeQoi(span<const uint8_t> file) -> optional<DecodedImage> {
+  if (file.size() < kQoiHeaderSize + kQoiEnd.size()) {
+    return nullopt;
+  }
+
+  DecodedImage image;
+  const uint32_t width = ReadU32BigEndian(file.subspan(4));
+  const uint32_t height = ReadU32BigEndian(file.subspan(8));
+  image.channels = file[12];
+  if (width == 0 || height == 0 ||
+      (image.channels != 3 && image.channels != 4) ||
+      height >= kQoiMaxPixels / width) {
+    return nullopt;
+  }
+  image.width = static_cast<int>(width);
+  image.height = static_cast<int>(height);
+
+  const size_t pixel_count = size_t{width} * height;
+  const auto channels = static_cast<size_t>(image.channels);
+  image.pixels.resize(pixel_count * channels);
+
+  // Every op reads at most 5 bytes and the end marker is 8 bytes long, so
+  // reads starting before it stay inside the file.
+  const size_t chunks_end = file.size() - kQoiEnd.size();
+  array<Rgba, 64> index{};
+  index.fill(kQoiIndexInitial);
+  Rgba pixel{};
+  int run = 0;
+  size_t p = kQoiHeaderSize;
+  for (size_t i = 0; i < pixel_count; ++i) {
+    if (run > 0) {
+      --run;
+    } else if (p < chunks_end) {
+      const uint8_t op = file[p++];
+      if (op == kQoiOpRgb) {
+        pixel.r = file[p++];
+        pixel.g = file[p++];
+        pixel.b = file[p++];
+      } else if (op == kQoiOpRgba) {
+        pixel.r = file[p++];
+        pixel.g = file[p++];
+        pixel.b = file[p++];
+        pixel.a = file[p++];
+      } else if ((op & kQoiMask2) == kQoiOpIndex) {
+        pixel = index[op];
+      } else if ((op & kQoiMask2) == kQoiOpDiff) {
+        pixel.r = static_cast<uint8_t>(pixel.r + ((op >> 4) & 0x03) - 2);
+        pixel.g = static_cast<uint8_t>(pixel.g + ((op >> 2) & 0x03) - 2);
+        pixel.b = static_cast<uint8_t>(pixel.b + (op & 0x03) - 2);
+      } else if ((op & kQoiMask2) == kQoiOpLuma) {
+        const uint8_t second = file[p++];
+        const int dg = (op & 0x3F) - 32;
+        pixel.r =
+            static_cast<uint8_t>(pixel.r + dg - 8 + ((second >> 4) & 0x0F));
+        pixel.g = static_cast<uint8_t>(pixel.g + dg);
+        pixel.b = static_cast<uint8_t>(pixel.b + dg - 8 + (second & 0x0F));
+      } else {
+        run = op & 0x3F;
+      }
+      index[QoiHash(pixel)] = pixel;
+    }
+
+    uint8_t* out = image.pixels.data() + (i * channels);
+    out[0] = pixel.r;
+    out[1] = pixel.g;
+    out[2] = pixel.b;
+    if (channels == 4) {
+      out[3] = pixel.a;
+    }
+  }
+
+  return image;
+}
+
+// ---------------------------------------------------------------------------
+// Netpbm
+
+constexpr array<string_view, 5> kPamTupleTypes = {
+    "", "GRAYSCALE", "GRAYSCALE_ALPHA", "RGB", "RGB_ALPHA"};
+
+auto EncodePam(const ImageView& image) -> vector<byte> {
+  const Rows rows(image);
+  const string header =
+      "P7\nWIDTH " + std::to_string(image.width) + "\nHEIGHT " +
+      std::to_string(image.height) + "\nDEPTH " +
+      std::to_string(image.channels) + "\nMAXVAL 255\nTUPLTYPE " +
+      string(kPamTupleTypes[static_cast<size_t>(image.channels)]) +
+      "\nENDHDR\n";
+
+  vector<byte> out;
+  out.reserve(header.size() + image.pixels.size());
+  Append(out, header);
+  for (int y = 0; y < image.height; ++y) {
+    Append(out, span(rows[y], rows.GetRowSize()));
+  }
+  return out;
+}
+
+auto EncodePpm(const ImageView& image) -> vector<byte> {
+  const Rows rows(image);
+  const string header = "P6\n" + std::to_string(image.width) + ' ' +
+                        std::to_string(image.height) + "\n255\n";
+  const auto width = static_cast<size_t>(image.width);
+
+  vector<byte> out;
+  out.reserve(header.size() + (width * 3 * static_cast<size_t>(image.height)));
+  Append(out, header);
+  vector<uint8_t> rgb(width * 3);
+  for (int y = 0; y < image.height; ++y) {
+    const uint8_t* row = rows[y];
+    for (size_t x = 0; x < width; ++x) {
+      const Rgba pixel = LoadRgba(row + (x * image.channels), image.channels);
+      rgb[x * 3] = pixel.r;
+      rgb[(x * 3) + 1] = pixel.g;
+      rgb[(x * 3) + 2] = pixel.b;
+    }
+    Append(out, rgb);
+  }
+  return out;
+}
+
+// Reads the PAM header fields this codec writes; comments and unknown fields
+// are skipped.
+auto DecodePam(span<const uint8_t> file) -> optional<DecodedImage> {
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  const string_view text(reinterpret_cast<const char*>(file.data()),
+                         file.size());
+  DecodedImage image;
+  int max_value = 0;
+  size_t position = 3;  // After "P7\n".
+  while (true) {
+    const size_t line_end = text.find('\n', position);
+    if (line_end == string_view::npos) {
+      return nullopt;
+    }
+    const string_view line = text.substr(position, line_end - position);
+    position = line_end + 1;
+    if (line == "ENDHDR") {
+      break;
+    }
+
+    const size_t space = line.find(' ');
+    const string_view key = line.substr(0, space);
+    int* field = nullptr;
+    if (key == "WIDTH") {
+      field = &image.width;
+    } else if (key == "HEIGHT") {
+      field = &image.height;
+    } else if (key == "DEPTH") {
+      field = &image.channels;
+    } else if (key == "MAXVAL") {
+      field = &max_value;
+    }
+    if (field != nullptr && space != string_view::npos) {
+      const string_view value = line.substr(space + 1);
+      std::from_chars(value.data(), value.data() + value.size(), *field);
+    }
+  }
+
+  if (image.width <= 0 || image.height <= 0 || image.channels < 1 ||
+      image.channels > 4 || max_value != 255) {
+    return nullopt;
+  }
+  const size_t size = static_cast<size_t>(image.width) *
+                      static_cast<size_t>(image.height) *
+                      static_cast<size_t>(image.channels);
+  if (file.size() - position < size) {
+    return nullopt;
+  }
+
+  const auto pixels = file.subspan(position, size);
+  image.pixels.assign(pixels.begin(), pixels.end());
+  return image;
+}
+
+auto StartsWith(span<const uint8_t> file, string_view magic) -> bool {
+  return file.size() >= magic.size() &&
+         std::equal(magic.begin(), magic.end(), file.begin(),
+                    [](char a, uint8_t b) {
+                      return static_cast<uint8_t>(a) == b;
+                    });
+}
+
+}  // namespace
+
+auto IsValid(const ImageView& image) -> bool {
+  if (image.width <= 0 || image.height <= 0 || image.channels < 1 ||
+      image.channels > 4) {
+    return false;
+  }
+  const size_t size = static_cast<size_t>(image.width) *
+                      static_cast<size_t>(image.height) *
+                      static_cast<size_t>(image.channels);
+  return image.pixels.size() == size;
+}
+
+auto ToRgba(const ImageView& image) -> vector<uint8_t> {
+  const Rows rows(image);
+  vector<uint8_t> rgba(static_cast<size_t>(image.width) *
+                       static_cast<size_t>(image.height) * 4);
+  uint8_t* out = rgba.data();
+  for (int y = 0; y < image.height; ++y) {
+    const uint8_t* row = rows[y];
+    for (int x = 0; x < image.width; ++x, out += 4) {
+      const Rgba pixel =
+          LoadRgba(row + (static_cast<size_t>(x) * image.channels),
+                   image.channels);
+      out[0] = pixel.r;
+      out[1] = pixel.g;
+      out[2] = pixel.b;
+      out[3] = pixel.a;
+    }
+  }
+  return rgba;
+}
+
+auto Encode(const ImageView& image, const EncodeOptions& options)
+    -> Expected<vector<byte>> {
+  if (!IsValid(image)) {
+    return unexpected(MakeErrorCode(kInvalidImage));
+  }
+
+  switch (options.format) {
+    case kQoi:
+      return EncodeQoi(image);
+    case kPam:
+      return EncodePam(image);
+    case kPpm:
+      return EncodePpm(image);
+    case kPng:
+      break;
+  }
+  return EncodePng(image, options.png_compression_level);
+}
+
+auto WriteImage(const path& file, const ImageView& image,
+                const EncodeOptions& options) -> Expected<void> {
+  Expected<vector<byte>> encoded = Encode(image, options);
+  if (!encoded.has_value()) {
+    return unexpected(encoded.error());
+  }
+
+  std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  stream.write(reinterpret_cast<const char*>(encoded->data()),
+               static_cast<std::streamsize>(encoded->size()));
+  if (!stream) {
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  return {};
+}
+
+auto Decode(span<const byte> file) -> optional<DecodedImage> {
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  const span bytes(reinterpret_cast<const uint8_t*>(file.data()), file.size());
+  if (StartsWith(bytes, kQoiMagic)) {
+    return DecodeQoi(bytes);
+  }
+  if (StartsWith(bytes, "P7\n")) {
+    return DecodePam(bytes);
+  }
+
+  if (bytes.size() > static_cast<size_t>(INT_MAX)) {
+    return nullopt;
+  }
+  DecodedImage image;
+  stbi_uc* pixels =
+      stbi_load_from_memory(bytes.data(), static_cast<int>(bytes.size()),
+                            &image.width, &image.height, &image.channels, 0);
+  if (pixels == nullptr) {
+    return nullopt;
+  }
+  const size_t size = static_cast<size_t>(image.width) *
+                      static_cast<size_t>(image.height) *
+                      static_cast<size_t>(image.channels);
+  image.pixels.assign(pixels, pixels + size);
+  stbi_image_free(pixels);
+  return image;
+}
+
+auto DecodeFile(const path& file) -> optional<DecodedImage> {
+  std::ifstream stream(file, std::ios::binary);
+  if (!stream) {
+    return nullopt;
+  }
+  vector<char> contents{std::istreambuf_iterator<char>(stream),
+                        std::istreambuf_iterator<char>()};
+  return Decode(std::as_bytes(span(contents)));
+}
+
+}  // namespace graphics_engine::image_codec
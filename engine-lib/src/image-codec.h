@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_IMAGE_CODEC_H_
+#define ENGINE_LIB_IMAGE_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "graphics-engine/image.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::image_codec {
+
+// Returns true if `image` has 1 to 4 channels, a positive size and exactly
+// width * height * channels bytes of pixels.
+[[nodiscard]] auto IsValid(const image::ImageView& image) -> bool;
+
+// Returns the pixels of a valid `image` as tightly packed RGBA8, top row
+// first. One and two channels are expanded as grey and grey-alpha.
+[[nodiscard]] auto ToRgba(const image::ImageView& image)
+    -> std::vector<std::uint8_t>;
+
+// Encodes `image` in the requested format. Returns kInvalidImage if the view
+// is malformed.
+[[nodiscard]] auto Encode(const image::ImageView& image,
+                          const image::EncodeOptions& options)
+    -> types::Expected<std::vector<std::byte>>;
+
+// Encodes `image` in the requested format and writes it to `file`. Returns
+// kFileIoError if the file can't be written.
+//
+// Safe to call from several threads at once. The png encoder drives stb's
+// deflate directly with the requested level instead of going through
+// stbi_write_png, whose compression level and vertical flip are process-wide
+// settings.
+[[nodiscard]] auto WriteImage(const std::filesystem::path& file,
+                              const image::ImageView& image,
+                              const image::EncodeOptions& options)
+    -> types::Expected<void>;
+
+// Pixels decoded by Decode, top-down and tightly packed.
+struct DecodedImage {
+  std::vector<std::uint8_t> pixels;
+  int width{};
+  int height{};
+  int channels{};
+};
+
+// Decodes QOI and PAM files and everything stb_image reads, detecting the
+// format from the contents. Returns nothing if the file can't be decoded.
+[[nodiscard]] auto Decode(std::span<const std::byte> file)
+    -> std::optional<DecodedImage>;
+
+// Reads `file` and decodes it as Decode does. Returns nothing if the file
+// can't be read or decoded.
+[[nodiscard]] auto DecodeFile(const std::filesystem::path& file)
+    -> std::optional<DecodedImage>;
+
+}  // namespace graphics_engine::image_codec
+
+#endif  // ENGINE_LIB_IMAGE_CODEC_H_
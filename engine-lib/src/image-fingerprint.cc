@@ -0,0 +1,247 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "graphics-engine/image-fingerprint.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "error.h"
+#include "image-codec.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::image::ImageView;
+using graphics_engine::image_codec::DecodedImage;
+using graphics_engine::image_codec::DecodeFile;
+using graphics_engine::image_codec::IsValid;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::byte;
+using std::optional;
+using std::size_t;
+using std::span;
+using std::uint32_t;
+using std::uint64_t;
+using std::uint8_t;
+using std::unexpected;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::image_fingerprint {
+
+namespace {
+
+constexpr int kRgba = 4;
+constexpr size_t kHashColumns = 9;
+constexpr size_t kHashRows = 8;
+
+// A streaming 64-bit hash consuming 8 bytes per step. The words are read as
+// little-endian on every host so hashes saved in an index stay valid.
+class ContentHasher {
+ public:
+  auto Update(span<const uint8_t> data) -> void {
+    length_ += data.size();
+    size_t offset = 0;
+    if (pending_size_ > 0) {
+      const size_t count = std::min(kWordSize - pending_size_, data.size());
+      std::memcpy(pending_.data() + pending_size_, data.data(), count);
+      pending_size_ += count;
+      offset = count;
+      if (pending_size_ < kWordSize) {
+        return;
+      }
+      Mix(Load(pending_.data()));
+      pending_size_ = 0;
+    }
+    for (; offset + kWordSize <= data.size(); offset += kWordSize) {
+      Mix(Load(data.data() + offset));
+    }
+    pending_size_ = data.size() - offset;
+    std::memcpy(pending_.data(), data.data() + offset, pending_size_);
+  }
+
+  [[nodiscard]] auto Finish() -> uint64_t {
+    if (pending_size_ > 0) {
+      std::memset(pending_.data() + pending_size_, 0,
+                  kWordSize - pending_size_);
+      Mix(Load(pending_.data()));
+    }
+    // The murmur3 finalizer spreads every input bit over the result.
+    uint64_t hash = state_ ^ length_;
+    hash ^= hash >> 33U;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33U;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33U;
+    return hash;
+  }
+
+ private:
+  static constexpr size_t kWordSize = 8;
+
+  static auto Load(const uint8_t* data) -> uint64_t {
+    uint64_t word = 0;
+    std::memcpy(&word, data, kWordSize);
+    if constexpr (std::endian::native == std::endian::big) {
+      word = std::byteswap(word);
+    }
+    return word;
+  }
+
+  auto Mix(uint64_t word) -> void {
+    word *= 0x87C37B91114253D5ULL;
+    word = std::rotl(word, 31);
+    word *= 0x4CF5AD432745937FULL;
+    state_ ^= word;
+    state_ = std::rotl(state_, 27) * 5 + 0x52DCE729;
+  }
+
+  uint64_t state_{0x9E3779B97F4A7C15ULL};
+  uint64_t length_{};
+  array<uint8_t, kWordSize> pending_{};
+  size_t pending_size_{};
+};
+
+// Returns the row `y` counting from the top.
+auto GetRow(const ImageView& image, int y) -> const uint8_t* {
+  const size_t row_size = static_cast<size_t>(image.width) *
+                          static_cast<size_t>(image.channels);
+  const int row = image.bottom_up ? image.height - 1 - y : y;
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  return reinterpret_cast<const uint8_t*>(image.pixels.data()) +
+         static_cast<size_t>(row) * row_size;
+}
+
+auto HashContent(const ImageView& image) -> uint64_t {
+  ContentHasher hasher;
+  array<uint8_t, 8> header{};
+  for (size_t i = 0; i < 4; ++i) {
+    header[i] = static_cast<uint8_t>(static_cast<uint32_t>(image.width) >>
+                                     (8 * i));
+    header[4 + i] = static_cast<uint8_t>(
+        static_cast<uint32_t>(image.height) >> (8 * i));
+  }
+  hasher.Update(header);
+
+  const auto width = static_cast<size_t>(image.width);
+  vector<uint8_t> rgba;
+  if (image.channels != kRgba) {
+    rgba.resize(width * kRgba);
+  }
+  for (int y = 0; y < image.height; ++y) {
+    const uint8_t* row = GetRow(image, y);
+    if (image.channels == kRgba) {
+      hasher.Update(span(row, width * kRgba));
+      continue;
+    }
+    for (size_t x = 0; x < width; ++x) {
+      const uint8_t* pixel = row + (x * image.channels);
+      uint8_t* out = rgba.data() + (x * kRgba);
+      if (image.channels <= 2) {
+        out[0] = out[1] = out[2] = pixel[0];
+        out[3] = image.channels == 2 ? pixel[1] : 0xFF;
+      } else {
+        out[0] = pixel[0];
+        out[1] = pixel[1];
+        out[2] = pixel[2];
+        out[3] = 0xFF;
+      }
+    }
+    hasher.Update(rgba);
+  }
+  return hasher.Finish();
+}
+
+// Luminance scaled by 1024 (BT.601 weights), ignoring alpha.
+auto GetLuma(const uint8_t* pixel, int channels) -> uint64_t {
+  if (channels <= 2) {
+    return uint64_t{pixel[0]} * 1024;
+  }
+  return (uint64_t{pixel[0]} * 306) + (uint64_t{pixel[1]} * 601) +
+         (uint64_t{pixel[2]} * 117);
+}
+
+auto HashPerception(const ImageView& image) -> uint64_t {
+  // Box-filter the luminance into a 9x8 grid in one pass. Images smaller than
+  // the grid repeat their pixels over several cells.
+  array<array<uint64_t, kHashColumns>, kHashRows> sums{};
+  array<array<uint64_t, kHashColumns>, kHashRows> counts{};
+  const auto width = static_cast<size_t>(image.width);
+  const auto height = static_cast<size_t>(image.height);
+
+  vector<size_t> first_column(width);
+  vector<size_t> last_column(width);
+  for (size_t x = 0; x < width; ++x) {
+    first_column[x] = x * kHashColumns / width;
+    last_column[x] = std::max(first_column[x],
+                              (((x + 1) * kHashColumns) - 1) / width);
+  }
+
+  for (size_t y = 0; y < height; ++y) {
+    const size_t first_row = y * kHashRows / height;
+    const size_t last_row =
+        std::max(first_row, (((y + 1) * kHashRows) - 1) / height);
+    const uint8_t* row = GetRow(image, static_cast<int>(y));
+    for (size_t x = 0; x < width; ++x) {
+      const uint64_t luma = GetLuma(row + (x * image.channels), image.channels);
+      for (size_t cell_y = first_row; cell_y <= last_row; ++cell_y) {
+        for (size_t cell_x = first_column[x]; cell_x <= last_column[x];
+             ++cell_x) {
+          sums[cell_y][cell_x] += luma;
+          ++counts[cell_y][cell_x];
+        }
+      }
+    }
+  }
+
+  uint64_t hash = 0;
+  for (size_t y = 0; y < kHashRows; ++y) {
+    array<double, kHashColumns> means{};
+    for (size_t x = 0; x < kHashColumns; ++x) {
+      means[x] = static_cast<double>(sums[y][x]) /
+                 static_cast<double>(counts[y][x]);
+    }
+    for (size_t x = 0; x + 1 < kHashColumns; ++x) {
+      hash = (hash << 1U) | (means[x] > means[x + 1] ? 1U : 0U);
+    }
+  }
+  return hash;
+}
+
+}  // namespace
+
+auto ComputeFingerprint(const ImageView& image) -> Expected<ImageFingerprint> {
+  if (!IsValid(image)) {
+    return unexpected(MakeErrorCode(kInvalidImage));
+  }
+  return ImageFingerprint{.content_hash = HashContent(image),
+                          .perceptual_hash = HashPerception(image),
+                          .width = image.width,
+                          .height = image.height};
+}
+
+auto ComputeFingerprint(const path& file) -> Expected<ImageFingerprint> {
+  optional<DecodedImage> decoded = DecodeFile(file);
+  if (!decoded) {
+    return unexpected(MakeErrorCode(kStbErrorLoad));
+  }
+  return ComputeFingerprint(
+      ImageView{.width = decoded->width,
+                .height = decoded->height,
+                .channels = decoded->channels,
+                .pixels = std::as_bytes(span(decoded->pixels)),
+                .bottom_up = false});
+}
+
+}  // namespace graphics_engine::image_fingerprint
@@ -4,27 +4,51 @@
 
 #include "graphics-engine/image.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <future>
 #include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "error.h"
 #include "glad/glad.h"
-#include "stb/stb_image.h"
-#include "stb/stb_image_write.h"
+#include "image-codec.h"
+
+// SSE2 is part of every x86-64 target; elsewhere the scalar loop is used.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINE_LIB_HAS_SSE2
+#include <emmintrin.h>
+#endif
 
 using ::graphics_engine::error::CheckGLError;
 using ::graphics_engine::error::MakeErrorCode;
+using ::graphics_engine::image_codec::DecodedImage;
+using ::graphics_engine::image_codec::DecodeFile;
+using ::graphics_engine::image_codec::Encode;
+using ::graphics_engine::image_codec::IsValid;
+using ::graphics_engine::image_codec::WriteImage;
+using enum ::graphics_engine::image::ImageFormat;
 using enum ::graphics_engine::types::ErrorCode;
 using ::graphics_engine::types::Expected;
 
 using ::std::array;
+using ::std::async;
 using ::std::byte;
+using ::std::future;
 using ::std::is_same_v;
+using ::std::launch;
 using ::std::optional;
 using ::std::span;
-using ::std::string;
+using ::std::size_t;
+using ::std::string_view;
+using ::std::uint8_t;
 using ::std::unexpected;
 using ::std::vector;
 using ::std::filesystem::path;
@@ -32,47 +56,314 @@ using ::std::filesystem::temp_directory_path;
 
 namespace graphics_engine::image {
 
-auto AreIdentical(const path& png0, const path& png1) -> Expected<bool> {
-  int width1{};
-  int height1{};
-  int channels1{};
-  int width2{};
-  int height2{};
-  int channels2{};
+namespace {
+
+// Checks whether any byte of two equally sized pixel runs differs by more
+// than its channel's tolerance. Runs always start on a pixel boundary.
+class ToleranceKernel {
+ public:
+  static constexpr size_t kVectorSize = 16;
+
+  ToleranceKernel(const array<uint8_t, 4>& tolerance, size_t channels)
+      : channels_(channels) {
+    exact_ = std::all_of(tolerance.begin(), tolerance.begin() + channels,
+                         [](uint8_t value) { return value == 0; });
+    for (size_t c = 0; c < channels; ++c) {
+      tolerance_[c] = tolerance[c];
+    }
+
+    // A vector starting at byte `offset` of a run covers channels
+    // (offset + i) % channels. 16 is a multiple of 1, 2 and 4 channels; three
+    // channels need one pattern per offset % 3.
+    for (size_t phase = 0; phase < channels; ++phase) {
+      for (size_t i = 0; i < kVectorSize; ++i) {
+        patterns_[phase][i] = tolerance_[(phase + i) % channels];
+      }
+    }
+  }
+
+  [[nodiscard]] auto Exceeds(span<const uint8_t> run0,
+                             span<const uint8_t> run1) const -> bool {
+    if (exact_) {
+      // memcmp is vectorized by the C library and stops at the first
+      // difference.
+      return std::memcmp(run0.data(), run1.data(), run0.size()) != 0;
+    }
+
+    size_t i = 0;
+#ifdef ENGINE_LIB_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + kVectorSize <= run0.size(); i += kVectorSize) {
+      // NOLINTBEGIN(*-reinterpret-cast)
+      const __m128i a =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(run0.data() + i));
+      const __m128i b =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(run1.data() + i));
+      const __m128i tolerance = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(patterns_[i % channels_].data()));
+      // NOLINTEND(*-reinterpret-cast)
+
+      // |a - b| with saturating subtraction; it exceeds the tolerance where
+      // subtracting the tolerance leaves something.
+      const __m128i difference =
+          _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+      const __m128i excess = _mm_subs_epu8(difference, tolerance);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(excess, zero)) != 0xFFFF) {
+        return true;
+      }
+    }
+#endif
+
+    for (; i < run0.size(); ++i) {
+      const int difference = std::abs(int{run0[i]} - int{run1[i]});
+      if (difference > tolerance_[i % channels_]) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+ private:
+  size_t channels_;
+  bool exact_{};
+  array<uint8_t, 4> tolerance_{};
+  array<array<uint8_t, kVectorSize>, 4> patterns_{};
+};
+
+auto IsIgnored(span<const PixelRect> regions, int x, int y) -> bool {
+  return std::ranges::any_of(regions, [x, y](const PixelRect& rect) {
+    return x >= rect.x && x < rect.x + rect.width && y >= rect.y &&
+           y < rect.y + rect.height;
+  });
+}
+
+auto MaxDifference(span<const uint8_t> pixel0, span<const uint8_t> pixel1)
+    -> int {
+  int difference = 0;
+  for (size_t c = 0; c < pixel0.size(); ++c) {
+    difference =
+        std::max(difference, std::abs(int{pixel0[c]} - int{pixel1[c]}));
+  }
+  return difference;
+}
+
+auto WriteHeatmapPixel(span<uint8_t> out, span<const uint8_t> pixel0,
+                       bool ignored, bool mismatch, int difference) -> void {
+  constexpr uint8_t kOpaque = 255;
+  if (mismatch) {
+    // Even the smallest mismatch must stand out from the dimmed background.
+    out[0] = static_cast<uint8_t>(128 + (difference / 2));
+    out[1] = 0;
+    out[2] = 0;
+  } else if (ignored) {
+    out[0] = 0;
+    out[1] = 0;
+    out[2] = 96;
+  } else {
+    // Average of the color channels (or the gray channel), dimmed.
+    const size_t color_channels = pixel0.size() >= 3 ? 3 : 1;
+    int sum = 0;
+    for (size_t c = 0; c < color_channels; ++c) {
+      sum += pixel0[c];
+    }
+    const auto gray =
+        static_cast<uint8_t>(sum / static_cast<int>(color_channels) / 4);
+    out[0] = gray;
+    out[1] = gray;
+    out[2] = gray;
+  }
+  out[3] = kOpaque;
+}
+
+auto CompareDecoded(const DecodedImage& image0, const DecodedImage& image1,
+                    const CompareOptions& options) -> Expected<CompareResult> {
+  if (options.heatmap.has_value() && options.heatmap_only_on_mismatch) {
+    CompareOptions without_heatmap = options;
+    without_heatmap.heatmap.reset();
+    Expected<CompareResult> result =
+        CompareDecoded(image0, image1, without_heatmap);
+    if (!result.has_value() || !result->same_dimensions ||
+        result->mismatch_count == 0) {
+      return result;
+    }
+    CompareOptions with_heatmap = options;
+    with_heatmap.heatmap_only_on_mismatch = false;
+    return CompareDecoded(image0, image1, with_heatmap);
+  }
+
+  CompareResult result;
+  result.same_dimensions = image0.width == image1.width &&
+                           image0.height == image1.height &&
+                           image0.channels == image1.channels;
+  if (!result.same_dimensions) {
+    return result;
+  }
+
+  const auto width = static_cast<size_t>(image0.width);
+  const auto channels = static_cast<size_t>(image0.channels);
+  const size_t row_size = width * channels;
+  const ToleranceKernel kernel(options.tolerance, channels);
+  const bool early_exit =
+      options.stop_at_first_mismatch && !options.heatmap.has_value();
+
+  vector<uint8_t> heatmap;
+  if (options.heatmap.has_value()) {
+    heatmap.resize(width * static_cast<size_t>(image0.height) * 4);
+  }
+
+  int min_x = image0.width;
+  int min_y = image0.height;
+  int max_x = -1;
+  int max_y = -1;
+  for (int y = 0; y < image0.height; ++y) {
+    const size_t row_offset = static_cast<size_t>(y) * row_size;
+    const span<const uint8_t> row0(image0.pixels.data() + row_offset, row_size);
+    const span<const uint8_t> row1(image1.pixels.data() + row_offset, row_size);
+
+    // Most rows match; only rows the kernel flags are examined per pixel,
+    // unless the heatmap needs every pixel.
+    if (heatmap.empty() && !kernel.Exceeds(row0, row1)) {
+      continue;
+    }
 
-  const string str_filename0 = png0.string();
-  const char* filename0 = str_filename0.c_str();
+    for (int x = 0; x < image0.width; ++x) {
+      const size_t pixel = static_cast<size_t>(x) * channels;
+      const span<const uint8_t> pixel0 = row0.subspan(pixel, channels);
+      const span<const uint8_t> pixel1 = row1.subspan(pixel, channels);
+      const bool ignored = IsIgnored(options.ignore_regions, x, y);
+      const bool mismatch = !ignored && kernel.Exceeds(pixel0, pixel1);
 
-  const string str_filename1 = png1.string();
-  const char* filename1 = str_filename1.c_str();
+      if (!heatmap.empty()) {
+        const size_t heatmap_offset =
+            ((static_cast<size_t>(y) * width) + static_cast<size_t>(x)) * 4;
+        WriteHeatmapPixel(span(heatmap).subspan(heatmap_offset, 4), pixel0,
+                          ignored, mismatch,
+                          mismatch ? MaxDifference(pixel0, pixel1) : 0);
+      }
 
-  stbi_uc* img1 = stbi_load(filename0, &width1, &height1, &channels1, 0);
-  stbi_uc* img2 = stbi_load(filename1, &width2, &height2, &channels2, 0);
+      if (!mismatch) {
+        continue;
+      }
 
-  if ((img1 == nullptr) || (img2 == nullptr)) {
+      ++result.mismatch_count;
+      if (early_exit) {
+        result.mismatch_bounds = {.x = x, .y = y, .width = 1, .height = 1};
+        return result;
+      }
+
+      min_x = std::min(min_x, x);
+      min_y = std::min(min_y, y);
+      max_x = std::max(max_x, x);
+      max_y = std::max(max_y, y);
+    }
+  }
+
+  if (result.mismatch_count > 0) {
+    result.mismatch_bounds = {.x = min_x,
+                              .y = min_y,
+                              .width = max_x - min_x + 1,
+                              .height = max_y - min_y + 1};
+  }
+
+  if (options.heatmap.has_value()) {
+    const ImageView view{.width = image0.width,
+                         .height = image0.height,
+                         .channels = 4,
+                         .pixels = std::as_bytes(span(heatmap)),
+                         .bottom_up = false};
+    Expected<void> written = WriteImage(*options.heatmap, view, {});
+    if (!written.has_value()) {
+      return unexpected(written.error());
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+auto GetExtension(ImageFormat format) -> string_view {
+  switch (format) {
+    case kQoi:
+      return ".qoi";
+    case kPam:
+      return ".pam";
+    case kPpm:
+      return ".ppm";
+    case kPng:
+      break;
+  }
+  return ".png";
+}
+
+auto EncodeImage(const ImageView& image, const EncodeOptions& options)
+    -> Expected<vector<byte>> {
+  return Encode(image, options);
+}
+
+auto AreIdentical(const path& png0, const path& png1) -> Expected<bool> {
+  Expected<CompareResult> result =
+      CompareImages(png0, png1, {.stop_at_first_mismatch = true});
+  if (!result.has_value()) {
+    return unexpected(result.error());
+  }
+
+  return result->Matches();
+}
+
+auto CompareImages(const path& png0, const path& png1,
+                   const CompareOptions& options) -> Expected<CompareResult> {
+  // Decoding dominates the comparison, so decode the second file on another
+  // thread while this one decodes the first.
+  future<optional<DecodedImage>> decoding1 =
+      async(launch::async, DecodeFile, png1);
+  optional<DecodedImage> decoded0 = DecodeFile(png0);
+  optional<DecodedImage> decoded1 = decoding1.get();
+
+  if (!decoded0.has_value() || !decoded1.has_value()) {
     return unexpected(MakeErrorCode(kStbErrorLoad));
   }
 
-  if (width1 != width2 || height1 != height2 || channels1 != channels2) {
-    return false;
+  return CompareDecoded(*decoded0, *decoded1, options);
+}
+
+auto CompareImages(const ImageView& image, const path& reference,
+                   const CompareOptions& options) -> Expected<CompareResult> {
+  if (!IsValid(image)) {
+    return unexpected(MakeErrorCode(kInvalidImage));
   }
 
-  auto sz_width1 = static_cast<size_t>(width1);
-  auto sz_height1 = static_cast<size_t>(height1);
-  auto sz_channels1 = static_cast<size_t>(channels1);
-  size_t size = sz_width1 * sz_height1 * sz_channels1;
-  span<const stbi_uc> span1(img1, size);
-  span<const stbi_uc> span2(img2, size);
-  bool identical = equal(span1.begin(), span1.end(), span2.begin());
+  future<optional<DecodedImage>> decoding =
+      async(launch::async, DecodeFile, reference);
 
-  stbi_image_free(img1);
-  stbi_image_free(img2);
+  // Meanwhile, bring the image into the top-down order decoders produce.
+  DecodedImage image0{.pixels = vector<uint8_t>(image.pixels.size()),
+                      .width = image.width,
+                      .height = image.height,
+                      .channels = image.channels};
+  const size_t row_size = image.pixels.size() / image.height;
+  for (int y = 0; y < image.height; ++y) {
+    const int source_row = image.bottom_up ? image.height - 1 - y : y;
+    std::memcpy(image0.pixels.data() + (static_cast<size_t>(y) * row_size),
+                image.pixels.data() + (static_cast<size_t>(source_row) *
+                                       row_size),
+                row_size);
+  }
+
+  optional<DecodedImage> image1 = decoding.get();
+  if (!image1.has_value()) {
+    return unexpected(MakeErrorCode(kStbErrorLoad));
+  }
 
-  return identical;
+  return CompareDecoded(image0, *image1, options);
 }
 
-auto CaptureScreenshot(const optional<path>& dest) -> Expected<void> {
-  const path png_path = dest.value_or(temp_directory_path() / "screenshot.png");
+auto CaptureScreenshot(const optional<path>& dest,
+                       const EncodeOptions& options) -> Expected<void> {
+  const path file = dest.value_or(
+      temp_directory_path() /
+      ("screenshot" + std::string(GetExtension(options.format))));
   array<GLint, 4> viewport{};
   glGetIntegerv(GL_VIEWPORT, viewport.data());
   CheckGLError();
@@ -90,16 +381,13 @@ auto CaptureScreenshot(const optional<path>& dest) -> Expected<void> {
   glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
   CheckGLError();
 
-  stbi_flip_vertically_on_write(static_cast<int>(true));
-
-  const string str_filename = png_path.string();
-  const char* filename = str_filename.c_str();
-  void* data = pixels.data();
-  if (stbi_write_png(filename, width, height, 4, data, width * 4) == 0) {
-    return unexpected(MakeErrorCode(kStbErrorWritePng));
-  }
-
-  return {};
+  return WriteImage(file,
+                    {.width = width,
+                     .height = height,
+                     .channels = 4,
+                     .pixels = pixels,
+                     .bottom_up = true},
+                    options);
 }
 
 }  // namespace graphics_engine::image
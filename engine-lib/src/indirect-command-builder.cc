@@ -0,0 +1,150 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "indirect-command-builder.h"
+
+#include <cstdint>
+#include <iostream>
+
+#include "buffer-orphan.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+
+using graphics_engine::buffer_orphan::OrphanBuffer;
+using graphics_engine::gl_types::GLDataType;
+using graphics_engine::gl_types::GLDrawMode;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BufferSubData;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::gl_wrappers::MultiDrawArraysIndirect;
+using graphics_engine::gl_wrappers::MultiDrawElementsIndirect;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::span;
+
+namespace graphics_engine::indirect_command_builder {
+
+// OpenGL reads these records straight out of the indirect buffer.
+static_assert(sizeof(DrawArraysIndirectCommand) == 4 * sizeof(std::uint32_t),
+              "DrawArraysIndirectCommand does not match the GL layout!");
+static_assert(sizeof(DrawElementsIndirectCommand) == 5 * sizeof(std::uint32_t),
+              "DrawElementsIndirectCommand does not match the GL layout!");
+
+IndirectCommandBuilder::~IndirectCommandBuilder() {
+  if (buffer_ != 0) {
+    (void)DeleteBuffers(1, &buffer_);
+  }
+}
+
+auto IndirectCommandBuilder::AddDrawArrays(
+    const DrawArraysIndirectCommand& command) -> void {
+  arrays_commands_.push_back(command);
+}
+
+auto IndirectCommandBuilder::AddDrawElements(
+    const DrawElementsIndirectCommand& command) -> void {
+  elements_commands_.push_back(command);
+}
+
+auto IndirectCommandBuilder::Clear() -> void {
+  arrays_commands_.clear();
+  elements_commands_.clear();
+}
+
+auto IndirectCommandBuilder::GetDrawArraysCommands() const
+    -> span<const DrawArraysIndirectCommand> {
+  return arrays_commands_;
+}
+
+auto IndirectCommandBuilder::GetDrawElementsCommands() const
+    -> span<const DrawElementsIndirectCommand> {
+  return elements_commands_;
+}
+
+auto IndirectCommandBuilder::Upload() -> Expected<void> {
+  if (buffer_ == 0) {
+    Expected<void> result = GenBuffers(1, &buffer_);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  Expected<void> result = BindBuffer(kDrawIndirect, buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  const auto arrays_size = static_cast<long long int>(
+      arrays_commands_.size() * sizeof(DrawArraysIndirectCommand));
+  const auto elements_size = static_cast<long long int>(
+      elements_commands_.size() * sizeof(DrawElementsIndirectCommand));
+  const long long int size = arrays_size + elements_size;
+
+  result = OrphanBuffer(kDrawIndirect, size, buffer_size_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  if (arrays_size > 0) {
+    result = BufferSubData(kDrawIndirect, 0, arrays_size,
+                           arrays_commands_.data());
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  if (elements_size > 0) {
+    result = BufferSubData(kDrawIndirect, arrays_size, elements_size,
+                           elements_commands_.data());
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  return {};
+}
+
+auto IndirectCommandBuilder::Draw(GLDrawMode mode, GLDataType index_type)
+    -> Expected<void> {
+  if (arrays_commands_.empty() && elements_commands_.empty()) {
+    return {};
+  }
+
+  Expected<void> result = Upload();
+  if (!result.has_value()) {
+    cerr << "Uploading indirect commands failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return result;
+  }
+
+  if (!arrays_commands_.empty()) {
+    result = MultiDrawArraysIndirect(
+        mode, 0, static_cast<int>(arrays_commands_.size()), 0);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  if (!elements_commands_.empty()) {
+    const auto elements_offset = static_cast<long long int>(
+        arrays_commands_.size() * sizeof(DrawArraysIndirectCommand));
+    result = MultiDrawElementsIndirect(
+        mode, index_type, elements_offset,
+        static_cast<int>(elements_commands_.size()), 0);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  return {};
+}
+
+auto CreateIIndirectCommandBuilder() -> IIndirectCommandBuilderPtr {
+  return std::make_unique<IndirectCommandBuilder>();
+}
+
+}  // namespace graphics_engine::indirect_command_builder
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_INDIRECT_COMMAND_BUILDER_H_
+#define ENGINE_LIB_INDIRECT_COMMAND_BUILDER_H_
+
+#include <vector>
+
+#include "graphics-engine/i-indirect-command-builder.h"
+
+namespace graphics_engine::indirect_command_builder {
+
+class IndirectCommandBuilder : public IIndirectCommandBuilder {
+ public:
+  IndirectCommandBuilder() = default;
+  ~IndirectCommandBuilder() override;
+
+  IndirectCommandBuilder(const IndirectCommandBuilder&) = delete;
+  IndirectCommandBuilder(IndirectCommandBuilder&&) = delete;
+  auto operator=(const IndirectCommandBuilder&)
+      -> IndirectCommandBuilder& = delete;
+  auto operator=(IndirectCommandBuilder&&) -> IndirectCommandBuilder& = delete;
+
+  auto AddDrawArrays(const DrawArraysIndirectCommand& command) -> void override;
+  auto AddDrawElements(const DrawElementsIndirectCommand& command)
+      -> void override;
+  auto Clear() -> void override;
+
+  [[nodiscard]] auto GetDrawArraysCommands() const
+      -> std::span<const DrawArraysIndirectCommand> override;
+  [[nodiscard]] auto GetDrawElementsCommands() const
+      -> std::span<const DrawElementsIndirectCommand> override;
+
+  [[nodiscard]] auto Draw(gl_types::GLDrawMode mode,
+                          gl_types::GLDataType index_type)
+      -> types::Expected<void> override;
+
+ private:
+  [[nodiscard]] auto Upload() -> types::Expected<void>;
+
+  std::vector<DrawArraysIndirectCommand> arrays_commands_;
+  std::vector<DrawElementsIndirectCommand> elements_commands_;
+  unsigned int buffer_{};
+  long long int buffer_size_{};
+};
+
+}  // namespace graphics_engine::indirect_command_builder
+
+#endif  // ENGINE_LIB_INDIRECT_COMMAND_BUILDER_H_
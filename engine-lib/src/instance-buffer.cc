@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "instance-buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "buffer-offset.h"
+#include "buffer-orphan.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataType;
+
+using graphics_engine::buffer_offset::OffsetToPointer;
+using graphics_engine::buffer_orphan::OrphanBuffer;
+using graphics_engine::gl_types::GLDataType;
+using graphics_engine::gl_types::GLDrawMode;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BufferSubData;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::DrawArraysInstanced;
+using graphics_engine::gl_wrappers::DrawElementsInstanced;
+using graphics_engine::gl_wrappers::EnableVertexAttribArray;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::gl_wrappers::VertexAttribDivisor;
+using graphics_engine::gl_wrappers::VertexAttribPointer;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::size_t;
+using std::span;
+
+namespace graphics_engine::instance_buffer {
+
+namespace {
+
+constexpr unsigned int kTransformColumns = 4;
+constexpr int kColumnFloats = 4;
+
+}  // namespace
+
+// The attributes read the instances straight out of the buffer.
+static_assert(sizeof(InstanceData) == 20 * sizeof(float),
+              "InstanceData must be tightly packed!");
+
+InstanceBuffer::~InstanceBuffer() {
+  if (buffer_ != 0) {
+    (void)DeleteBuffers(1, &buffer_);
+  }
+}
+
+auto InstanceBuffer::Add(const InstanceData& instance) -> void {
+  instances_.push_back(instance);
+}
+
+auto InstanceBuffer::Clear() -> void { instances_.clear(); }
+
+auto InstanceBuffer::GetInstances() const -> span<const InstanceData> {
+  return instances_;
+}
+
+auto InstanceBuffer::EnsureBuffer() -> Expected<void> {
+  if (buffer_ == 0) {
+    Expected<void> result = GenBuffers(1, &buffer_);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  return BindBuffer(kArray, buffer_);
+}
+
+auto InstanceBuffer::BindAttributes(unsigned int first_location)
+    -> Expected<void> {
+  Expected<void> result = EnsureBuffer();
+  if (!result.has_value()) {
+    return result;
+  }
+
+  constexpr int kStride = sizeof(InstanceData);
+  for (unsigned int column = 0; column <= kTransformColumns; ++column) {
+    // The location after the transform columns holds the color.
+    const size_t offset =
+        column < kTransformColumns
+            ? offsetof(InstanceData, transform) +
+                  (column * kColumnFloats * sizeof(float))
+            : offsetof(InstanceData, color);
+    const unsigned int location = first_location + column;
+
+    result = VertexAttribPointer(
+        location, kColumnFloats, kFloat, 0, kStride,
+        OffsetToPointer(static_cast<long long int>(offset)));
+    if (!result.has_value()) {
+      return result;
+    }
+
+    result = EnableVertexAttribArray(location);
+    if (!result.has_value()) {
+      return result;
+    }
+
+    result = VertexAttribDivisor(location, 1);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  return {};
+}
+
+auto InstanceBuffer::Upload() -> Expected<void> {
+  Expected<void> result = EnsureBuffer();
+  if (!result.has_value()) {
+    return result;
+  }
+
+  const auto size =
+      static_cast<long long int>(instances_.size() * sizeof(InstanceData));
+
+  result = OrphanBuffer(kArray, size, buffer_size_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  return BufferSubData(kArray, 0, size, instances_.data());
+}
+
+auto InstanceBuffer::DrawArrays(GLDrawMode mode, int first, int count)
+    -> Expected<void> {
+  if (instances_.empty()) {
+    return {};
+  }
+
+  Expected<void> result = Upload();
+  if (!result.has_value()) {
+    cerr << "Uploading instances failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return result;
+  }
+
+  return DrawArraysInstanced(mode, first, count,
+                             static_cast<int>(instances_.size()));
+}
+
+auto InstanceBuffer::DrawElements(GLDrawMode mode, int count, GLDataType type,
+                                  long long int index_offset)
+    -> Expected<void> {
+  if (instances_.empty()) {
+    return {};
+  }
+
+  Expected<void> result = Upload();
+  if (!result.has_value()) {
+    cerr << "Uploading instances failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return result;
+  }
+
+  return DrawElementsInstanced(mode, count, type, index_offset,
+                               static_cast<int>(instances_.size()));
+}
+
+auto CreateIInstanceBuffer() -> IInstanceBufferPtr {
+  return std::make_unique<InstanceBuffer>();
+}
+
+}  // namespace graphics_engine::instance_buffer
@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_INSTANCE_BUFFER_H_
+#define ENGINE_LIB_INSTANCE_BUFFER_H_
+
+#include <vector>
+
+#include "graphics-engine/i-instance-buffer.h"
+
+namespace graphics_engine::instance_buffer {
+
+class InstanceBuffer : public IInstanceBuffer {
+ public:
+  InstanceBuffer() = default;
+  ~InstanceBuffer() override;
+
+  InstanceBuffer(const InstanceBuffer&) = delete;
+  InstanceBuffer(InstanceBuffer&&) = delete;
+  auto operator=(const InstanceBuffer&) -> InstanceBuffer& = delete;
+  auto operator=(InstanceBuffer&&) -> InstanceBuffer& = delete;
+
+  auto Add(const InstanceData& instance) -> void override;
+  auto Clear() -> void override;
+
+  [[nodiscard]] auto GetInstances() const
+      -> std::span<const InstanceData> override;
+
+  [[nodiscard]] auto BindAttributes(unsigned int first_location)
+      -> types::Expected<void> override;
+
+  [[nodiscard]] auto DrawArrays(gl_types::GLDrawMode mode, int first,
+                                int count) -> types::Expected<void> override;
+  [[nodiscard]] auto DrawElements(gl_types::GLDrawMode mode, int count,
+                                  gl_types::GLDataType type,
+                                  long long int index_offset)
+      -> types::Expected<void> override;
+
+ private:
+  [[nodiscard]] auto EnsureBuffer() -> types::Expected<void>;
+  [[nodiscard]] auto Upload() -> types::Expected<void>;
+
+  std::vector<InstanceData> instances_;
+  unsigned int buffer_{};
+  long long int buffer_size_{};
+};
+
+}  // namespace graphics_engine::instance_buffer
+
+#endif  // ENGINE_LIB_INSTANCE_BUFFER_H_
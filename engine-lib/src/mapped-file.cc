@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "mapped-file.h"
+
+#include <cerrno>
+#include <iostream>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "error.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::cerr;
+using std::size_t;
+using std::unexpected;
+using std::filesystem::path;
+
+namespace graphics_engine::mapped_file {
+
+MappedFile::~MappedFile() { Close(); }
+
+#ifdef _WIN32
+
+auto MappedFile::Open(const path& file) -> Expected<void> {
+  Close();
+  file_ = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                      OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  LARGE_INTEGER size{};
+  if (file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(file_, &size) ||
+      size.QuadPart == 0) {
+    cerr << "Failed to open " << file << " for mapping\n";
+    Close();
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  const void* view = mapping_ == nullptr
+                         ? nullptr
+                         : MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    cerr << "Failed to map " << file << ": error " << GetLastError() << '\n';
+    Close();
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  data_ = static_cast<const byte*>(view);
+  size_ = static_cast<size_t>(size.QuadPart);
+  return {};
+}
+
+auto MappedFile::Close() -> void {
+  if (data_ != nullptr) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_ != nullptr) {
+    CloseHandle(mapping_);
+  }
+  if (file_ != nullptr && file_ != INVALID_HANDLE_VALUE) {
+    CloseHandle(file_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+  mapping_ = nullptr;
+  file_ = nullptr;
+}
+
+#else
+
+auto MappedFile::Open(const path& file) -> Expected<void> {
+  Close();
+  const int descriptor = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+  if (descriptor < 0) {
+    cerr << "Failed to open " << file << ": "
+         << std::generic_category().message(errno) << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  const off_t size = lseek(descriptor, 0, SEEK_END);
+  void* view = size > 0 ? mmap(nullptr, static_cast<size_t>(size), PROT_READ,
+                               MAP_PRIVATE, descriptor, 0)
+                        : MAP_FAILED;
+  const int error = errno;
+  // The mapping keeps the file alive on its own.
+  close(descriptor);
+  if (view == MAP_FAILED) {
+    cerr << "Failed to map " << file << ": "
+         << (size > 0 ? std::generic_category().message(error) : "empty file")
+         << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+
+  // Callers read the whole file front to back; let the kernel read ahead.
+  (void)madvise(view, static_cast<size_t>(size), MADV_SEQUENTIAL);
+  (void)madvise(view, static_cast<size_t>(size), MADV_WILLNEED);
+
+  data_ = static_cast<const byte*>(view);
+  size_ = static_cast<size_t>(size);
+  return {};
+}
+
+auto MappedFile::Close() -> void {
+  if (data_ != nullptr) {
+    // NOLINTNEXTLINE(*-const-cast)
+    munmap(const_cast<byte*>(data_), size_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+}
+
+#endif
+
+}  // namespace graphics_engine::mapped_file
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_MAPPED_FILE_H_
+#define ENGINE_LIB_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::mapped_file {
+
+// A read-only memory mapping of a whole file. Pages are read on first touch,
+// so opening is cheap however large the file is.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  auto operator=(const MappedFile&) -> MappedFile& = delete;
+  auto operator=(MappedFile&&) -> MappedFile& = delete;
+
+  // Maps `file`, replacing any earlier mapping. Returns kFileIoError if the
+  // file can't be opened or mapped, or is empty.
+  [[nodiscard]] auto Open(const std::filesystem::path& file)
+      -> types::Expected<void>;
+
+  [[nodiscard]] auto GetBytes() const -> std::span<const std::byte> {
+    return {data_, size_};
+  }
+
+ private:
+  auto Close() -> void;
+
+  const std::byte* data_{};
+  std::size_t size_{};
+#ifdef _WIN32
+  void* file_{};
+  void* mapping_{};
+#endif
+};
+
+}  // namespace graphics_engine::mapped_file
+
+#endif  // ENGINE_LIB_MAPPED_FILE_H_
@@ -0,0 +1,381 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "mesh-arena.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <vector>
+
+#include "error.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::gl_types::GLDrawMode;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::BufferSubData;
+using graphics_engine::gl_wrappers::CopyBufferSubData;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::DeleteVertexArrays;
+using graphics_engine::gl_wrappers::DrawElementsBaseVertex;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::gl_wrappers::GenVertexArrays;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::cerr;
+using std::optional;
+using std::size_t;
+using std::span;
+using std::uint32_t;
+using std::unexpected;
+using std::vector;
+
+namespace graphics_engine::mesh_arena {
+
+namespace {
+
+constexpr long long int kIndexSize = sizeof(uint32_t);
+
+// One live range of a buffer being packed, in bytes.
+struct Move {
+  long long int from;
+  long long int to;
+  long long int size;
+};
+
+// Pack the ranges of `buffer` described by `moves` (ordered by `from`)
+// through `scratch`. glCopyBufferSubData forbids overlapping copies within one
+// buffer, so the moved ranges are gathered in the scratch buffer and copied
+// back in one go. Ranges before the first gap are already in place.
+auto PackBuffer(unsigned int buffer, unsigned int scratch,
+                span<const Move> moves) -> Expected<void> {
+  auto first_moved = std::ranges::find_if(
+      moves, [](const Move& move) { return move.from != move.to; });
+  if (first_moved == moves.end()) {
+    return {};
+  }
+
+  Expected<void> result = BindBuffer(kCopyRead, buffer);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BindBuffer(kCopyWrite, scratch);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  const long long int start = first_moved->to;
+  for (auto it = first_moved; it != moves.end(); ++it) {
+    result = CopyBufferSubData(kCopyRead, kCopyWrite, it->from,
+                               it->to - start, it->size);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+
+  result = BindBuffer(kCopyRead, scratch);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BindBuffer(kCopyWrite, buffer);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  const long long int end = moves.back().to + moves.back().size;
+  return CopyBufferSubData(kCopyRead, kCopyWrite, 0, start, end - start);
+}
+
+}  // namespace
+
+MeshArena::MeshArena(int vertex_stride, long long int vertex_capacity,
+                     long long int index_capacity)
+    : vertex_stride_(vertex_stride),
+      vertex_ranges_(vertex_capacity),
+      index_ranges_(index_capacity) {}
+
+MeshArena::~MeshArena() {
+  for (unsigned int buffer : {vertex_buffer_, index_buffer_}) {
+    if (buffer != 0) {
+      (void)DeleteBuffers(1, &buffer);
+    }
+  }
+
+  if (vertex_array_ != 0) {
+    (void)DeleteVertexArrays(1, &vertex_array_);
+  }
+}
+
+auto MeshArena::Initialize() -> Expected<void> {
+  Expected<void> result = GenVertexArrays(1, &vertex_array_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = GenBuffers(1, &vertex_buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = GenBuffers(1, &index_buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BindVertexArray(vertex_array_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BindBuffer(kArray, vertex_buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BufferData(kArray, vertex_ranges_.GetCapacity() * vertex_stride_,
+                      nullptr, kStaticDraw);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  // The element array binding is recorded in the vertex array.
+  result = BindBuffer(kElementArray, index_buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  return BufferData(kElementArray, index_ranges_.GetCapacity() * kIndexSize,
+                    nullptr, kStaticDraw);
+}
+
+auto MeshArena::Add(span<const byte> vertices, span<const uint32_t> indices)
+    -> Expected<MeshHandle> {
+  const auto vertex_count =
+      static_cast<long long int>(vertices.size()) / vertex_stride_;
+  const auto index_count = static_cast<long long int>(indices.size());
+  if (vertex_count == 0 || index_count == 0 ||
+      vertices.size() % static_cast<size_t>(vertex_stride_) != 0 ||
+      std::ranges::any_of(indices, [vertex_count](uint32_t index) {
+        return index >= vertex_count;
+      })) {
+    cerr << "MeshArena::Add failed: malformed vertices or indices\n";
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  optional<long long int> base_vertex = vertex_ranges_.Allocate(vertex_count);
+  if (!base_vertex.has_value()) {
+    return unexpected(MakeErrorCode(kMeshArenaFull));
+  }
+
+  optional<long long int> first_index = index_ranges_.Allocate(index_count);
+  if (!first_index.has_value()) {
+    vertex_ranges_.Free(*base_vertex, vertex_count);
+    return unexpected(MakeErrorCode(kMeshArenaFull));
+  }
+
+  const MeshRange range{.base_vertex = static_cast<int>(*base_vertex),
+                        .vertex_count = static_cast<int>(vertex_count),
+                        .first_index = static_cast<unsigned int>(*first_index),
+                        .index_count = static_cast<int>(index_count)};
+  Expected<void> result = Upload(range, vertices, indices);
+  if (!result.has_value()) {
+    vertex_ranges_.Free(*base_vertex, vertex_count);
+    index_ranges_.Free(*first_index, index_count);
+    return unexpected(result.error());
+  }
+
+  const MeshHandle handle = next_handle_++;
+  meshes_.emplace(handle, range);
+  return handle;
+}
+
+auto MeshArena::Upload(const MeshRange& range, span<const byte> vertices,
+                       span<const uint32_t> indices) -> Expected<void> {
+  Expected<void> result = Bind();
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BufferSubData(
+      kArray, static_cast<long long int>(range.base_vertex) * vertex_stride_,
+      static_cast<long long int>(vertices.size()), vertices.data());
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BindBuffer(kElementArray, index_buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  return BufferSubData(kElementArray, range.first_index * kIndexSize,
+                       static_cast<long long int>(indices.size_bytes()),
+                       indices.data());
+}
+
+auto MeshArena::Remove(MeshHandle mesh) -> Expected<void> {
+  auto it = meshes_.find(mesh);
+  if (it == meshes_.end()) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  vertex_ranges_.Free(it->second.base_vertex, it->second.vertex_count);
+  index_ranges_.Free(it->second.first_index, it->second.index_count);
+  meshes_.erase(it);
+  return {};
+}
+
+auto MeshArena::GetRange(MeshHandle mesh) const -> Expected<MeshRange> {
+  auto it = meshes_.find(mesh);
+  if (it == meshes_.end()) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  return it->second;
+}
+
+auto MeshArena::Bind() -> Expected<void> {
+  Expected<void> result = BindVertexArray(vertex_array_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  return BindBuffer(kArray, vertex_buffer_);
+}
+
+auto MeshArena::Draw(MeshHandle mesh, GLDrawMode mode) -> Expected<void> {
+  Expected<MeshRange> range = GetRange(mesh);
+  if (!range.has_value()) {
+    return unexpected(range.error());
+  }
+
+  Expected<void> result = BindVertexArray(vertex_array_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  return DrawElementsBaseVertex(mode, range->index_count, kUnsignedInt,
+                                range->first_index * kIndexSize,
+                                range->base_vertex);
+}
+
+auto MeshArena::Compact() -> Expected<void> {
+  vector<MeshRange*> by_vertex;
+  vector<MeshRange*> by_index;
+  by_vertex.reserve(meshes_.size());
+  by_index.reserve(meshes_.size());
+  for (auto& [handle, range] : meshes_) {
+    by_vertex.push_back(&range);
+    by_index.push_back(&range);
+  }
+  std::ranges::sort(by_vertex, {}, &MeshRange::base_vertex);
+  std::ranges::sort(by_index, {}, &MeshRange::first_index);
+
+  vector<Move> vertex_moves;
+  vector<Move> index_moves;
+  vertex_moves.reserve(meshes_.size());
+  index_moves.reserve(meshes_.size());
+  const auto stride = static_cast<long long int>(vertex_stride_);
+  long long int packed_vertices = 0;
+  for (const MeshRange* range : by_vertex) {
+    vertex_moves.push_back({.from = range->base_vertex * stride,
+                            .to = packed_vertices * stride,
+                            .size = range->vertex_count * stride});
+    packed_vertices += range->vertex_count;
+  }
+  long long int packed_indices = 0;
+  for (const MeshRange* range : by_index) {
+    index_moves.push_back({.from = range->first_index * kIndexSize,
+                           .to = packed_indices * kIndexSize,
+                           .size = range->index_count * kIndexSize});
+    packed_indices += range->index_count;
+  }
+
+  if (!meshes_.empty()) {
+    unsigned int scratch{};
+    Expected<void> result = GenBuffers(1, &scratch);
+    if (!result.has_value()) {
+      return result;
+    }
+
+    result = BindBuffer(kCopyWrite, scratch);
+    if (result.has_value()) {
+      result = BufferData(kCopyWrite,
+                          std::max(packed_vertices * stride,
+                                   packed_indices * kIndexSize),
+                          nullptr, kStreamCopy);
+    }
+    if (result.has_value()) {
+      result = PackBuffer(vertex_buffer_, scratch, vertex_moves);
+    }
+    if (result.has_value()) {
+      result = PackBuffer(index_buffer_, scratch, index_moves);
+    }
+
+    (void)DeleteBuffers(1, &scratch);
+    if (!result.has_value()) {
+      cerr << "Compacting the mesh arena failed with error code "
+           << result.error().value() << ": " << result.error().message()
+           << '\n';
+      return result;
+    }
+  }
+
+  for (size_t i = 0; i < by_vertex.size(); ++i) {
+    by_vertex[i]->base_vertex =
+        static_cast<int>(vertex_moves[i].to / stride);
+  }
+  for (size_t i = 0; i < by_index.size(); ++i) {
+    by_index[i]->first_index =
+        static_cast<unsigned int>(index_moves[i].to / kIndexSize);
+  }
+  vertex_ranges_.Reset(packed_vertices);
+  index_ranges_.Reset(packed_indices);
+  return {};
+}
+
+auto MeshArena::GetStats() const -> MeshArenaStats {
+  return {.mesh_count = meshes_.size(),
+          .used_vertices = vertex_ranges_.GetUsed(),
+          .used_indices = index_ranges_.GetUsed(),
+          .free_vertex_blocks = vertex_ranges_.GetFreeBlockCount(),
+          .free_index_blocks = index_ranges_.GetFreeBlockCount()};
+}
+
+auto MeshArena::GetVertexArrayId() const -> unsigned int {
+  return vertex_array_;
+}
+
+auto CreateIMeshArena(int vertex_stride, long long int vertex_capacity,
+                      long long int index_capacity) -> Expected<IMeshArenaPtr> {
+  if (vertex_stride <= 0 || vertex_capacity <= 0 || index_capacity <= 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  auto arena = std::make_unique<MeshArena>(vertex_stride, vertex_capacity,
+                                           index_capacity);
+  Expected<void> result = arena->Initialize();
+  if (!result.has_value()) {
+    cerr << "Mesh arena initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+
+  return arena;
+}
+
+}  // namespace graphics_engine::mesh_arena
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_MESH_ARENA_H_
+#define ENGINE_LIB_MESH_ARENA_H_
+
+#include <unordered_map>
+
+#include "graphics-engine/i-mesh-arena.h"
+#include "graphics-engine/types.h"
+#include "range-allocator.h"
+
+namespace graphics_engine::mesh_arena {
+
+class MeshArena : public IMeshArena {
+ public:
+  MeshArena(int vertex_stride, long long int vertex_capacity,
+            long long int index_capacity);
+  ~MeshArena() override;
+
+  MeshArena(const MeshArena&) = delete;
+  MeshArena(MeshArena&&) = delete;
+  auto operator=(const MeshArena&) -> MeshArena& = delete;
+  auto operator=(MeshArena&&) -> MeshArena& = delete;
+
+  [[nodiscard]] auto Initialize() -> types::Expected<void>;
+
+  [[nodiscard]] auto Add(std::span<const std::byte> vertices,
+                         std::span<const std::uint32_t> indices)
+      -> types::Expected<MeshHandle> override;
+  [[nodiscard]] auto Remove(MeshHandle mesh) -> types::Expected<void> override;
+  [[nodiscard]] auto GetRange(MeshHandle mesh) const
+      -> types::Expected<MeshRange> override;
+
+  [[nodiscard]] auto Bind() -> types::Expected<void> override;
+  [[nodiscard]] auto Draw(MeshHandle mesh, gl_types::GLDrawMode mode)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto Compact() -> types::Expected<void> override;
+
+  [[nodiscard]] auto GetStats() const -> MeshArenaStats override;
+  [[nodiscard]] auto GetVertexArrayId() const -> unsigned int override;
+
+ private:
+  [[nodiscard]] auto Upload(const MeshRange& range,
+                            std::span<const std::byte> vertices,
+                            std::span<const std::uint32_t> indices)
+      -> types::Expected<void>;
+
+  int vertex_stride_;
+  range_allocator::RangeAllocator vertex_ranges_;
+  range_allocator::RangeAllocator index_ranges_;
+  std::unordered_map<MeshHandle, MeshRange> meshes_;
+  MeshHandle next_handle_{1};
+  unsigned int vertex_array_{};
+  unsigned int vertex_buffer_{};
+  unsigned int index_buffer_{};
+};
+
+}  // namespace graphics_engine::mesh_arena
+
+#endif  // ENGINE_LIB_MESH_ARENA_H_
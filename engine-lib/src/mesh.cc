@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "graphics-engine/mesh.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "error.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::gl_types::GLDataType;
+using graphics_engine::gl_types::GLDataUsagePattern;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::numeric_limits;
+using std::size_t;
+using std::span;
+using std::uint16_t;
+using std::uint32_t;
+using std::unexpected;
+using std::vector;
+
+namespace graphics_engine::mesh {
+
+auto SelectIndexType(size_t vertex_count) -> GLDataType {
+  return vertex_count <= numeric_limits<uint16_t>::max() ? kUnsignedShort
+                                                          : kUnsignedInt;
+}
+
+auto UploadIndices(span<const uint32_t> indices, size_t vertex_count,
+                   GLDataUsagePattern usage) -> Expected<IndexBuffer> {
+  if (indices.size() > static_cast<size_t>(numeric_limits<int>::max()) ||
+      std::ranges::any_of(indices, [vertex_count](uint32_t index) {
+        return index >= vertex_count;
+      })) {
+    cerr << "UploadIndices failed: an index is out of range\n";
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  IndexBuffer index_buffer{.type = SelectIndexType(vertex_count),
+                           .count = static_cast<int>(indices.size())};
+
+  Expected<void> result = GenBuffers(1, &index_buffer.buffer);
+  if (!result.has_value()) {
+    return unexpected(result.error());
+  }
+
+  result = BindBuffer(kElementArray, index_buffer.buffer);
+  if (result.has_value()) {
+    if (index_buffer.type == kUnsignedShort) {
+      vector<uint16_t> narrowed(indices.size());
+      std::ranges::transform(indices, narrowed.begin(), [](uint32_t index) {
+        return static_cast<uint16_t>(index);
+      });
+      result = BufferData(kElementArray,
+                          static_cast<long long int>(narrowed.size() *
+                                                     sizeof(uint16_t)),
+                          narrowed.data(), usage);
+    } else {
+      result = BufferData(kElementArray,
+                          static_cast<long long int>(indices.size_bytes()),
+                          indices.data(), usage);
+    }
+  }
+
+  if (!result.has_value()) {
+    (void)DeleteBuffers(1, &index_buffer.buffer);
+    return unexpected(result.error());
+  }
+
+  return index_buffer;
+}
+
+}  // namespace graphics_engine::mesh
@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "offscreen-target.h"
+
+#include <iostream>
+
+#include "error.h"
+#include "glad/glad.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::error::PollGLError;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::unexpected;
+
+namespace graphics_engine::offscreen_target {
+
+OffscreenTarget::~OffscreenTarget() { Release(); }
+
+auto OffscreenTarget::Release() -> void {
+  if (framebuffer_ != 0) {
+    glDeleteFramebuffers(1, &framebuffer_);
+  }
+  if (color_ != 0) {
+    glDeleteRenderbuffers(1, &color_);
+  }
+  if (depth_stencil_ != 0) {
+    glDeleteRenderbuffers(1, &depth_stencil_);
+  }
+  framebuffer_ = 0;
+  color_ = 0;
+  depth_stencil_ = 0;
+  width_ = 0;
+  height_ = 0;
+}
+
+auto OffscreenTarget::Initialize(int width, int height) -> Expected<void> {
+  Release();
+  if (width <= 0 || height <= 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  GLint previous = 0;
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+
+  glGenFramebuffers(1, &framebuffer_);
+  glGenRenderbuffers(1, &color_);
+  glGenRenderbuffers(1, &depth_stencil_);
+  glBindRenderbuffer(GL_RENDERBUFFER, color_);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  glBindRenderbuffer(GL_RENDERBUFFER, depth_stencil_);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                            GL_RENDERBUFFER, color_);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                            GL_RENDERBUFFER, depth_stencil_);
+  const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous));
+
+  if (GLenum error = PollGLError("glRenderbufferStorage");
+      error != GL_NO_ERROR) {
+    cerr << "Creating an offscreen target failed with error code " << error
+         << '\n';
+    Release();
+    switch (error) {
+      default:
+        return unexpected(MakeErrorCode(kGLError));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+      case GL_OUT_OF_MEMORY:
+        return unexpected(MakeErrorCode(kGLErrorOutOfMemory));
+    }
+  }
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    cerr << "Offscreen framebuffer is incomplete: " << status << '\n';
+    Release();
+    return unexpected(MakeErrorCode(kGLError));
+  }
+
+  width_ = width;
+  height_ = height;
+  return {};
+}
+
+auto OffscreenTarget::Bind() const -> Expected<void> {
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+  glViewport(0, 0, width_, height_);
+  if (GLenum error = PollGLError("glBindFramebuffer"); error != GL_NO_ERROR) {
+    cerr << "glBindFramebuffer failed with error code " << error << '\n';
+    return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+  }
+
+  return {};
+}
+
+}  // namespace graphics_engine::offscreen_target
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_OFFSCREEN_TARGET_H_
+#define ENGINE_LIB_OFFSCREEN_TARGET_H_
+
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::offscreen_target {
+
+// A framebuffer with an RGBA8 color and a depth/stencil renderbuffer, for
+// rendering at a fixed size independent of the window.
+class OffscreenTarget {
+ public:
+  OffscreenTarget() = default;
+  ~OffscreenTarget();
+
+  OffscreenTarget(const OffscreenTarget&) = delete;
+  OffscreenTarget(OffscreenTarget&&) = delete;
+  auto operator=(const OffscreenTarget&) -> OffscreenTarget& = delete;
+  auto operator=(OffscreenTarget&&) -> OffscreenTarget& = delete;
+
+  // (Re)creates the attachments at the given size.
+  [[nodiscard]] auto Initialize(int width, int height)
+      -> types::Expected<void>;
+
+  // Binds the framebuffer for drawing and reading and sets the viewport to
+  // cover it.
+  [[nodiscard]] auto Bind() const -> types::Expected<void>;
+
+  [[nodiscard]] auto GetWidth() const -> int { return width_; }
+  [[nodiscard]] auto GetHeight() const -> int { return height_; }
+
+ private:
+  auto Release() -> void;
+
+  unsigned int framebuffer_{};
+  unsigned int color_{};
+  unsigned int depth_stencil_{};
+  int width_{};
+  int height_{};
+};
+
+}  // namespace graphics_engine::offscreen_target
+
+#endif  // ENGINE_LIB_OFFSCREEN_TARGET_H_
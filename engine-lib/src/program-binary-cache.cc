@@ -0,0 +1,242 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "program-binary-cache.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "error.h"
+#include "glad/glad.h"
+
+using graphics_engine::error::CheckGLCall;
+using graphics_engine::gl_types::GLShaderType;
+using graphics_engine::types::ShaderSourceMap;
+
+using std::array;
+using std::cerr;
+using std::nullopt;
+using std::optional;
+using std::size_t;
+using std::span;
+using std::string;
+using std::string_view;
+using std::uint32_t;
+using std::uint64_t;
+using std::uint8_t;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::program_binary_cache {
+
+namespace {
+
+// Entry layout, integers little-endian: the magic, u64 key, u32 binary
+// format, u32 binary size, u64 checksum of the binary, then the binary.
+constexpr string_view kMagic = "GEPRGBN1";
+constexpr size_t kHeaderSize = 32;
+
+constexpr uint64_t kFnvOffsetBasis = 0xCBF29CE484222325ULL;
+constexpr uint64_t kFnvPrime = 0x100000001B3ULL;
+
+auto Fnv1a(uint64_t hash, span<const uint8_t> data) -> uint64_t {
+  for (const uint8_t value : data) {
+    hash = (hash ^ value) * kFnvPrime;
+  }
+  return hash;
+}
+
+auto Fnv1a(uint64_t hash, string_view text) -> uint64_t {
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  return Fnv1a(hash, span(reinterpret_cast<const uint8_t*>(text.data()),
+                          text.size()));
+}
+
+// Hashes a length before each string so ("ab", "c") and ("a", "bc") differ.
+auto HashField(uint64_t hash, string_view text) -> uint64_t {
+  array<uint8_t, 8> length{};
+  for (size_t i = 0; i < length.size(); ++i) {
+    length[i] = static_cast<uint8_t>((text.size() >> (8 * i)) & 0xFFU);
+  }
+  return Fnv1a(Fnv1a(hash, length), text);
+}
+
+auto GetDriverString(GLenum name) -> string_view {
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  const auto* value = reinterpret_cast<const char*>(glGetString(name));
+  return value != nullptr ? string_view(value) : string_view();
+}
+
+auto AppendLittleEndian(vector<uint8_t>& out, uint64_t value, size_t size)
+    -> void {
+  for (size_t i = 0; i < size; ++i) {
+    out.push_back(static_cast<uint8_t>((value >> (8 * i)) & 0xFFU));
+  }
+}
+
+auto ReadLittleEndian(span<const uint8_t> data, size_t offset, size_t size)
+    -> uint64_t {
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value |= static_cast<uint64_t>(data[offset + i]) << (8 * i);
+  }
+  return value;
+}
+
+auto GetEntryPath(const path& directory, uint64_t key) -> path {
+  constexpr string_view kDigits = "0123456789abcdef";
+  string name(16, '0');
+  for (size_t i = 0; i < name.size(); ++i) {
+    name[name.size() - 1 - i] = kDigits[(key >> (4 * i)) & 0xFU];
+  }
+  return directory / (name + ".bin");
+}
+
+auto Discard(const path& entry, string_view reason) -> void {
+  cerr << "Discarding program binary cache entry " << entry << ": " << reason
+       << '\n';
+  std::error_code ignored;
+  std::filesystem::remove(entry, ignored);
+}
+
+}  // namespace
+
+auto IsSupported() -> bool {
+  if (GLAD_GL_ARB_get_program_binary == 0) {
+    return false;
+  }
+  GLint formats = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+  return formats > 0;
+}
+
+auto ComputeKey(const ShaderSourceMap& sources) -> uint64_t {
+  vector<std::pair<GLShaderType, string_view>> ordered(sources.begin(),
+                                                       sources.end());
+  std::ranges::sort(ordered, {}, &std::pair<GLShaderType, string_view>::first);
+
+  uint64_t hash = kFnvOffsetBasis;
+  for (const auto& [type, source] : ordered) {
+    const array<uint8_t, 1> type_byte = {std::to_underlying(type)};
+    hash = HashField(Fnv1a(hash, type_byte), source);
+  }
+  for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+    hash = HashField(hash, GetDriverString(name));
+  }
+  return hash;
+}
+
+auto Load(const path& directory, uint64_t key) -> optional<unsigned int> {
+  const path entry = GetEntryPath(directory, key);
+  std::ifstream stream(entry, std::ios::binary);
+  if (!stream) {
+    return nullopt;
+  }
+  const vector<uint8_t> file{std::istreambuf_iterator<char>(stream),
+                             std::istreambuf_iterator<char>()};
+  stream.close();
+
+  if (file.size() < kHeaderSize ||
+      std::memcmp(file.data(), kMagic.data(), kMagic.size()) != 0 ||
+      ReadLittleEndian(file, 8, 8) != key) {
+    Discard(entry, "bad header");
+    return nullopt;
+  }
+  const auto format = static_cast<GLenum>(ReadLittleEndian(file, 16, 4));
+  const uint64_t size = ReadLittleEndian(file, 20, 4);
+  const span<const uint8_t> binary = span(file).subspan(kHeaderSize);
+  if (binary.size() != size ||
+      ReadLittleEndian(file, 24, 8) != Fnv1a(kFnvOffsetBasis, binary)) {
+    Discard(entry, "truncated or corrupt");
+    return nullopt;
+  }
+
+  const GLuint program = glCreateProgram();
+  glProgramBinary(program, format, binary.data(),
+                  static_cast<GLsizei>(binary.size()));
+  // An error flag may belong to an earlier call, so it only stops this load;
+  // the entry is discarded for a failed link alone. Drivers reject binaries
+  // from other versions or hardware that way rather than with an error.
+  if (!CheckGLCall("glProgramBinary")) {
+    glDeleteProgram(program);
+    return nullopt;
+  }
+  GLint linked = GL_FALSE;
+  glGetProgramiv(program, GL_LINK_STATUS, &linked);
+  if (linked == GL_FALSE) {
+    glDeleteProgram(program);
+    Discard(entry, "rejected by the driver");
+    return nullopt;
+  }
+  return program;
+}
+
+auto Store(const path& directory, uint64_t key, unsigned int program) -> void {
+  GLint linked = GL_FALSE;
+  GLint size = 0;
+  glGetProgramiv(program, GL_LINK_STATUS, &linked);
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+  if (linked == GL_FALSE || size <= 0) {
+    return;
+  }
+
+  vector<uint8_t> binary(static_cast<size_t>(size));
+  GLsizei length = 0;
+  GLenum format = 0;
+  glGetProgramBinary(program, size, &length, &format, binary.data());
+  if (!CheckGLCall("glGetProgramBinary") || length <= 0) {
+    cerr << "glGetProgramBinary failed; program not cached\n";
+    return;
+  }
+  binary.resize(static_cast<size_t>(length));
+
+  vector<uint8_t> header(kMagic.begin(), kMagic.end());
+  AppendLittleEndian(header, key, 8);
+  AppendLittleEndian(header, format, 4);
+  AppendLittleEndian(header, binary.size(), 4);
+  AppendLittleEndian(header, Fnv1a(kFnvOffsetBasis, binary), 8);
+
+  // Written aside and renamed into place, so a crash or another process
+  // starting up never sees half an entry.
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  const path entry = GetEntryPath(directory, key);
+  path staging = entry;
+  staging += ".tmp";
+  {
+    std::ofstream stream(staging, std::ios::binary | std::ios::trunc);
+    // NOLINTBEGIN(*-reinterpret-cast)
+    stream.write(reinterpret_cast<const char*>(header.data()),
+                 static_cast<std::streamsize>(header.size()));
+    stream.write(reinterpret_cast<const char*>(binary.data()),
+                 static_cast<std::streamsize>(binary.size()));
+    // NOLINTEND(*-reinterpret-cast)
+    if (!stream.flush()) {
+      cerr << "Failed to write program binary cache entry " << staging << '\n';
+      std::filesystem::remove(staging, error);
+      return;
+    }
+  }
+  std::filesystem::rename(staging, entry, error);
+  if (error) {
+    cerr << "Failed to write program binary cache entry " << entry << ": "
+         << error.message() << '\n';
+    std::filesystem::remove(staging, error);
+  }
+}
+
+}  // namespace graphics_engine::program_binary_cache
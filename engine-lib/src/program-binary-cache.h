@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_PROGRAM_BINARY_CACHE_H_
+#define ENGINE_LIB_PROGRAM_BINARY_CACHE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::program_binary_cache {
+
+// Returns true if the current context can both save and restore program
+// binaries: GL_ARB_get_program_binary with at least one binary format.
+[[nodiscard]] auto IsSupported() -> bool;
+
+// Hashes the sources, in shader type order, with the GL_VENDOR, GL_RENDERER
+// and GL_VERSION strings, so a driver update gives every program a new key
+// instead of feeding it binaries from the old driver.
+[[nodiscard]] auto ComputeKey(const types::ShaderSourceMap& sources)
+    -> std::uint64_t;
+
+// Returns a new program restored from the entry for `key` in `directory`, or
+// nothing if there is no entry, or it is corrupt or rejected by the driver.
+// Bad entries are removed so the next Store replaces them.
+[[nodiscard]] auto Load(const std::filesystem::path& directory,
+                        std::uint64_t key) -> std::optional<unsigned int>;
+
+// Saves the binary of the linked `program` as the entry for `key`. The cache
+// only saves time, so failures are logged and otherwise ignored.
+auto Store(const std::filesystem::path& directory, std::uint64_t key,
+           unsigned int program) -> void;
+
+}  // namespace graphics_engine::program_binary_cache
+
+#endif  // ENGINE_LIB_PROGRAM_BINARY_CACHE_H_
@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "graphics-engine/quantize.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "error.h"
+
+// F16C converts four floats to halves per instruction. It is only used when
+// the compiler targets it (-mf16c, -march=native or /arch:AVX2); otherwise the
+// scalar conversion below is used.
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define ENGINE_LIB_HAS_F16C
+#include <immintrin.h>
+#endif
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::types::Expected;
+
+using std::bit_cast;
+using std::size_t;
+using std::span;
+using std::uint16_t;
+using std::uint32_t;
+using std::unexpected;
+
+namespace graphics_engine::quantize {
+
+namespace {
+
+constexpr uint16_t kHalfOne = 0x3C00;
+
+auto QuantizeSnorm(float value, float scale) -> uint32_t {
+  const auto quantized =
+      static_cast<int>(std::lround(std::clamp(value, -1.F, 1.F) * scale));
+  return static_cast<uint32_t>(quantized);
+}
+
+auto QuantizeUnorm(float value, float scale) -> uint32_t {
+  return static_cast<uint32_t>(
+      std::lround(std::clamp(value, 0.F, 1.F) * scale));
+}
+
+// Convert `count` groups of `in_stride` floats into groups of `out_stride`
+// halves. Output slots past `in_stride` are filled with `pad`.
+auto ConvertToHalves(const float* in, size_t in_stride, uint16_t* out,
+                     size_t out_stride, size_t count, uint16_t pad) -> void {
+  size_t i = 0;
+#ifdef ENGINE_LIB_HAS_F16C
+  if (in_stride == out_stride) {
+    const size_t total = count * in_stride;
+    for (; i + 4 <= total; i += 4) {
+      const __m128 floats = _mm_loadu_ps(in + i);
+      const __m128i halves = _mm_cvtps_ph(floats, _MM_FROUND_TO_NEAREST_INT);
+      // NOLINTNEXTLINE(*-reinterpret-cast)
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), halves);
+    }
+    for (; i < total; ++i) {
+      out[i] = FloatToHalf(in[i]);
+    }
+    return;
+  }
+
+  if (in_stride == 3 && out_stride == 4) {
+    // Load x, y, z plus the next vertex's x, then overwrite the fourth half.
+    for (; i + 1 < count; ++i) {
+      const __m128 floats = _mm_loadu_ps(in + (i * 3));
+      const __m128i halves = _mm_cvtps_ph(floats, _MM_FROUND_TO_NEAREST_INT);
+      // NOLINTNEXTLINE(*-reinterpret-cast)
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(out + (i * 4)), halves);
+      out[(i * 4) + 3] = pad;
+    }
+  }
+#endif
+
+  for (; i < count; ++i) {
+    for (size_t c = 0; c < out_stride; ++c) {
+      out[(i * out_stride) + c] =
+          c < in_stride ? FloatToHalf(in[(i * in_stride) + c]) : pad;
+    }
+  }
+}
+
+}  // namespace
+
+auto FloatToHalf(float value) -> uint16_t {
+  constexpr uint32_t kFloatInfinity = 0x7F800000;
+  constexpr uint32_t kHalfOverflow = 0x47800000;   // 65536.F
+  constexpr uint32_t kHalfMinNormal = 0x38800000;  // 2^-14
+  // 0.5F: adding it aligns subnormal halves with the float mantissa, so the
+  // FPU performs the round to nearest even.
+  constexpr uint32_t kDenormMagic = 0x3F000000;
+
+  const auto bits = bit_cast<uint32_t>(value);
+  const uint32_t sign = (bits >> 16) & 0x8000;
+  uint32_t magnitude = bits & 0x7FFFFFFF;
+
+  if (magnitude >= kHalfOverflow) {
+    // Infinity stays infinity, NaN becomes a quiet NaN.
+    return static_cast<uint16_t>(
+        sign | (magnitude > kFloatInfinity ? 0x7E00U : 0x7C00U));
+  }
+
+  if (magnitude < kHalfMinNormal) {
+    const float shifted =
+        bit_cast<float>(magnitude) + bit_cast<float>(kDenormMagic);
+    return static_cast<uint16_t>(
+        sign | (bit_cast<uint32_t>(shifted) - kDenormMagic));
+  }
+
+  // Rebias the exponent and round the 13 dropped mantissa bits to nearest
+  // even. A carry out of the mantissa correctly bumps the exponent, up to
+  // infinity for values that round past 65504.
+  const uint32_t mantissa_odd = (magnitude >> 13) & 1;
+  magnitude += 0xC8000FFF + mantissa_odd;  // (15 - 127) << 23, plus 0xFFF
+  return static_cast<uint16_t>(sign | (magnitude >> 13));
+}
+
+auto HalfToFloat(uint16_t half) -> float {
+  const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+  const uint32_t exponent = (half >> 10) & 0x1F;
+  const uint32_t mantissa = half & 0x3FF;
+
+  if (exponent == 0) {
+    // Zero or subnormal: mantissa * 2^-24 is exact in a float.
+    const float magnitude = static_cast<float>(mantissa) * 0x1p-24F;
+    return bit_cast<float>(sign | bit_cast<uint32_t>(magnitude));
+  }
+
+  if (exponent == 0x1F) {
+    return bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+  }
+
+  return bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+auto PackSnorm2101010(float x, float y, float z, float w) -> uint32_t {
+  return (QuantizeSnorm(x, 511.F) & 0x3FF) |
+         ((QuantizeSnorm(y, 511.F) & 0x3FF) << 10) |
+         ((QuantizeSnorm(z, 511.F) & 0x3FF) << 20) |
+         ((QuantizeSnorm(w, 1.F) & 0x3) << 30);
+}
+
+auto PackUnorm2101010(float x, float y, float z, float w) -> uint32_t {
+  return QuantizeUnorm(x, 1023.F) | (QuantizeUnorm(y, 1023.F) << 10) |
+         (QuantizeUnorm(z, 1023.F) << 20) | (QuantizeUnorm(w, 3.F) << 30);
+}
+
+auto PackHalf(span<const float> values, span<uint16_t> halves)
+    -> Expected<void> {
+  if (values.size() != halves.size()) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  ConvertToHalves(values.data(), 1, halves.data(), 1, values.size(), 0);
+  return {};
+}
+
+auto PackPositions(span<const float> positions, span<uint16_t> halves)
+    -> Expected<void> {
+  const size_t vertex_count = positions.size() / 3;
+  if (positions.size() % 3 != 0 || halves.size() != vertex_count * 4) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  ConvertToHalves(positions.data(), 3, halves.data(), 4, vertex_count,
+                  kHalfOne);
+  return {};
+}
+
+auto PackNormals(span<const float> normals, span<uint32_t> packed)
+    -> Expected<void> {
+  if (normals.size() != packed.size() * 3) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  for (size_t i = 0; i < packed.size(); ++i) {
+    packed[i] = PackSnorm2101010(normals[i * 3], normals[(i * 3) + 1],
+                                 normals[(i * 3) + 2], 0.F);
+  }
+  return {};
+}
+
+auto PackColors(span<const float> colors, span<uint32_t> packed)
+    -> Expected<void> {
+  if (colors.size() != packed.size() * 4) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  for (size_t i = 0; i < packed.size(); ++i) {
+    packed[i] = PackUnorm2101010(colors[i * 4], colors[(i * 4) + 1],
+                                 colors[(i * 4) + 2], colors[(i * 4) + 3]);
+  }
+  return {};
+}
+
+}  // namespace graphics_engine::quantize
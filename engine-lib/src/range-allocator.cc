@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "range-allocator.h"
+
+#include <cassert>
+#include <iterator>
+
+using std::nullopt;
+using std::optional;
+using std::size_t;
+
+namespace graphics_engine::range_allocator {
+
+RangeAllocator::RangeAllocator(long long int capacity) : capacity_(capacity) {
+  Reset(0);
+}
+
+auto RangeAllocator::Allocate(long long int size) -> optional<long long int> {
+  assert(size > 0);
+  for (auto it = free_blocks_.begin(); it != free_blocks_.end(); ++it) {
+    auto [offset, block_size] = *it;
+    if (block_size < size) {
+      continue;
+    }
+
+    free_blocks_.erase(it);
+    if (block_size > size) {
+      free_blocks_.emplace(offset + size, block_size - size);
+    }
+    used_ += size;
+    return offset;
+  }
+
+  return nullopt;
+}
+
+auto RangeAllocator::Free(long long int offset, long long int size) -> void {
+  assert(size > 0 && offset >= 0 && offset + size <= capacity_);
+  used_ -= size;
+
+  auto next = free_blocks_.lower_bound(offset);
+  if (next != free_blocks_.end() && offset + size == next->first) {
+    size += next->second;
+    next = free_blocks_.erase(next);
+  }
+
+  if (next != free_blocks_.begin()) {
+    auto previous = std::prev(next);
+    if (previous->first + previous->second == offset) {
+      previous->second += size;
+      return;
+    }
+  }
+
+  free_blocks_.emplace_hint(next, offset, size);
+}
+
+auto RangeAllocator::Reset(long long int used) -> void {
+  assert(used >= 0 && used <= capacity_);
+  free_blocks_.clear();
+  if (used < capacity_) {
+    free_blocks_.emplace(used, capacity_ - used);
+  }
+  used_ = used;
+}
+
+auto RangeAllocator::GetCapacity() const -> long long int { return capacity_; }
+
+auto RangeAllocator::GetFreeBlockCount() const -> size_t {
+  return free_blocks_.size();
+}
+
+auto RangeAllocator::GetUsed() const -> long long int { return used_; }
+
+}  // namespace graphics_engine::range_allocator
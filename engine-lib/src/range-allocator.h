@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_RANGE_ALLOCATOR_H_
+#define ENGINE_LIB_RANGE_ALLOCATOR_H_
+
+#include <cstddef>
+#include <map>
+#include <optional>
+
+namespace graphics_engine::range_allocator {
+
+// Hands out ranges of [0, capacity) using a first-fit free list. Freed ranges
+// are merged with their free neighbours, so the list only holds the gaps
+// between live ranges. The unit (bytes, vertices, indices) is up to the
+// caller.
+class RangeAllocator {
+ public:
+  explicit RangeAllocator(long long int capacity);
+
+  // Returns the offset of a free range of `size` units, or nothing if no gap
+  // is large enough.
+  [[nodiscard]] auto Allocate(long long int size)
+      -> std::optional<long long int>;
+
+  // Returns a range obtained from Allocate to the free list.
+  auto Free(long long int offset, long long int size) -> void;
+
+  // Marks [0, used) as in use and everything after it as free, e.g. after the
+  // live ranges were packed to the front.
+  auto Reset(long long int used) -> void;
+
+  [[nodiscard]] auto GetCapacity() const -> long long int;
+  [[nodiscard]] auto GetFreeBlockCount() const -> std::size_t;
+  [[nodiscard]] auto GetUsed() const -> long long int;
+
+ private:
+  long long int capacity_;
+  long long int used_{};
+  std::map<long long int, long long int> free_blocks_;  // offset -> size
+};
+
+}  // namespace graphics_engine::range_allocator
+
+#endif  // ENGINE_LIB_RANGE_ALLOCATOR_H_
@@ -0,0 +1,199 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "readback-slot.h"
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#include "error.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::error::PollGLError;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::cerr;
+using std::size_t;
+using std::span;
+using std::unexpected;
+
+namespace graphics_engine::readback_slot {
+
+namespace {
+
+// How long a single glClientWaitSync may block before it is retried.
+constexpr GLuint64 kFenceTimeoutNs = 1'000'000'000;
+
+}  // namespace
+
+ReadbackSlot::~ReadbackSlot() { Release(); }
+
+ReadbackSlot::ReadbackSlot(ReadbackSlot&& other) noexcept
+    : buffer_{std::exchange(other.buffer_, 0)},
+      capacity_{std::exchange(other.capacity_, 0)},
+      fence_{std::exchange(other.fence_, nullptr)},
+      width_{other.width_},
+      height_{other.height_} {}
+
+auto ReadbackSlot::operator=(ReadbackSlot&& other) noexcept
+    -> ReadbackSlot& {
+  if (this != &other) {
+    Release();
+    buffer_ = std::exchange(other.buffer_, 0);
+    capacity_ = std::exchange(other.capacity_, 0);
+    fence_ = std::exchange(other.fence_, nullptr);
+    width_ = other.width_;
+    height_ = other.height_;
+  }
+  return *this;
+}
+
+auto ReadbackSlot::Release() -> void {
+  if (fence_ != nullptr) {
+    glDeleteSync(fence_);
+    fence_ = nullptr;
+  }
+  if (buffer_ != 0) {
+    (void)DeleteBuffers(1, &buffer_);
+    buffer_ = 0;
+  }
+  capacity_ = 0;
+}
+
+auto ReadbackSlot::Initialize(long long int size) -> Expected<void> {
+  Expected<void> result = GenBuffers(1, &buffer_);
+  if (!result.has_value() || size <= 0) {
+    return result;
+  }
+
+  result = BindBuffer(kPixelPack, buffer_);
+  if (result.has_value()) {
+    result = Reserve(size);
+  }
+  (void)BindBuffer(kPixelPack, 0);
+  return result;
+}
+
+auto ReadbackSlot::Reserve(long long int size) -> Expected<void> {
+  if (size <= capacity_) {
+    return {};
+  }
+  Expected<void> result = BufferData(kPixelPack, size, nullptr, kStreamRead);
+  if (result.has_value()) {
+    capacity_ = size;
+  }
+  return result;
+}
+
+auto ReadbackSlot::Issue(int width, int height) -> Expected<void> {
+  assert(!IsPending());
+  Expected<void> result = BindBuffer(kPixelPack, buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = Reserve(static_cast<long long int>(width) * height * kBytesPerPixel);
+  if (!result.has_value()) {
+    (void)BindBuffer(kPixelPack, 0);
+    return result;
+  }
+
+  // With a buffer bound to kPixelPack the pointer argument is an offset into
+  // it, and the call returns without waiting for the frame to finish.
+  glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  GLenum error = PollGLError("glReadPixels");
+
+  // Later glReadPixels calls into client memory must not land in the buffer.
+  result = BindBuffer(kPixelPack, 0);
+  if (error != GL_NO_ERROR) {
+    cerr << "glReadPixels failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+    }
+  }
+  if (!result.has_value()) {
+    return result;
+  }
+
+  fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  if (fence_ == nullptr) {
+    cerr << "glFenceSync failed with error code " << glGetError() << '\n';
+    return unexpected(MakeErrorCode(kGLError));
+  }
+
+  width_ = width;
+  height_ = height;
+  return {};
+}
+
+auto ReadbackSlot::Wait(bool block) -> Expected<bool> {
+  assert(IsPending());
+  GLbitfield flags = block ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+  GLenum status = GL_TIMEOUT_EXPIRED;
+  do {
+    status = glClientWaitSync(fence_, flags, block ? kFenceTimeoutNs : 0);
+    flags = 0;
+  } while (block && status == GL_TIMEOUT_EXPIRED);
+
+  if (status == GL_TIMEOUT_EXPIRED) {
+    return false;
+  }
+
+  glDeleteSync(fence_);
+  fence_ = nullptr;
+
+  if (status == GL_WAIT_FAILED) {
+    cerr << "glClientWaitSync failed with error code " << glGetError() << '\n';
+    return unexpected(MakeErrorCode(kGLError));
+  }
+  return true;
+}
+
+auto ReadbackSlot::CopyTo(span<byte> out) const -> Expected<void> {
+  assert(out.size() <= GetSize());
+  Expected<void> result = BindBuffer(kPixelPack, buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  const void* mapped =
+      glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+                       static_cast<GLsizeiptr>(out.size()), GL_MAP_READ_BIT);
+  if (mapped == nullptr) {
+    cerr << "glMapBufferRange failed with error code " << glGetError() << '\n';
+    result = unexpected(MakeErrorCode(kGLError));
+  } else {
+    std::memcpy(out.data(), mapped, out.size());
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  (void)BindBuffer(kPixelPack, 0);
+  return result;
+}
+
+auto ReadbackSlot::GetSize() const -> size_t {
+  return static_cast<size_t>(width_) * static_cast<size_t>(height_) *
+         kBytesPerPixel;
+}
+
+}  // namespace graphics_engine::readback_slot
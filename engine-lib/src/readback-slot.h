@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_READBACK_SLOT_H_
+#define ENGINE_LIB_READBACK_SLOT_H_
+
+#include <cstddef>
+#include <span>
+
+#include "glad/glad.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::readback_slot {
+
+// A kPixelPack buffer that reads the bound read framebuffer without stalling
+// the render thread. Issue queues glReadPixels into the buffer and fences it;
+// Wait reports when the GPU has finished and CopyTo then maps the pixels out.
+// Must be used on the thread whose OpenGL context the buffer belongs to.
+class ReadbackSlot {
+ public:
+  static constexpr int kBytesPerPixel = 4;
+
+  ReadbackSlot() = default;
+  ~ReadbackSlot();
+
+  ReadbackSlot(const ReadbackSlot&) = delete;
+  ReadbackSlot(ReadbackSlot&& other) noexcept;
+  auto operator=(const ReadbackSlot&) -> ReadbackSlot& = delete;
+  auto operator=(ReadbackSlot&& other) noexcept -> ReadbackSlot&;
+
+  // Creates the buffer and sizes it for `size` bytes, so a first Issue of up
+  // to that size doesn't allocate.
+  [[nodiscard]] auto Initialize(long long int size = 0)
+      -> types::Expected<void>;
+
+  // Queues a read of the RGBA pixels from (0, 0) to (width, height), growing
+  // the buffer if it is too small. The slot must not be pending.
+  [[nodiscard]] auto Issue(int width, int height) -> types::Expected<void>;
+
+  // Returns false if the read is still running and `block` is false. Once it
+  // has finished or failed the fence is deleted and the slot is no longer
+  // pending.
+  [[nodiscard]] auto Wait(bool block) -> types::Expected<bool>;
+
+  // Copies the first out.size() bytes of the finished read into `out`.
+  [[nodiscard]] auto CopyTo(std::span<std::byte> out) const
+      -> types::Expected<void>;
+
+  [[nodiscard]] auto IsPending() const -> bool { return fence_ != nullptr; }
+  [[nodiscard]] auto GetWidth() const -> int { return width_; }
+  [[nodiscard]] auto GetHeight() const -> int { return height_; }
+  // Bytes read by the last Issue.
+  [[nodiscard]] auto GetSize() const -> std::size_t;
+
+ private:
+  auto Reserve(long long int size) -> types::Expected<void>;
+  auto Release() -> void;
+
+  unsigned int buffer_{};
+  long long int capacity_{};
+  GLsync fence_{};
+  int width_{};
+  int height_{};
+};
+
+}  // namespace graphics_engine::readback_slot
+
+#endif  // ENGINE_LIB_READBACK_SLOT_H_
@@ -0,0 +1,245 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "ring-buffer.h"
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+#include "error.h"
+#include "graphics-engine/gl-wrappers.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::error::PollGLError;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::cerr;
+using std::size_t;
+using std::span;
+using std::unexpected;
+
+namespace graphics_engine::ring_buffer {
+
+namespace {
+
+constexpr GLbitfield kMapFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+// How long a single glClientWaitSync may block before it is retried.
+constexpr GLuint64 kFenceTimeoutNs = 1'000'000'000;
+
+auto AlignUp(long long int value, long long int alignment) -> long long int {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+RingBuffer::~RingBuffer() {
+  for (const FrameFence& frame : fences_) {
+    glDeleteSync(frame.fence);
+  }
+
+  // Deleting the buffer also unmaps it.
+  if (buffer_ != 0) {
+    (void)DeleteBuffers(1, &buffer_);
+  }
+}
+
+auto RingBuffer::Initialize(long long int capacity) -> Expected<void> {
+  if (GLAD_GL_ARB_buffer_storage == 0) {
+    cerr << "RingBuffer requires GL_ARB_buffer_storage\n";
+    return unexpected(MakeErrorCode(kGLExtensionUnavailable));
+  }
+
+  if (capacity <= 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  // Buffer objects are not tied to the target they are created through, so
+  // the copy-write target is used to stay clear of vertex and index bindings.
+  Expected<void> result = GenBuffers(1, &buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  result = BindBuffer(kCopyWrite, buffer_);
+  if (!result.has_value()) {
+    return result;
+  }
+
+  glBufferStorage(GL_COPY_WRITE_BUFFER, capacity, nullptr, kMapFlags);
+  if (GLenum error = PollGLError("glBufferStorage"); error != GL_NO_ERROR) {
+    cerr << "glBufferStorage failed with error code " << error << '\n';
+    switch (error) {
+      default:
+        assert(false);  // If we get here, add a new case to the switch.
+        [[fallthrough]];
+      case GL_INVALID_ENUM:
+        return unexpected(MakeErrorCode(kGLErrorInvalidEnum));
+      case GL_INVALID_OPERATION:
+        return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+      case GL_INVALID_VALUE:
+        return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+      case GL_OUT_OF_MEMORY:
+        return unexpected(MakeErrorCode(kGLErrorOutOfMemory));
+    }
+  }
+
+  void* mapped = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, capacity, kMapFlags);
+  if (mapped == nullptr) {
+    cerr << "glMapBufferRange failed with error code " << glGetError() << '\n';
+    return unexpected(MakeErrorCode(kGLError));
+  }
+
+  capacity_ = capacity;
+  mapped_ =
+      span<byte>(static_cast<byte*>(mapped), static_cast<size_t>(capacity));
+  return {};
+}
+
+auto RingBuffer::Fits(long long int offset, long long int size,
+                      bool wrapped) const -> bool {
+  if (full_) {
+    return false;
+  }
+
+  if (head_ == tail_) {
+    return true;
+  }
+
+  const long long int end = offset + size;
+  if (tail_ < head_) {
+    // In use: [tail_, head_). Everything after head_ is free, and so is
+    // everything before tail_.
+    return !wrapped || end <= tail_;
+  }
+
+  // In use: [tail_, capacity_) and [0, head_). Only [head_, tail_) is free, so
+  // wrapping would run over the older frames.
+  return !wrapped && end <= tail_;
+}
+
+auto RingBuffer::WaitForOldestFrame(bool block) -> Expected<bool> {
+  assert(!fences_.empty());
+  const FrameFence frame = fences_.front();
+
+  GLbitfield flags = block ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+  GLenum status = GL_TIMEOUT_EXPIRED;
+  do {
+    status = glClientWaitSync(frame.fence, flags, block ? kFenceTimeoutNs : 0);
+    flags = 0;
+  } while (block && status == GL_TIMEOUT_EXPIRED);
+
+  if (status == GL_WAIT_FAILED) {
+    cerr << "glClientWaitSync failed with error code " << glGetError() << '\n';
+    return unexpected(MakeErrorCode(kGLError));
+  }
+
+  if (status == GL_TIMEOUT_EXPIRED) {
+    return false;
+  }
+
+  glDeleteSync(frame.fence);
+  fences_.pop_front();
+  tail_ = frame.end;
+  full_ = false;
+  return true;
+}
+
+auto RingBuffer::Allocate(long long int size, long long int alignment)
+    -> Expected<RingBufferAllocation> {
+  if (size <= 0 || alignment <= 0 || (alignment & (alignment - 1)) != 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+  if (size > capacity_) {
+    return unexpected(MakeErrorCode(kRingBufferFull));
+  }
+
+  // Reclaim frames the GPU is already done with, without blocking.
+  while (!fences_.empty()) {
+    Expected<bool> reclaimed = WaitForOldestFrame(false);
+    if (!reclaimed.has_value()) {
+      return unexpected(reclaimed.error());
+    }
+    if (!*reclaimed) {
+      break;
+    }
+  }
+
+  for (;;) {
+    long long int offset = AlignUp(head_, alignment);
+    bool wrapped = false;
+    if (offset + size > capacity_) {
+      offset = 0;
+      wrapped = true;
+    }
+
+    if (Fits(offset, size, wrapped)) {
+      if (head_ == tail_ && !full_) {
+        // Nothing is in use, so the used range can start right here.
+        tail_ = offset;
+      }
+
+      head_ = offset + size == capacity_ ? 0 : offset + size;
+      full_ = head_ == tail_;
+      frame_has_data_ = true;
+      return RingBufferAllocation{
+          .data = mapped_.subspan(static_cast<size_t>(offset),
+                                  static_cast<size_t>(size)),
+          .offset = offset};
+    }
+
+    if (fences_.empty()) {
+      // Only the current frame is in the way.
+      return unexpected(MakeErrorCode(kRingBufferFull));
+    }
+
+    Expected<bool> reclaimed = WaitForOldestFrame(true);
+    if (!reclaimed.has_value()) {
+      return unexpected(reclaimed.error());
+    }
+  }
+}
+
+auto RingBuffer::EndFrame() -> Expected<void> {
+  if (!frame_has_data_) {
+    return {};
+  }
+
+  GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  if (fence == nullptr) {
+    cerr << "glFenceSync failed with error code " << glGetError() << '\n';
+    return unexpected(MakeErrorCode(kGLError));
+  }
+
+  fences_.push_back({.fence = fence, .end = head_});
+  frame_has_data_ = false;
+  return {};
+}
+
+auto RingBuffer::GetBufferId() const -> unsigned int { return buffer_; }
+
+auto RingBuffer::GetCapacity() const -> long long int { return capacity_; }
+
+auto CreateIRingBuffer(long long int capacity) -> Expected<IRingBufferPtr> {
+  auto ring_buffer = std::make_unique<RingBuffer>();
+  Expected<void> result = ring_buffer->Initialize(capacity);
+  if (!result.has_value()) {
+    cerr << "Ring buffer initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+
+  return ring_buffer;
+}
+
+}  // namespace graphics_engine::ring_buffer
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_RING_BUFFER_H_
+#define ENGINE_LIB_RING_BUFFER_H_
+
+#include <deque>
+#include <span>
+
+#include "glad/glad.h"
+#include "graphics-engine/i-ring-buffer.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::ring_buffer {
+
+class RingBuffer : public IRingBuffer {
+ public:
+  RingBuffer() = default;
+  ~RingBuffer() override;
+
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer(RingBuffer&&) = delete;
+  auto operator=(const RingBuffer&) -> RingBuffer& = delete;
+  auto operator=(RingBuffer&&) -> RingBuffer& = delete;
+
+  [[nodiscard]] auto Initialize(long long int capacity)
+      -> types::Expected<void>;
+
+  [[nodiscard]] auto Allocate(long long int size, long long int alignment)
+      -> types::Expected<RingBufferAllocation> override;
+  [[nodiscard]] auto EndFrame() -> types::Expected<void> override;
+
+  [[nodiscard]] auto GetBufferId() const -> unsigned int override;
+  [[nodiscard]] auto GetCapacity() const -> long long int override;
+
+ private:
+  // A frame's allocations end at `end`; they are free once `fence` signals.
+  struct FrameFence {
+    GLsync fence;
+    long long int end;
+  };
+
+  [[nodiscard]] auto Fits(long long int offset, long long int size,
+                          bool wrapped) const -> bool;
+  [[nodiscard]] auto WaitForOldestFrame(bool block) -> types::Expected<bool>;
+
+  unsigned int buffer_{};
+  long long int capacity_{};
+  std::span<std::byte> mapped_;
+
+  // Bytes in [tail_, head_), wrapping at capacity_, may still be read by the
+  // GPU or belong to the current frame. head_ == tail_ means empty unless
+  // full_ is set.
+  long long int head_{};
+  long long int tail_{};
+  bool full_{};
+
+  // Whether anything was allocated since the last EndFrame.
+  bool frame_has_data_{};
+  std::deque<FrameFence> fences_;
+};
+
+}  // namespace graphics_engine::ring_buffer
+
+#endif  // ENGINE_LIB_RING_BUFFER_H_
@@ -0,0 +1,387 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "shader-compiler.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "error.h"
+#include "glad/glad.h"
+#include "program-binary-cache.h"
+#include "shader.h"
+
+using enum graphics_engine::gl_types::GLShaderType;
+using enum graphics_engine::shader_compiler::ShaderCompileMode;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::CheckGLCall;
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::gl_types::GLShaderType;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader::Shader;
+using graphics_engine::shader::ShaderOptions;
+using graphics_engine::types::Expected;
+using graphics_engine::types::ShaderSourceMap;
+
+using std::cerr;
+using std::size_t;
+using std::string;
+using std::unexpected;
+using std::unique_lock;
+using std::vector;
+
+namespace graphics_engine::shader_compiler {
+
+namespace {
+
+// glClientWaitSync takes nanoseconds; waits are retried until the fence is
+// signaled, the timeout only bounds each call.
+constexpr GLuint64 kFenceTimeout = 1'000'000'000;
+
+auto ConvertShaderType(GLShaderType shader_type) -> GLenum {
+  switch (shader_type) {
+    default:
+      assert(false);  // If we get here, add a new case to the switch.
+      [[fallthrough]];
+    case kFragment:
+      return GL_FRAGMENT_SHADER;
+    case kGeometry:
+      return GL_GEOMETRY_SHADER;
+    case kVertex:
+      return GL_VERTEX_SHADER;
+  }
+}
+
+// Issue every compile and the link without asking for any status, so the
+// driver is free to work on them in the background.
+auto IssueCompile(const ShaderSourceMap& sources, bool retrievable,
+                  vector<GLuint>& shaders) -> GLuint {
+  for (const auto& [shader_type, source_code] : sources) {
+    const GLuint shader = glCreateShader(ConvertShaderType(shader_type));
+    const GLchar* source_code_cstr = source_code.c_str();
+    glShaderSource(shader, 1, &source_code_cstr, nullptr);
+    glCompileShader(shader);
+    shaders.push_back(shader);
+  }
+
+  const GLuint program = glCreateProgram();
+  for (const GLuint shader : shaders) {
+    glAttachShader(program, shader);
+  }
+  if (retrievable) {
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+  glLinkProgram(program);
+  return program;
+}
+
+auto AppendInfoLog(string& log, GLuint object, bool is_program) -> void {
+  GLint length = 0;
+  if (is_program) {
+    glGetProgramiv(object, GL_INFO_LOG_LENGTH, &length);
+  } else {
+    glGetShaderiv(object, GL_INFO_LOG_LENGTH, &length);
+  }
+  if (length <= 0) {
+    return;
+  }
+  string info_log(static_cast<size_t>(length), '\0');
+  GLsizei written = 0;
+  if (is_program) {
+    glGetProgramInfoLog(object, length, &written, info_log.data());
+  } else {
+    glGetShaderInfoLog(object, length, &written, info_log.data());
+  }
+  info_log.resize(static_cast<size_t>(written));
+  log += info_log;
+  log += '\n';
+}
+
+// Check the compile and link status, blocking until the driver is done.
+// Returns true if the program linked; otherwise `log` explains why not.
+auto CollectResult(const vector<GLuint>& shaders, GLuint program,
+                   string& log) -> bool {
+  GLint status = GL_FALSE;
+  for (const GLuint shader : shaders) {
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE) {
+      log += "Shader compilation failed:\n";
+      AppendInfoLog(log, shader, false);
+    }
+  }
+  glGetProgramiv(program, GL_LINK_STATUS, &status);
+  if (status == GL_FALSE) {
+    log += "Program link failed:\n";
+    AppendInfoLog(log, program, true);
+    return false;
+  }
+  return log.empty();
+}
+
+// The program keeps the compiled code; the shader objects are only needed
+// until it is linked.
+auto DeleteShaders(vector<GLuint>& shaders, GLuint program) -> void {
+  for (const GLuint shader : shaders) {
+    if (program != 0) {
+      glDetachShader(program, shader);
+    }
+    glDeleteShader(shader);
+  }
+  shaders.clear();
+}
+
+}  // namespace
+
+ShaderCompiler::ShaderCompiler(ShaderCompilerOptions options)
+    : options_(std::move(options)) {}
+
+ShaderCompiler::~ShaderCompiler() {
+  if (worker_.joinable()) {
+    {
+      const std::scoped_lock lock(mutex_);
+      stopping_ = true;
+    }
+    job_available_.notify_all();
+    worker_.join();
+  }
+
+  for (auto& [handle, job] : jobs_) {
+    Release(*job);
+  }
+}
+
+auto ShaderCompiler::Initialize() -> Expected<void> {
+  if (options_.prefer_parallel_extension &&
+      GLAD_GL_KHR_parallel_shader_compile != 0) {
+    mode_ = kParallelExtension;
+    glMaxShaderCompilerThreadsKHR(options_.max_driver_threads == 0
+                                      ? 0xFFFFFFFFU
+                                      : options_.max_driver_threads);
+    return CheckGLCall("glMaxShaderCompilerThreadsKHR");
+  }
+
+  if (!options_.make_worker_context_current) {
+    return {};
+  }
+
+  std::promise<bool> context_ready;
+  std::future<bool> context_result = context_ready.get_future();
+  worker_ = std::thread([this, &context_ready]() {
+    const bool current = options_.make_worker_context_current();
+    context_ready.set_value(current);
+    if (current) {
+      RunWorker();
+    }
+  });
+  if (context_result.get()) {
+    mode_ = kWorkerContext;
+  } else {
+    cerr << "No shared context for the shader compiler worker; compiling on "
+            "the calling thread\n";
+    worker_.join();
+  }
+  return {};
+}
+
+auto ShaderCompiler::RunWorker() -> void {
+  unique_lock lock(mutex_);
+  while (true) {
+    job_available_.wait(lock,
+                        [this]() { return stopping_ || !queue_.empty(); });
+    if (stopping_) {
+      break;
+    }
+    Job* job = queue_.front();
+    queue_.pop_front();
+    lock.unlock();
+
+    // Status queries block here instead of on the caller's thread.
+    job->program = IssueCompile(job->sources, job->use_cache, job->shaders);
+    job->failed = !CollectResult(job->shaders, job->program, job->log);
+    DeleteShaders(job->shaders, job->program);
+    if (job->failed) {
+      glDeleteProgram(job->program);
+      job->program = 0;
+    }
+    // The fence lets the caller's context wait for the link to reach the
+    // GPU; the flush guarantees it gets there.
+    job->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+
+    lock.lock();
+    job->compiled = true;
+    job_compiled_.notify_all();
+  }
+  lock.unlock();
+
+  if (options_.release_worker_context) {
+    options_.release_worker_context();
+  }
+}
+
+auto ShaderCompiler::Submit(const ShaderSourceMap& sources,
+                            const ShaderOptions& options)
+    -> ShaderCompileHandle {
+  auto job = std::make_unique<Job>();
+  job->options = options;
+  job->use_cache = !options.binary_cache_directory.empty() &&
+                   program_binary_cache::IsSupported();
+  if (job->use_cache) {
+    job->cache_key = program_binary_cache::ComputeKey(sources);
+    if (auto program = program_binary_cache::Load(
+            options.binary_cache_directory, job->cache_key)) {
+      job->program = *program;
+      job->from_cache = true;
+    }
+  }
+
+  if (!job->from_cache) {
+    if (mode_ == kWorkerContext) {
+      job->sources = sources;
+      {
+        const std::scoped_lock lock(mutex_);
+        queue_.push_back(job.get());
+      }
+      job_available_.notify_one();
+    } else {
+      job->program = IssueCompile(sources, job->use_cache, job->shaders);
+    }
+  }
+
+  const ShaderCompileHandle handle = next_handle_++;
+  jobs_.emplace(handle, std::move(job));
+  return handle;
+}
+
+auto ShaderCompiler::Poll(ShaderCompileHandle program) -> bool {
+  auto it = jobs_.find(program);
+  if (it == jobs_.end() || it->second->from_cache) {
+    return true;
+  }
+
+  Job& job = *it->second;
+  switch (mode_) {
+    default:
+      assert(false);  // If we get here, add a new case to the switch.
+      [[fallthrough]];
+    case kDeferredStatus:
+      return true;
+    case kParallelExtension: {
+      GLint done = GL_FALSE;
+      glGetProgramiv(job.program, GL_COMPLETION_STATUS_KHR, &done);
+      return done != GL_FALSE;
+    }
+    case kWorkerContext: {
+      {
+        const std::scoped_lock lock(mutex_);
+        if (!job.compiled) {
+          return false;
+        }
+      }
+      const GLenum status = glClientWaitSync(job.fence, 0, 0);
+      return status == GL_ALREADY_SIGNALED ||
+             status == GL_CONDITION_SATISFIED;
+    }
+  }
+}
+
+auto ShaderCompiler::WaitForWorker(Job& job) -> void {
+  {
+    unique_lock lock(mutex_);
+    job_compiled_.wait(lock, [&job]() { return job.compiled; });
+  }
+  if (job.fence == nullptr) {
+    return;
+  }
+  GLenum status = GL_TIMEOUT_EXPIRED;
+  while (status == GL_TIMEOUT_EXPIRED) {
+    status = glClientWaitSync(job.fence, 0, kFenceTimeout);
+  }
+  glDeleteSync(job.fence);
+  job.fence = nullptr;
+}
+
+auto ShaderCompiler::Finish(Job& job) -> bool {
+  const bool linked = CollectResult(job.shaders, job.program, job.log);
+  DeleteShaders(job.shaders, job.program);
+  return linked;
+}
+
+auto ShaderCompiler::Wait(ShaderCompileHandle program)
+    -> Expected<IShaderPtr> {
+  auto node = jobs_.extract(program);
+  if (node.empty()) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+  Job& job = *node.mapped();
+  if (job.from_cache) {
+    return std::make_unique<Shader>(job.program, true);
+  }
+
+  bool linked = false;
+  if (mode_ == kWorkerContext) {
+    WaitForWorker(job);
+    linked = !job.failed;
+  } else {
+    linked = Finish(job);
+  }
+  if (!linked) {
+    cerr << job.log;
+    Release(job);
+    return unexpected(MakeErrorCode(kShaderError));
+  }
+
+  if (job.use_cache) {
+    program_binary_cache::Store(job.options.binary_cache_directory,
+                                job.cache_key, job.program);
+  }
+  return std::make_unique<Shader>(job.program, false);
+}
+
+auto ShaderCompiler::Release(Job& job) -> void {
+  if (mode_ == kWorkerContext && !job.from_cache) {
+    // Jobs the worker never started own no objects yet.
+    const std::scoped_lock lock(mutex_);
+    if (!job.compiled) {
+      return;
+    }
+  }
+  if (job.fence != nullptr) {
+    glDeleteSync(job.fence);
+    job.fence = nullptr;
+  }
+  DeleteShaders(job.shaders, job.program);
+  if (job.program != 0) {
+    glDeleteProgram(job.program);
+    job.program = 0;
+  }
+}
+
+auto ShaderCompiler::GetPendingCount() const -> size_t { return jobs_.size(); }
+
+auto ShaderCompiler::GetMode() const -> ShaderCompileMode { return mode_; }
+
+auto CreateIShaderCompiler(ShaderCompilerOptions options)
+    -> Expected<IShaderCompilerPtr> {
+  auto compiler = std::make_unique<ShaderCompiler>(std::move(options));
+  Expected<void> result = compiler->Initialize();
+  if (!result.has_value()) {
+    cerr << "Shader compiler initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+
+  return compiler;
+}
+
+}  // namespace graphics_engine::shader_compiler
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_SHADER_COMPILER_H_
+#define ENGINE_LIB_SHADER_COMPILER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "glad/glad.h"
+#include "graphics-engine/i-shader-compiler.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::shader_compiler {
+
+class ShaderCompiler : public IShaderCompiler {
+ public:
+  explicit ShaderCompiler(ShaderCompilerOptions options);
+  ~ShaderCompiler() override;
+
+  ShaderCompiler(const ShaderCompiler&) = delete;
+  ShaderCompiler(ShaderCompiler&&) = delete;
+  auto operator=(const ShaderCompiler&) -> ShaderCompiler& = delete;
+  auto operator=(ShaderCompiler&&) -> ShaderCompiler& = delete;
+
+  [[nodiscard]] auto Initialize() -> types::Expected<void>;
+
+  [[nodiscard]] auto Submit(const types::ShaderSourceMap& sources,
+                            const shader::ShaderOptions& options)
+      -> ShaderCompileHandle override;
+  [[nodiscard]] auto Poll(ShaderCompileHandle program) -> bool override;
+  [[nodiscard]] auto Wait(ShaderCompileHandle program)
+      -> types::Expected<shader::IShaderPtr> override;
+
+  [[nodiscard]] auto GetPendingCount() const -> std::size_t override;
+  [[nodiscard]] auto GetMode() const -> ShaderCompileMode override;
+
+ private:
+  struct Job {
+    shader::ShaderOptions options;
+    bool use_cache{};
+    std::uint64_t cache_key{};
+    bool from_cache{};
+
+    // Shader objects and the program, until Wait takes the program.
+    std::vector<GLuint> shaders;
+    GLuint program{};
+
+    // kWorkerContext only. The worker owns the fields below until it sets
+    // `compiled` under the mutex.
+    types::ShaderSourceMap sources;
+    bool compiled{};
+    bool failed{};
+    std::string log;
+    GLsync fence{};
+  };
+
+  auto RunWorker() -> void;
+
+  // Wait for the worker to finish `job` and for its commands to reach the
+  // GPU, so this context sees the linked program.
+  auto WaitForWorker(Job& job) -> void;
+
+  // Query the results of a job compiled on this thread and print the logs
+  // if it failed. Blocks until the driver is done.
+  [[nodiscard]] auto Finish(Job& job) -> bool;
+
+  auto Release(Job& job) -> void;
+
+  ShaderCompilerOptions options_;
+  ShaderCompileMode mode_{ShaderCompileMode::kDeferredStatus};
+  std::unordered_map<ShaderCompileHandle, std::unique_ptr<Job>> jobs_;
+  ShaderCompileHandle next_handle_{1};
+
+  std::mutex mutex_;
+  std::condition_variable job_available_;
+  std::condition_variable job_compiled_;
+  std::deque<Job*> queue_;
+  bool stopping_{};
+  std::thread worker_;
+};
+
+}  // namespace graphics_engine::shader_compiler
+
+#endif  // ENGINE_LIB_SHADER_COMPILER_H_
@@ -0,0 +1,186 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "shader-registry.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "glad/glad.h"
+#include "shader.h"
+
+using graphics_engine::gl_types::GLShaderType;
+using graphics_engine::shader::IShader;
+using graphics_engine::shader::Shader;
+using graphics_engine::shader::ShaderOptions;
+using graphics_engine::types::Expected;
+using graphics_engine::types::ShaderSourceMap;
+
+using std::cerr;
+using std::pair;
+using std::size_t;
+using std::string;
+using std::string_view;
+using std::to_underlying;
+using std::uint64_t;
+using std::unexpected;
+using std::vector;
+using std::weak_ptr;
+
+namespace graphics_engine::shader_registry {
+
+namespace {
+
+constexpr uint64_t kFnvOffsetBasis = 0xCBF29CE484222325ULL;
+constexpr uint64_t kFnvPrime = 0x100000001B3ULL;
+
+auto Fnv1a(string_view text) -> uint64_t {
+  uint64_t hash = kFnvOffsetBasis;
+  for (const char c : text) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * kFnvPrime;
+  }
+  return hash;
+}
+
+auto IsTrailingSpace(char c) -> bool {
+  return c == ' ' || c == '\t' || c == '\f' || c == '\v';
+}
+
+// Appends `source` with "\r\n" and lone '\r' line endings converted to '\n'
+// and whitespace at the end of each line and of the source removed.
+auto AppendNormalized(string& out, string_view source) -> void {
+  const size_t start = out.size();
+  for (size_t i = 0; i < source.size(); ++i) {
+    char c = source[i];
+    if (c == '\r') {
+      if (i + 1 < source.size() && source[i + 1] == '\n') {
+        continue;
+      }
+      c = '\n';
+    }
+    if (c == '\n') {
+      while (out.size() > start && IsTrailingSpace(out.back())) {
+        out.pop_back();
+      }
+    }
+    out.push_back(c);
+  }
+  while (out.size() > start &&
+         (IsTrailingSpace(out.back()) || out.back() == '\n')) {
+    out.pop_back();
+  }
+}
+
+// Deletes the program once its last user lets go, and forgets it in the
+// registry if the registry is still around.
+struct ProgramDeleter {
+  weak_ptr<ShaderRegistryState> state;
+  uint64_t key{};
+  bool registered{};
+
+  auto operator()(IShader* shader) const -> void {
+    glDeleteProgram(shader->GetProgramId());
+    delete shader;  // NOLINT(*-owning-memory)
+
+    if (!registered) {
+      return;
+    }
+    auto locked = state.lock();
+    if (!locked) {
+      return;
+    }
+    auto it = locked->entries.find(key);
+    if (it != locked->entries.end() && it->second.shader.expired()) {
+      locked->entries.erase(it);
+    }
+  }
+};
+
+}  // namespace
+
+auto Normalize(const ShaderSourceMap& sources) -> string {
+  vector<pair<GLShaderType, string_view>> stages(sources.begin(),
+                                                 sources.end());
+  std::ranges::sort(stages, {}, &pair<GLShaderType, string_view>::first);
+
+  string normalized;
+  for (const auto& [shader_type, source_code] : stages) {
+    string stage;
+    AppendNormalized(stage, source_code);
+    normalized += std::to_string(to_underlying(shader_type));
+    normalized += ' ';
+    normalized += std::to_string(stage.size());
+    normalized += '\n';
+    normalized += stage;
+  }
+  return normalized;
+}
+
+ShaderRegistry::ShaderRegistry()
+    : state_(std::make_shared<ShaderRegistryState>()) {}
+
+auto ShaderRegistry::Acquire(const ShaderSourceMap& sources,
+                             const ShaderOptions& options)
+    -> Expected<SharedShader> {
+  string normalized = Normalize(sources);
+  const uint64_t key = Fnv1a(normalized);
+
+  auto it = state_->entries.find(key);
+  bool registered = true;
+  if (it != state_->entries.end()) {
+    if (it->second.normalized == normalized) {
+      if (SharedShader shader = it->second.shader.lock()) {
+        ++state_->hits;
+        return shader;
+      }
+    } else if (!it->second.shader.expired()) {
+      // Another live program has the same key. Give this one its own
+      // program rather than evict the other.
+      registered = false;
+    }
+  }
+
+  auto shader = std::make_unique<Shader>();
+  if (Expected<void> result = shader->Initialize(sources, options); !result) {
+    cerr << "Shader initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+  ++state_->misses;
+
+  SharedShader shared(shader.release(),
+                      ProgramDeleter{.state = state_,
+                                     .key = key,
+                                     .registered = registered});
+  if (registered) {
+    state_->entries.insert_or_assign(
+        key, ShaderRegistryEntry{.normalized = std::move(normalized),
+                                 .shader = shared});
+  }
+  return shared;
+}
+
+auto ShaderRegistry::GetKey(const ShaderSourceMap& sources) const
+    -> uint64_t {
+  return Fnv1a(Normalize(sources));
+}
+
+auto ShaderRegistry::GetStats() const -> ShaderRegistryStats {
+  return {.live_programs = state_->entries.size(),
+          .hits = state_->hits,
+          .misses = state_->misses};
+}
+
+auto CreateIShaderRegistry() -> Expected<IShaderRegistryPtr> {
+  return std::make_unique<ShaderRegistry>();
+}
+
+}  // namespace graphics_engine::shader_registry
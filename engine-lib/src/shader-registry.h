@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_SHADER_REGISTRY_H_
+#define ENGINE_LIB_SHADER_REGISTRY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "graphics-engine/i-shader-registry.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::shader_registry {
+
+// Returns the stages of `sources` in shader type order, each prefixed with
+// its type and length, with line endings converted to '\n' and trailing
+// whitespace removed from every line. Equal results mean equal programs.
+[[nodiscard]] auto Normalize(const types::ShaderSourceMap& sources)
+    -> std::string;
+
+struct ShaderRegistryEntry {
+  std::string normalized;
+  std::weak_ptr<shader::IShader> shader;
+};
+
+// Shared with the deleters of the programs handed out, so a program released
+// after the registry is gone doesn't touch freed memory.
+struct ShaderRegistryState {
+  std::unordered_map<std::uint64_t, ShaderRegistryEntry> entries;
+  std::size_t hits{};
+  std::size_t misses{};
+};
+
+class ShaderRegistry : public IShaderRegistry {
+ public:
+  ShaderRegistry();
+  ~ShaderRegistry() override = default;
+
+  ShaderRegistry(const ShaderRegistry&) = delete;
+  ShaderRegistry(ShaderRegistry&&) = delete;
+  auto operator=(const ShaderRegistry&) -> ShaderRegistry& = delete;
+  auto operator=(ShaderRegistry&&) -> ShaderRegistry& = delete;
+
+  [[nodiscard]] auto Acquire(const types::ShaderSourceMap& sources,
+                             const shader::ShaderOptions& options)
+      -> types::Expected<SharedShader> override;
+  [[nodiscard]] auto GetKey(const types::ShaderSourceMap& sources) const
+      -> std::uint64_t override;
+  [[nodiscard]] auto GetStats() const -> ShaderRegistryStats override;
+
+ private:
+  std::shared_ptr<ShaderRegistryState> state_;
+};
+
+}  // namespace graphics_engine::shader_registry
+
+#endif  // ENGINE_LIB_SHADER_REGISTRY_H_
@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "shader-reloader.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <utility>
+
+#include "error.h"
+#include "glad/glad.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::file_watcher::FileWatcher;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader::Shader;
+using graphics_engine::shader::ShaderOptions;
+using graphics_engine::shader_compiler::CreateIShaderCompiler;
+using graphics_engine::types::Expected;
+using graphics_engine::types::ShaderSourceMap;
+
+using std::cerr;
+using std::size_t;
+using std::string;
+using std::unexpected;
+using std::filesystem::path;
+using std::ranges::contains;
+using std::views::values;
+
+namespace graphics_engine::shader_reloader {
+
+namespace {
+
+auto ReadSources(const ShaderFileMap& files) -> Expected<ShaderSourceMap> {
+  ShaderSourceMap sources;
+  for (const auto& [shader_type, file] : files) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in) {
+      cerr << "Failed to read shader source " << file << '\n';
+      return unexpected(MakeErrorCode(kFileIoError));
+    }
+    sources.emplace(shader_type,
+                    string{std::istreambuf_iterator<char>(in),
+                           std::istreambuf_iterator<char>()});
+  }
+  return sources;
+}
+
+auto PrintFiles(const ShaderFileMap& files) -> void {
+  const char* separator = "";
+  for (const path& file : files | values) {
+    cerr << separator << file;
+    separator = ", ";
+  }
+}
+
+// Reloadable shaders own their program, whichever one is current.
+auto DeleteReloadableShader(Shader* shader) -> void {
+  glDeleteProgram(shader->GetProgramId());
+  delete shader;  // NOLINT(*-owning-memory)
+}
+
+}  // namespace
+
+ShaderReloader::ShaderReloader(ShaderReloaderOptions options)
+    : options_(std::move(options)) {}
+
+auto ShaderReloader::Initialize() -> Expected<void> {
+  if (Expected<void> result = watcher_.Initialize(); !result) {
+    return unexpected(result.error());
+  }
+  Expected<shader_compiler::IShaderCompilerPtr> compiler =
+      CreateIShaderCompiler(std::move(options_.compiler));
+  if (!compiler) {
+    return unexpected(compiler.error());
+  }
+  compiler_ = std::move(*compiler);
+  return {};
+}
+
+auto ShaderReloader::Load(const ShaderFileMap& files,
+                          const ShaderOptions& options)
+    -> Expected<ReloadableShader> {
+  // Watch before reading, so an edit made while compiling isn't missed.
+  ShaderFileMap normalized;
+  for (const auto& [shader_type, file] : files) {
+    normalized.emplace(shader_type, FileWatcher::Normalize(file));
+    if (Expected<void> result = watcher_.Watch(file); !result) {
+      return unexpected(result.error());
+    }
+  }
+
+  Expected<ShaderSourceMap> sources = ReadSources(normalized);
+  if (!sources) {
+    return unexpected(sources.error());
+  }
+  Expected<IShaderPtr> compiled =
+      compiler_->Wait(compiler_->Submit(*sources, options));
+  if (!compiled) {
+    return unexpected(compiled.error());
+  }
+
+  std::shared_ptr<Shader> shader(
+      new Shader((*compiled)->GetProgramId(), (*compiled)->IsFromBinaryCache()),
+      DeleteReloadableShader);
+  entries_.push_back({.files = std::move(normalized),
+                      .options = options,
+                      .shader = shader,
+                      .pending = std::nullopt});
+  return shader;
+}
+
+auto ShaderReloader::CollectCompiles() -> size_t {
+  size_t swapped = 0;
+  for (Entry& entry : entries_) {
+    if (!entry.pending || !compiler_->Poll(*entry.pending)) {
+      continue;
+    }
+    Expected<IShaderPtr> compiled =
+        compiler_->Wait(*std::exchange(entry.pending, std::nullopt));
+    if (!compiled) {
+      ++failures_;
+      cerr << "Reloading ";
+      PrintFiles(entry.files);
+      cerr << " failed; keeping the previous program\n";
+      continue;
+    }
+
+    const std::shared_ptr<Shader> shader = entry.shader.lock();
+    if (!shader) {
+      glDeleteProgram((*compiled)->GetProgramId());
+      continue;
+    }
+    glDeleteProgram(shader->ReplaceProgram((*compiled)->GetProgramId(),
+                                           (*compiled)->IsFromBinaryCache()));
+    ++reloads_;
+    ++swapped;
+  }
+  return swapped;
+}
+
+auto ShaderReloader::Update() -> size_t {
+  // Collecting before submitting means a compile is never waited for in the
+  // frame it was issued, which would block without the extension or a
+  // worker context.
+  const size_t swapped = CollectCompiles();
+
+  for (const path& file : watcher_.Poll()) {
+    for (Entry& entry : entries_) {
+      entry.changed |= contains(entry.files | values, file);
+    }
+  }
+  std::erase_if(entries_, [](const Entry& entry) {
+    return entry.shader.expired() && !entry.pending;
+  });
+
+  for (Entry& entry : entries_) {
+    if (!entry.changed || entry.pending || entry.shader.expired()) {
+      continue;
+    }
+    entry.changed = false;
+    Expected<ShaderSourceMap> sources = ReadSources(entry.files);
+    if (!sources) {
+      ++failures_;
+      continue;
+    }
+    entry.pending = compiler_->Submit(*sources, entry.options);
+  }
+  return swapped;
+}
+
+auto ShaderReloader::GetStats() const -> ShaderReloaderStats {
+  ShaderReloaderStats stats{.watched_shaders = 0,
+                            .pending_compiles = 0,
+                            .reloads = reloads_,
+                            .failures = failures_};
+  for (const Entry& entry : entries_) {
+    stats.watched_shaders += entry.shader.expired() ? 0 : 1;
+    stats.pending_compiles += entry.pending ? 1 : 0;
+  }
+  return stats;
+}
+
+auto CreateIShaderReloader(ShaderReloaderOptions options)
+    -> Expected<IShaderReloaderPtr> {
+  auto reloader = std::make_unique<ShaderReloader>(std::move(options));
+  Expected<void> result = reloader->Initialize();
+  if (!result.has_value()) {
+    cerr << "Shader reloader initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+
+  return reloader;
+}
+
+}  // namespace graphics_engine::shader_reloader
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_SHADER_RELOADER_H_
+#define ENGINE_LIB_SHADER_RELOADER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "file-watcher.h"
+#include "graphics-engine/i-shader-compiler.h"
+#include "graphics-engine/i-shader-reloader.h"
+#include "graphics-engine/types.h"
+#include "shader.h"
+
+namespace graphics_engine::shader_reloader {
+
+class ShaderReloader : public IShaderReloader {
+ public:
+  explicit ShaderReloader(ShaderReloaderOptions options);
+  ~ShaderReloader() override = default;
+
+  ShaderReloader(const ShaderReloader&) = delete;
+  ShaderReloader(ShaderReloader&&) = delete;
+  auto operator=(const ShaderReloader&) -> ShaderReloader& = delete;
+  auto operator=(ShaderReloader&&) -> ShaderReloader& = delete;
+
+  [[nodiscard]] auto Initialize() -> types::Expected<void>;
+
+  [[nodiscard]] auto Load(const ShaderFileMap& files,
+                          const shader::ShaderOptions& options)
+      -> types::Expected<ReloadableShader> override;
+  auto Update() -> std::size_t override;
+  [[nodiscard]] auto GetStats() const -> ShaderReloaderStats override;
+
+ private:
+  struct Entry {
+    // Normalized as the watcher reports them.
+    ShaderFileMap files;
+    shader::ShaderOptions options;
+    std::weak_ptr<shader::Shader> shader;
+    std::optional<shader_compiler::ShaderCompileHandle> pending;
+    // A file changed since the last submitted compile.
+    bool changed{};
+  };
+
+  // Swaps in finished compiles; returns how many were swapped.
+  auto CollectCompiles() -> std::size_t;
+
+  ShaderReloaderOptions options_;
+  shader_compiler::IShaderCompilerPtr compiler_;
+  file_watcher::FileWatcher watcher_;
+  std::vector<Entry> entries_;
+  std::uint64_t reloads_{};
+  std::uint64_t failures_{};
+};
+
+}  // namespace graphics_engine::shader_reloader
+
+#endif  // ENGINE_LIB_SHADER_RELOADER_H_
@@ -5,23 +5,34 @@
 #include "shader.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <format>
 #include <iostream>
 #include <ranges>
+#include <span>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 
 #include "error.h"
 #include "glad/glad.h"
+#include "glm/gtc/type_ptr.hpp"
 #include "graphics-engine/i-shader.h"
+#include "program-binary-cache.h"
 
 using enum graphics_engine::gl_types::GLShaderObjectParameter;
 using enum graphics_engine::gl_types::GLShaderType;
+using enum graphics_engine::shader::UniformType;
 using enum graphics_engine::types::ErrorCode;
 
+using graphics_engine::error::CheckGLCall;
 using graphics_engine::error::CheckGLError;
 using graphics_engine::error::MakeErrorCode;
+using graphics_engine::error::PollGLError;
 using graphics_engine::gl_types::GLShaderType;
 using graphics_engine::gl_wrappers::AttachShader;
 using graphics_engine::gl_wrappers::CompileShader;
@@ -31,20 +42,28 @@ using graphics_engine::gl_wrappers::GetShaderInfoLog;
 using graphics_engine::gl_wrappers::GetShaderiv;
 using graphics_engine::gl_wrappers::LinkProgram;
 using graphics_engine::gl_wrappers::ShaderSource;
+using graphics_engine::gl_wrappers::UseProgram;
 using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader::ShaderOptions;
 using graphics_engine::types::Expected;
 using graphics_engine::types::ShaderSourceMap;
 
+using std::array;
+using std::byte;
 using std::cerr;
 using std::exception;
 using std::format;
 using std::is_same_v;
 using std::runtime_error;
+using std::size_t;
+using std::span;
 using std::string;
+using std::string_view;
 using std::to_underlying;
 using std::unexpected;
 using std::unordered_map;
 using std::vector;
+using std::filesystem::path;
 using std::ranges::contains;
 using std::ranges::for_each;
 using std::views::keys;
@@ -59,10 +78,114 @@ static_assert(is_same_v<GLuint, unsigned int>,
 
 namespace graphics_engine::shader {
 
+namespace {
+
+auto ConvertUniformType(GLenum type) -> UniformType {
+  switch (type) {
+    case GL_FLOAT:
+      return kFloat;
+    case GL_FLOAT_VEC2:
+      return kVec2;
+    case GL_FLOAT_VEC3:
+      return kVec3;
+    case GL_FLOAT_VEC4:
+      return kVec4;
+    case GL_FLOAT_MAT3:
+      return kMat3;
+    case GL_FLOAT_MAT4:
+      return kMat4;
+    case GL_INT:
+    case GL_BOOL:
+      return kInt;
+    case GL_SAMPLER_1D:
+    case GL_SAMPLER_2D:
+    case GL_SAMPLER_3D:
+    case GL_SAMPLER_CUBE:
+    case GL_SAMPLER_1D_SHADOW:
+    case GL_SAMPLER_2D_SHADOW:
+    case GL_SAMPLER_1D_ARRAY:
+    case GL_SAMPLER_2D_ARRAY:
+    case GL_SAMPLER_1D_ARRAY_SHADOW:
+    case GL_SAMPLER_2D_ARRAY_SHADOW:
+    case GL_SAMPLER_CUBE_SHADOW:
+    case GL_SAMPLER_2D_MULTISAMPLE:
+    case GL_SAMPLER_2D_MULTISAMPLE_ARRAY:
+    case GL_SAMPLER_2D_RECT:
+    case GL_SAMPLER_2D_RECT_SHADOW:
+    case GL_SAMPLER_BUFFER:
+    case GL_INT_SAMPLER_1D:
+    case GL_INT_SAMPLER_2D:
+    case GL_INT_SAMPLER_3D:
+    case GL_INT_SAMPLER_CUBE:
+    case GL_INT_SAMPLER_1D_ARRAY:
+    case GL_INT_SAMPLER_2D_ARRAY:
+    case GL_INT_SAMPLER_2D_MULTISAMPLE:
+    case GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
+    case GL_INT_SAMPLER_2D_RECT:
+    case GL_INT_SAMPLER_BUFFER:
+    case GL_UNSIGNED_INT_SAMPLER_1D:
+    case GL_UNSIGNED_INT_SAMPLER_2D:
+    case GL_UNSIGNED_INT_SAMPLER_3D:
+    case GL_UNSIGNED_INT_SAMPLER_CUBE:
+    case GL_UNSIGNED_INT_SAMPLER_1D_ARRAY:
+    case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:
+    case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE:
+    case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
+    case GL_UNSIGNED_INT_SAMPLER_2D_RECT:
+    case GL_UNSIGNED_INT_SAMPLER_BUFFER:
+      return kSampler;
+    default:
+      return kUnsupported;
+  }
+}
+
+auto GetValueSize(UniformType type) -> size_t {
+  switch (type) {
+    default:
+      assert(false);  // If we get here, add a new case to the switch.
+      [[fallthrough]];
+    case kUnsupported:
+      return 0;
+    case kFloat:
+    case kInt:
+    case kSampler:
+      return 4;
+    case kVec2:
+      return 8;
+    case kVec3:
+      return 12;
+    case kVec4:
+      return 16;
+    case kMat3:
+      return 36;
+    case kMat4:
+      return 64;
+  }
+}
+
+template <typename T>
+auto AsBytes(const T& value) -> span<const byte> {
+  return std::as_bytes(span(&value, 1));
+}
+
+auto AsBytes(const float* values, size_t count) -> span<const byte> {
+  return std::as_bytes(span(values, count));
+}
+
+constexpr array kFloatTypes{kFloat};
+constexpr array kVec2Types{kVec2};
+constexpr array kVec3Types{kVec3};
+constexpr array kVec4Types{kVec4};
+constexpr array kMat3Types{kMat3};
+constexpr array kMat4Types{kMat4};
+constexpr array kIntTypes{kInt, kSampler};
+
+}  // namespace
+
 auto DeleteShader(unsigned int shader_id)
     -> ::graphics_engine::types::Expected<void> {
   glDeleteShader(shader_id);
-  if (GLenum error = glGetError(); error != GL_NO_ERROR) {
+  if (GLenum error = PollGLError("glDeleteShader"); error != GL_NO_ERROR) {
     cerr << "glDeleteShader failed with error code " << error << '\n';
     switch (error) {
       default:
@@ -76,9 +199,10 @@ auto DeleteShader(unsigned int shader_id)
   return {};
 }
 
-auto CreateIShader(const ShaderSourceMap& sources) -> IShaderPtr {
+auto CreateIShader(const ShaderSourceMap& sources, const ShaderOptions& options)
+    -> IShaderPtr {
   Shader shader;
-  Expected<void> result = shader.Initialize(sources);
+  Expected<void> result = shader.Initialize(sources, options);
   if (!result.has_value()) {
     cerr << "Shader initialization failed with error code "
          << result.error().value() << ": " << result.error().message() << '\n';
@@ -88,10 +212,247 @@ auto CreateIShader(const ShaderSourceMap& sources) -> IShaderPtr {
   return std::make_unique<Shader>(shader);
 }
 
+Shader::Shader(GLuint program_id, bool from_binary_cache)
+    : program_id_(program_id), from_binary_cache_(from_binary_cache) {
+  ReflectUniforms();
+}
+
 auto Shader::GetProgramId() const -> unsigned int { return program_id_; }
 
-auto Shader::Initialize(const types::ShaderSourceMap& sources)
-    -> types::Expected<void> {
+auto Shader::IsFromBinaryCache() const -> bool { return from_binary_cache_; }
+
+auto Shader::ReplaceProgram(GLuint program_id, bool from_binary_cache)
+    -> GLuint {
+  const GLuint previous = std::exchange(program_id_, program_id);
+  from_binary_cache_ = from_binary_cache;
+  ReflectUniforms();
+  return previous;
+}
+
+auto Shader::GetUniforms() const -> span<const UniformInfo> {
+  return uniforms_;
+}
+
+auto Shader::GetUniformLocation(std::uint32_t name_hash) const -> int {
+  const auto it = std::ranges::lower_bound(uniforms_, name_hash, {},
+                                           &UniformInfo::name_hash);
+  if (it == uniforms_.end() || it->name_hash != name_hash) {
+    return -1;
+  }
+  return it->location;
+}
+
+auto Shader::SetUniform(int location, float value) -> Expected<void> {
+  return SetValue(location, kFloatTypes, AsBytes(value), [&](bool direct) {
+    if (direct) {
+      glProgramUniform1f(program_id_, location, value);
+      return "glProgramUniform1f";
+    }
+    glUniform1f(location, value);
+    return "glUniform1f";
+  });
+}
+
+auto Shader::SetUniform(int location, const glm::vec2& value)
+    -> Expected<void> {
+  const float* data = glm::value_ptr(value);
+  return SetValue(location, kVec2Types, AsBytes(data, 2), [&](bool direct) {
+    if (direct) {
+      glProgramUniform2fv(program_id_, location, 1, data);
+      return "glProgramUniform2fv";
+    }
+    glUniform2fv(location, 1, data);
+    return "glUniform2fv";
+  });
+}
+
+auto Shader::SetUniform(int location, const glm::vec3& value)
+    -> Expected<void> {
+  const float* data = glm::value_ptr(value);
+  return SetValue(location, kVec3Types, AsBytes(data, 3), [&](bool direct) {
+    if (direct) {
+      glProgramUniform3fv(program_id_, location, 1, data);
+      return "glProgramUniform3fv";
+    }
+    glUniform3fv(location, 1, data);
+    return "glUniform3fv";
+  });
+}
+
+auto Shader::SetUniform(int location, const glm::vec4& value)
+    -> Expected<void> {
+  const float* data = glm::value_ptr(value);
+  return SetValue(location, kVec4Types, AsBytes(data, 4), [&](bool direct) {
+    if (direct) {
+      glProgramUniform4fv(program_id_, location, 1, data);
+      return "glProgramUniform4fv";
+    }
+    glUniform4fv(location, 1, data);
+    return "glUniform4fv";
+  });
+}
+
+auto Shader::SetUniform(int location, const glm::mat3& value)
+    -> Expected<void> {
+  // glm matrices are column-major, as OpenGL expects without transposing.
+  const float* data = glm::value_ptr(value);
+  return SetValue(location, kMat3Types, AsBytes(data, 9), [&](bool direct) {
+    if (direct) {
+      glProgramUniformMatrix3fv(program_id_, location, 1, GL_FALSE, data);
+      return "glProgramUniformMatrix3fv";
+    }
+    glUniformMatrix3fv(location, 1, GL_FALSE, data);
+    return "glUniformMatrix3fv";
+  });
+}
+
+auto Shader::SetUniform(int location, const glm::mat4& value)
+    -> Expected<void> {
+  const float* data = glm::value_ptr(value);
+  return SetValue(location, kMat4Types, AsBytes(data, 16), [&](bool direct) {
+    if (direct) {
+      glProgramUniformMatrix4fv(program_id_, location, 1, GL_FALSE, data);
+      return "glProgramUniformMatrix4fv";
+    }
+    glUniformMatrix4fv(location, 1, GL_FALSE, data);
+    return "glUniformMatrix4fv";
+  });
+}
+
+auto Shader::SetUniform(int location, int value) -> Expected<void> {
+  return SetValue(location, kIntTypes, AsBytes(value), [&](bool direct) {
+    if (direct) {
+      glProgramUniform1i(program_id_, location, value);
+      return "glProgramUniform1i";
+    }
+    glUniform1i(location, value);
+    return "glUniform1i";
+  });
+}
+
+auto Shader::GetUniformStats() const -> UniformStats {
+  return uniform_stats_;
+}
+
+template <typename Upload>
+auto Shader::SetValue(int location, span<const UniformType> accepts,
+                      span<const byte> value, Upload upload)
+    -> Expected<void> {
+  if (location == -1) {
+    return {};
+  }
+  if (location < 0 ||
+      static_cast<size_t>(location) >= uniform_indices_.size() ||
+      uniform_indices_[location] < 0) {
+    cerr << "SetUniform failed: no active uniform at location " << location
+         << '\n';
+    return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+  }
+  const auto index = static_cast<size_t>(uniform_indices_[location]);
+  if (!contains(accepts, uniforms_[index].type)) {
+    cerr << "SetUniform failed: the uniform at location " << location
+         << " has type " << to_underlying(uniforms_[index].type) << '\n';
+    return unexpected(MakeErrorCode(kGLErrorInvalidOperation));
+  }
+
+  UniformSlot& slot = uniform_slots_[index];
+  assert(slot.size == value.size());
+  byte* stored = uniform_values_.data() + slot.offset;
+  if (slot.has_value && std::memcmp(stored, value.data(), slot.size) == 0) {
+    ++uniform_stats_.skipped;
+    return {};
+  }
+
+  const bool direct = GLAD_GL_ARB_separate_shader_objects != 0;
+  if (!direct) {
+    if (Expected<void> result = UseProgram(program_id_); !result) {
+      return unexpected(result.error());
+    }
+  }
+  const char* call = upload(direct);
+  if (Expected<void> result = CheckGLCall(call); !result) {
+    slot.has_value = false;
+    return unexpected(result.error());
+  }
+
+  std::memcpy(stored, value.data(), slot.size);
+  slot.has_value = true;
+  ++uniform_stats_.issued;
+  return {};
+}
+
+auto Shader::ReflectUniforms() -> void {
+  uniforms_.clear();
+  uniform_slots_.clear();
+  uniform_indices_.clear();
+  uniform_values_.clear();
+  if (program_id_ == 0) {
+    return;
+  }
+
+  GLint count = 0;
+  GLint max_length = 0;
+  glGetProgramiv(program_id_, GL_ACTIVE_UNIFORMS, &count);
+  glGetProgramiv(program_id_, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+  string name(static_cast<size_t>(std::max(max_length, 1)), '\0');
+  for (GLint i = 0; i < count; ++i) {
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = GL_NONE;
+    glGetActiveUniform(program_id_, static_cast<GLuint>(i), max_length,
+                       &length, &size, &type, name.data());
+    // Members of uniform blocks and built-in uniforms have no location.
+    const GLint location = glGetUniformLocation(program_id_, name.c_str());
+    if (location < 0) {
+      continue;
+    }
+    string_view base_name(name.data(), static_cast<size_t>(length));
+    if (base_name.ends_with("[0]")) {
+      base_name.remove_suffix(3);
+    }
+    uniforms_.push_back({.name_hash = HashUniformName(base_name),
+                         .location = location,
+                         .type = ConvertUniformType(type),
+                         .array_size = size});
+  }
+
+  std::ranges::sort(uniforms_, {}, &UniformInfo::name_hash);
+  int max_location = -1;
+  size_t offset = 0;
+  for (size_t i = 0; i < uniforms_.size(); ++i) {
+    if (i > 0 && uniforms_[i].name_hash == uniforms_[i - 1].name_hash) {
+      cerr << "Uniforms at locations " << uniforms_[i - 1].location << " and "
+           << uniforms_[i].location << " have the same name hash; "
+           << "GetUniformLocation finds only one of them\n";
+    }
+    const size_t size = GetValueSize(uniforms_[i].type);
+    uniform_slots_.push_back({.offset = offset, .size = size});
+    offset += size;
+    max_location = std::max(max_location, uniforms_[i].location);
+  }
+  uniform_values_.resize(offset);
+  uniform_indices_.assign(static_cast<size_t>(max_location + 1), -1);
+  for (size_t i = 0; i < uniforms_.size(); ++i) {
+    uniform_indices_[uniforms_[i].location] = static_cast<int>(i);
+  }
+}
+
+auto Shader::Initialize(const types::ShaderSourceMap& sources,
+                        const ShaderOptions& options) -> types::Expected<void> {
+  const path& cache_directory = options.binary_cache_directory;
+  const bool use_cache =
+      !cache_directory.empty() && program_binary_cache::IsSupported();
+  std::uint64_t cache_key{};
+  if (use_cache) {
+    cache_key = program_binary_cache::ComputeKey(sources);
+    if (auto program = program_binary_cache::Load(cache_directory, cache_key)) {
+      program_id_ = *program;
+      from_binary_cache_ = true;
+      ReflectUniforms();
+      return {};
+    }
+  }
+
   std::vector<GLuint> shader_ids;
 
   // Compile each of the shaders in the shader source map.
@@ -169,6 +530,12 @@ auto Shader::Initialize(const types::ShaderSourceMap& sources)
     }
   }
 
+  if (use_cache) {
+    // Without the hint some drivers return no binary for the program.
+    glProgramParameteri(*program_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                        GL_TRUE);
+  }
+
   Expected<void> result = LinkProgram(*program_id);
   if (!result) {
     cerr << "LinkProgram failed with error code: " << result.error().value()
@@ -177,6 +544,11 @@ auto Shader::Initialize(const types::ShaderSourceMap& sources)
   }
 
   program_id_ = *program_id;
+  ReflectUniforms();
+
+  if (use_cache) {
+    program_binary_cache::Store(cache_directory, cache_key, program_id_);
+  }
 
   return {};
 }
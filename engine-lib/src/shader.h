@@ -5,6 +5,9 @@
 #ifndef ENGINE_LIB_SHADER_H_
 #define ENGINE_LIB_SHADER_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <vector>
 
 #include "glad/glad.h"
@@ -17,15 +20,71 @@ namespace graphics_engine::shader {
 class Shader : public IShader {
  public:
   Shader() = default;
+  // Wraps a program that is already linked, e.g. by the shader compiler.
+  Shader(GLuint program_id, bool from_binary_cache);
   ~Shader() override = default;
 
   [[nodiscard]] auto GetProgramId() const -> unsigned int override;
+  [[nodiscard]] auto IsFromBinaryCache() const -> bool override;
+  [[nodiscard]] auto GetUniforms() const
+      -> std::span<const UniformInfo> override;
+  [[nodiscard]] auto GetUniformLocation(std::uint32_t name_hash) const
+      -> int override;
+  [[nodiscard]] auto SetUniform(int location, float value)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto SetUniform(int location, const glm::vec2& value)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto SetUniform(int location, const glm::vec3& value)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto SetUniform(int location, const glm::vec4& value)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto SetUniform(int location, const glm::mat3& value)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto SetUniform(int location, const glm::mat4& value)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto SetUniform(int location, int value)
+      -> types::Expected<void> override;
+  [[nodiscard]] auto GetUniformStats() const -> UniformStats override;
 
-  [[nodiscard]] auto Initialize(const types::ShaderSourceMap& sources)
+  [[nodiscard]] auto Initialize(const types::ShaderSourceMap& sources,
+                                const ShaderOptions& options = {})
       -> types::Expected<void>;
 
+  // Switches to another linked program, e.g. after a hot reload, and
+  // reflects its uniforms. Returns the previous program for the caller to
+  // delete.
+  [[nodiscard]] auto ReplaceProgram(GLuint program_id, bool from_binary_cache)
+      -> GLuint;
+
  private:
+  // Where the last value set for a uniform is kept in uniform_values_.
+  struct UniformSlot {
+    std::size_t offset{};
+    std::size_t size{};
+    bool has_value{};
+  };
+
+  // Fills the uniform table from the linked program.
+  auto ReflectUniforms() -> void;
+
+  // Records `value` for the uniform at `location` and calls `upload` with
+  // whether glProgramUniform can be used, unless the uniform already holds
+  // it. `upload` returns the name of the call it made, for error reports.
+  // `accepts` lists the uniform types the value may be set on.
+  template <typename Upload>
+  auto SetValue(int location, std::span<const UniformType> accepts,
+                std::span<const std::byte> value, Upload upload)
+      -> types::Expected<void>;
+
   GLuint program_id_{};
+  bool from_binary_cache_{};
+  // Sorted by name hash, so GetUniformLocation can binary search.
+  std::vector<UniformInfo> uniforms_;
+  std::vector<UniformSlot> uniform_slots_;
+  // The index into uniforms_ of the uniform at each location, -1 for none.
+  std::vector<int> uniform_indices_;
+  std::vector<std::byte> uniform_values_;
+  UniformStats uniform_stats_{};
 };
 
 }  // namespace graphics_engine::shader
@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "skyline-packer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+using std::nullopt;
+using std::optional;
+using std::size_t;
+
+namespace graphics_engine::skyline_packer {
+
+SkylinePacker::SkylinePacker(int width, int height)
+    : width_(width), height_(height) {
+  assert(width > 0 && height > 0);
+  skyline_.push_back({.x = 0, .y = 0, .width = width});
+}
+
+auto SkylinePacker::FitAt(size_t index, int width, int height) const
+    -> optional<int> {
+  if (skyline_[index].x + width > width_) {
+    return nullopt;
+  }
+
+  int y = 0;
+  int remaining = width;
+  for (size_t i = index; remaining > 0; ++i) {
+    y = std::max(y, skyline_[i].y);
+    if (y + height > height_) {
+      return nullopt;
+    }
+    remaining -= skyline_[i].width;
+  }
+  return y;
+}
+
+auto SkylinePacker::Insert(int width, int height) -> optional<PackedPosition> {
+  assert(width > 0 && height > 0);
+  size_t best_index = skyline_.size();
+  int best_top = std::numeric_limits<int>::max();
+  int best_width = std::numeric_limits<int>::max();
+  int best_y = 0;
+  for (size_t i = 0; i < skyline_.size(); ++i) {
+    optional<int> y = FitAt(i, width, height);
+    if (!y.has_value()) {
+      continue;
+    }
+    const int top = *y + height;
+    if (top < best_top ||
+        (top == best_top && skyline_[i].width < best_width)) {
+      best_index = i;
+      best_top = top;
+      best_width = skyline_[i].width;
+      best_y = *y;
+    }
+  }
+  if (best_index == skyline_.size()) {
+    return nullopt;
+  }
+
+  const PackedPosition position{.x = skyline_[best_index].x, .y = best_y};
+  skyline_.insert(skyline_.begin() + static_cast<long>(best_index),
+                  {.x = position.x, .y = best_top, .width = width});
+
+  // Trim or drop the segments the new one now covers.
+  const int right = position.x + width;
+  size_t next = best_index + 1;
+  while (next < skyline_.size() && skyline_[next].x < right) {
+    Segment& segment = skyline_[next];
+    const int shrink = right - segment.x;
+    if (segment.width <= shrink) {
+      skyline_.erase(skyline_.begin() + static_cast<long>(next));
+      continue;
+    }
+    segment.x += shrink;
+    segment.width -= shrink;
+    break;
+  }
+
+  // Merge neighbours at the same height so the skyline stays short.
+  for (size_t i = 0; i + 1 < skyline_.size();) {
+    if (skyline_[i].y == skyline_[i + 1].y) {
+      skyline_[i].width += skyline_[i + 1].width;
+      skyline_.erase(skyline_.begin() + static_cast<long>(i) + 1);
+    } else {
+      ++i;
+    }
+  }
+
+  used_area_ += static_cast<long long int>(width) * height;
+  return position;
+}
+
+auto SkylinePacker::GetUsedArea() const -> long long int { return used_area_; }
+
+auto SkylinePacker::GetSegmentCount() const -> size_t {
+  return skyline_.size();
+}
+
+}  // namespace graphics_engine::skyline_packer
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_SKYLINE_PACKER_H_
+#define ENGINE_LIB_SKYLINE_PACKER_H_
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace graphics_engine::skyline_packer {
+
+struct PackedPosition {
+  int x{};
+  int y{};
+};
+
+// Packs rectangles into a width x height bin using the skyline bottom-left
+// heuristic. The skyline is the top edge of everything packed so far, kept
+// as horizontal segments from left to right; a rectangle goes where its top
+// would be lowest, ties broken by the least width wasted. Space below the
+// skyline is never reused, which is what lets rectangles be added one at a
+// time at a low cost and without moving earlier ones.
+class SkylinePacker {
+ public:
+  SkylinePacker(int width, int height);
+
+  // Returns the bottom-left corner for a width x height rectangle, or nothing
+  // if it doesn't fit. If every size passed in is a multiple of some n, every
+  // position returned is too.
+  [[nodiscard]] auto Insert(int width, int height)
+      -> std::optional<PackedPosition>;
+
+  // Returns the area covered by inserted rectangles.
+  [[nodiscard]] auto GetUsedArea() const -> long long int;
+
+  [[nodiscard]] auto GetSegmentCount() const -> std::size_t;
+
+ private:
+  struct Segment {
+    int x;
+    int y;
+    int width;
+  };
+
+  // Returns the lowest y at which a rectangle of `width` can rest with its
+  // left edge on segment `index`, or nothing if it runs off the bin.
+  [[nodiscard]] auto FitAt(std::size_t index, int width, int height) const
+      -> std::optional<int>;
+
+  int width_;
+  int height_;
+  long long int used_area_{};
+  std::vector<Segment> skyline_;
+};
+
+}  // namespace graphics_engine::skyline_packer
+
+#endif  // ENGINE_LIB_SKYLINE_PACKER_H_
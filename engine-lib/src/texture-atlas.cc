@@ -0,0 +1,290 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "texture-atlas.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "error.h"
+#include "glad/glad.h"
+#include "graphics-engine/gl-wrappers.h"
+#include "image-codec.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::CheckGLCall;
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::image::ImageView;
+using graphics_engine::image_codec::IsValid;
+using graphics_engine::image_codec::ToRgba;
+using graphics_engine::skyline_packer::PackedPosition;
+using graphics_engine::skyline_packer::SkylinePacker;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::optional;
+using std::size_t;
+using std::uint8_t;
+using std::unexpected;
+using std::vector;
+
+namespace graphics_engine::texture_atlas {
+
+namespace {
+
+constexpr int kChannels = 4;
+
+auto RoundUp(int value, int multiple) -> int {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+}  // namespace
+
+TextureAtlas::TextureAtlas(const TextureAtlasOptions& options)
+    : options_(options), alignment_(1 << (options.mip_levels - 1)) {}
+
+TextureAtlas::~TextureAtlas() {
+  for (Page& page : pages_) {
+    if (page.texture != 0) {
+      glDeleteTextures(1, &page.texture);
+    }
+  }
+}
+
+auto TextureAtlas::Add(const ImageView& image) -> Expected<AtlasHandle> {
+  if (!IsValid(image)) {
+    cerr << "TextureAtlas::Add failed: malformed image\n";
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  const int block_width =
+      RoundUp(image.width + (2 * options_.padding), alignment_);
+  const int block_height =
+      RoundUp(image.height + (2 * options_.padding), alignment_);
+  if (block_width > options_.page_size || block_height > options_.page_size) {
+    cerr << "TextureAtlas::Add failed: a " << image.width << "x"
+         << image.height << " image doesn't fit a page\n";
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  // First fit over the pages, so earlier pages fill up before new ones are
+  // made and the page count stays low.
+  int page_index = 0;
+  optional<PackedPosition> position;
+  for (; page_index < static_cast<int>(pages_.size()); ++page_index) {
+    position = pages_[page_index].packer.Insert(block_width, block_height);
+    if (position.has_value()) {
+      break;
+    }
+  }
+  if (!position.has_value()) {
+    if (static_cast<int>(pages_.size()) == options_.max_pages) {
+      return unexpected(MakeErrorCode(kTextureAtlasFull));
+    }
+    const auto page_bytes = static_cast<size_t>(options_.page_size) *
+                            static_cast<size_t>(options_.page_size) *
+                            kChannels;
+    pages_.push_back({.packer = SkylinePacker(options_.page_size,
+                                              options_.page_size),
+                      .pixels = vector<uint8_t>(page_bytes),
+                      .texture = 0,
+                      .dirty = {}});
+    position = pages_.back().packer.Insert(block_width, block_height);
+  }
+
+  Page& page = pages_[page_index];
+  FillBlock(page, position->x, position->y, block_width, block_height,
+            ToRgba(image), image.width, image.height);
+
+  const auto page_size = static_cast<float>(options_.page_size);
+  const int x = position->x + options_.padding;
+  const int y = position->y + options_.padding;
+  const AtlasHandle handle = next_handle_++;
+  regions_[handle] = {.page = page_index,
+                      .x = x,
+                      .y = y,
+                      .width = image.width,
+                      .height = image.height,
+                      .u0 = static_cast<float>(x) / page_size,
+                      .v0 = static_cast<float>(y) / page_size,
+                      .u1 = static_cast<float>(x + image.width) / page_size,
+                      .v1 = static_cast<float>(y + image.height) / page_size};
+  return handle;
+}
+
+auto TextureAtlas::FillBlock(Page& page, int x, int y, int block_width,
+                             int block_height, const vector<uint8_t>& rgba,
+                             int width, int height) -> void {
+  const int padding = options_.padding;
+  const auto page_row = static_cast<size_t>(options_.page_size) * kChannels;
+  for (int row = 0; row < block_height; ++row) {
+    const int source_row = std::clamp(row - padding, 0, height - 1);
+    const uint8_t* source =
+        rgba.data() + (static_cast<size_t>(source_row) * width * kChannels);
+    uint8_t* out = page.pixels.data() +
+                   (static_cast<size_t>(y + row) * page_row) +
+                   (static_cast<size_t>(x) * kChannels);
+    // Left border, the row itself, then the right border.
+    for (int column = 0; column < padding; ++column, out += kChannels) {
+      std::memcpy(out, source, kChannels);
+    }
+    std::memcpy(out, source, static_cast<size_t>(width) * kChannels);
+    out += static_cast<size_t>(width) * kChannels;
+    const uint8_t* last = source + (static_cast<size_t>(width - 1) * kChannels);
+    for (int column = padding + width; column < block_width;
+         ++column, out += kChannels) {
+      std::memcpy(out, last, kChannels);
+    }
+  }
+
+  DirtyRect& dirty = page.dirty;
+  if (dirty.IsEmpty()) {
+    dirty = {.x0 = x, .y0 = y, .x1 = x + block_width, .y1 = y + block_height};
+  } else {
+    dirty = {.x0 = std::min(dirty.x0, x),
+             .y0 = std::min(dirty.y0, y),
+             .x1 = std::max(dirty.x1, x + block_width),
+             .y1 = std::max(dirty.y1, y + block_height)};
+  }
+}
+
+auto TextureAtlas::GetRegion(AtlasHandle image) const -> Expected<AtlasRegion> {
+  auto it = regions_.find(image);
+  if (it == regions_.end()) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+  return it->second;
+}
+
+auto TextureAtlas::Upload() -> Expected<void> {
+  bool bound_client_memory = false;
+  for (Page& page : pages_) {
+    if (page.dirty.IsEmpty()) {
+      continue;
+    }
+    // The page is read from client memory, not from an unpack buffer.
+    if (!bound_client_memory) {
+      Expected<void> result = BindBuffer(kPixelUnpack, 0);
+      if (!result.has_value()) {
+        return result;
+      }
+      bound_client_memory = true;
+    }
+    Expected<void> result = UploadPage(page);
+    if (!result.has_value()) {
+      return result;
+    }
+  }
+  return {};
+}
+
+auto TextureAtlas::UploadPage(Page& page) -> Expected<void> {
+  const int size = options_.page_size;
+  const int levels = options_.mip_levels;
+
+  GLint previous_texture = 0;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_texture);
+
+  Expected<void> result{};
+  if (page.texture == 0) {
+    glGenTextures(1, &page.texture);
+    glBindTexture(GL_TEXTURE_2D, page.texture);
+    const char* allocate = "glTexStorage2D";
+    if (GLAD_GL_ARB_texture_storage != 0) {
+      glTexStorage2D(GL_TEXTURE_2D, levels, GL_RGBA8, size, size);
+    } else {
+      allocate = "glTexImage2D";
+      for (int level = 0; level < levels; ++level) {
+        glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, std::max(1, size >> level),
+                     std::max(1, size >> level), 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     nullptr);
+      }
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    result = CheckGLCall(allocate);
+  } else {
+    glBindTexture(GL_TEXTURE_2D, page.texture);
+  }
+
+  if (result.has_value()) {
+    // One update covering every block added since the last upload, read in
+    // place from the page copy.
+    const DirtyRect& dirty = page.dirty;
+    GLint previous_row_length = 0;
+    GLint previous_alignment = 0;
+    glGetIntegerv(GL_UNPACK_ROW_LENGTH, &previous_row_length);
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous_alignment);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, size);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, kChannels);
+    const uint8_t* pixels =
+        page.pixels.data() +
+        (((static_cast<size_t>(dirty.y0) * size) + dirty.x0) * kChannels);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, dirty.x0, dirty.y0, dirty.x1 - dirty.x0,
+                    dirty.y1 - dirty.y0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    result = CheckGLCall("glTexSubImage2D");
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, previous_row_length);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previous_alignment);
+  }
+
+  // Blocks are aligned to the smallest level's texel size, so regenerating
+  // the chain with a box filter never blends two images.
+  if (result.has_value() && levels > 1) {
+    glGenerateMipmap(GL_TEXTURE_2D);
+    result = CheckGLCall("glGenerateMipmap");
+  }
+  glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previous_texture));
+
+  if (result.has_value()) {
+    page.dirty = {};
+  }
+  return result;
+}
+
+auto TextureAtlas::GetTextureId(int page) const -> unsigned int {
+  if (page < 0 || page >= static_cast<int>(pages_.size())) {
+    return 0;
+  }
+  return pages_[page].texture;
+}
+
+auto TextureAtlas::GetStats() const -> TextureAtlasStats {
+  TextureAtlasStats stats{.image_count = regions_.size(),
+                          .page_count = static_cast<int>(pages_.size()),
+                          .used_pixels = 0,
+                          .dirty_pages = 0};
+  for (const Page& page : pages_) {
+    stats.used_pixels += page.packer.GetUsedArea();
+    stats.dirty_pages += page.dirty.IsEmpty() ? 0 : 1;
+  }
+  return stats;
+}
+
+auto CreateITextureAtlas(const TextureAtlasOptions& options)
+    -> Expected<ITextureAtlasPtr> {
+  if (options.page_size <= 0 || options.max_pages <= 0 ||
+      options.padding < 0 || options.mip_levels < 1 ||
+      options.mip_levels > static_cast<int>(std::bit_width(
+                               static_cast<unsigned int>(options.page_size)))) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  return std::make_unique<TextureAtlas>(options);
+}
+
+}  // namespace graphics_engine::texture_atlas
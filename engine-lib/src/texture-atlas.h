@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_TEXTURE_ATLAS_H_
+#define ENGINE_LIB_TEXTURE_ATLAS_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "graphics-engine/i-texture-atlas.h"
+#include "graphics-engine/types.h"
+#include "skyline-packer.h"
+
+namespace graphics_engine::texture_atlas {
+
+class TextureAtlas : public ITextureAtlas {
+ public:
+  explicit TextureAtlas(const TextureAtlasOptions& options);
+  ~TextureAtlas() override;
+
+  TextureAtlas(const TextureAtlas&) = delete;
+  TextureAtlas(TextureAtlas&&) = delete;
+  auto operator=(const TextureAtlas&) -> TextureAtlas& = delete;
+  auto operator=(TextureAtlas&&) -> TextureAtlas& = delete;
+
+  [[nodiscard]] auto Add(const image::ImageView& image)
+      -> types::Expected<AtlasHandle> override;
+  [[nodiscard]] auto GetRegion(AtlasHandle image) const
+      -> types::Expected<AtlasRegion> override;
+  [[nodiscard]] auto Upload() -> types::Expected<void> override;
+
+  [[nodiscard]] auto GetTextureId(int page) const -> unsigned int override;
+  [[nodiscard]] auto GetStats() const -> TextureAtlasStats override;
+
+ private:
+  // Pixels changed since the last upload, as a half-open rectangle.
+  struct DirtyRect {
+    int x0{};
+    int y0{};
+    int x1{};
+    int y1{};
+
+    [[nodiscard]] auto IsEmpty() const -> bool { return x0 >= x1; }
+  };
+
+  struct Page {
+    skyline_packer::SkylinePacker packer;
+    std::vector<std::uint8_t> pixels;  // RGBA8, page_size rows of page_size.
+    unsigned int texture{};
+    DirtyRect dirty;
+  };
+
+  [[nodiscard]] auto UploadPage(Page& page) -> types::Expected<void>;
+
+  // Copy `rgba`, `width` x `height`, into the block at (x, y) and repeat its
+  // edge pixels out to the block's edges.
+  auto FillBlock(Page& page, int x, int y, int block_width, int block_height,
+                 const std::vector<std::uint8_t>& rgba, int width, int height)
+      -> void;
+
+  const TextureAtlasOptions options_;
+  const int alignment_;
+  std::vector<Page> pages_;
+  std::unordered_map<AtlasHandle, AtlasRegion> regions_;
+  AtlasHandle next_handle_{1};
+};
+
+}  // namespace graphics_engine::texture_atlas
+
+#endif  // ENGINE_LIB_TEXTURE_ATLAS_H_
@@ -0,0 +1,332 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "graphics-engine/texture-container.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "error.h"
+#include "glad/glad.h"
+#include "graphics-engine/gl-wrappers.h"
+#include "image-codec.h"
+#include "mapped-file.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::texture_container::TexturePixelFormat;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::CheckGLCall;
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::image::ImageView;
+using graphics_engine::image_codec::DecodedImage;
+using graphics_engine::image_codec::DecodeFile;
+using graphics_engine::image_codec::IsValid;
+using graphics_engine::image_codec::ToRgba;
+using graphics_engine::mapped_file::MappedFile;
+using graphics_engine::texture_loader::Texture;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::cerr;
+using std::optional;
+using std::pair;
+using std::size_t;
+using std::span;
+using std::string_view;
+using std::uint32_t;
+using std::uint64_t;
+using std::uint8_t;
+using std::unexpected;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::texture_container {
+
+namespace {
+
+constexpr string_view kMagic = "GETEXTR1";
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kAlignment = 64;
+constexpr size_t kHeaderSize = 32;
+constexpr size_t kLevelEntrySize = 16;
+constexpr int kChannels = 4;
+// Enough levels for any width or height an int can hold.
+constexpr uint32_t kMaxLevels = 32;
+
+auto AppendLittleEndian(vector<byte>& out, uint64_t value, size_t size)
+    -> void {
+  for (size_t i = 0; i < size; ++i) {
+    out.push_back(static_cast<byte>((value >> (8 * i)) & 0xFFU));
+  }
+}
+
+auto ReadLittleEndian(span<const byte> data, size_t offset, size_t size)
+    -> uint64_t {
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value |= std::to_integer<uint64_t>(data[offset + i]) << (8 * i);
+  }
+  return value;
+}
+
+auto AlignUp(uint64_t value) -> uint64_t {
+  return (value + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+// Halves `level` with a box filter. Each texel averages a 2x2 block, except
+// that along an odd dimension the last texel also takes in the leftover row
+// or column, so every source texel contributes.
+auto Downsample(const vector<uint8_t>& level, int width, int height)
+    -> vector<uint8_t> {
+  const int next_width = std::max(1, width / 2);
+  const int next_height = std::max(1, height / 2);
+  vector<uint8_t> next(static_cast<size_t>(next_width) * next_height *
+                       kChannels);
+  // The source texels [first, last) that output texel `i` covers.
+  auto span_of = [](int i, int size, int next_size) -> pair<int, int> {
+    const int first = 2 * i;
+    return {first, i == next_size - 1 ? size : first + 2};
+  };
+  for (int y = 0; y < next_height; ++y) {
+    const auto [y0, y1] = span_of(y, height, next_height);
+    for (int x = 0; x < next_width; ++x) {
+      const auto [x0, x1] = span_of(x, width, next_width);
+      const auto count = static_cast<unsigned int>((x1 - x0) * (y1 - y0));
+      for (int channel = 0; channel < kChannels; ++channel) {
+        unsigned int sum = 0;
+        for (int sy = y0; sy < y1; ++sy) {
+          for (int sx = x0; sx < x1; ++sx) {
+            sum += level[((static_cast<size_t>(sy) * width + sx) * kChannels) +
+                         channel];
+          }
+        }
+        next[((static_cast<size_t>(y) * next_width + x) * kChannels) +
+             channel] = static_cast<uint8_t>((sum + (count / 2)) / count);
+      }
+    }
+  }
+  return next;
+}
+
+auto ParseInfo(span<const byte> file) -> optional<TextureContainerInfo> {
+  if (file.size() < kHeaderSize ||
+      std::memcmp(file.data(), kMagic.data(), kMagic.size()) != 0 ||
+      ReadLittleEndian(file, 8, 4) != kVersion ||
+      ReadLittleEndian(file, 12, 4) != std::to_underlying(kRgba8)) {
+    return std::nullopt;
+  }
+
+  const uint64_t width = ReadLittleEndian(file, 16, 4);
+  const uint64_t height = ReadLittleEndian(file, 20, 4);
+  const uint64_t level_count = ReadLittleEndian(file, 24, 4);
+  const uint64_t alignment = ReadLittleEndian(file, 28, 4);
+  if (width == 0 || height == 0 || width > INT32_MAX || height > INT32_MAX ||
+      level_count == 0 || level_count > kMaxLevels ||
+      level_count > static_cast<uint64_t>(std::bit_width(
+                        std::max(width, height))) ||
+      alignment != kAlignment ||
+      file.size() < kHeaderSize + (level_count * kLevelEntrySize)) {
+    return std::nullopt;
+  }
+
+  TextureContainerInfo info{.format = kRgba8,
+                            .width = static_cast<int>(width),
+                            .height = static_cast<int>(height),
+                            .levels = {}};
+  for (uint64_t level = 0; level < level_count; ++level) {
+    const size_t entry = kHeaderSize + (level * kLevelEntrySize);
+    TextureContainerLevel level_info{
+        .width = std::max(1, info.width >> level),
+        .height = std::max(1, info.height >> level),
+        .offset = ReadLittleEndian(file, entry, 8),
+        .size = ReadLittleEndian(file, entry + 8, 8)};
+    const uint64_t expected_size = static_cast<uint64_t>(level_info.width) *
+                                   static_cast<uint64_t>(level_info.height) *
+                                   kChannels;
+    if (level_info.size != expected_size ||
+        level_info.offset % kAlignment != 0 ||
+        level_info.offset > file.size() ||
+        level_info.size > file.size() - level_info.offset) {
+      return std::nullopt;
+    }
+    info.levels.push_back(level_info);
+  }
+  return info;
+}
+
+auto MapContainer(const path& file, MappedFile& mapping)
+    -> Expected<TextureContainerInfo> {
+  if (auto opened = mapping.Open(file); !opened) {
+    return unexpected(opened.error());
+  }
+  optional<TextureContainerInfo> info = ParseInfo(mapping.GetBytes());
+  if (!info) {
+    cerr << file << " is not a valid texture container\n";
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  return std::move(*info);
+}
+
+}  // namespace
+
+auto WriteTextureContainer(const ImageView& image, const path& file,
+                           const TextureContainerOptions& options)
+    -> Expected<void> {
+  if (!IsValid(image)) {
+    return unexpected(MakeErrorCode(kInvalidImage));
+  }
+
+  vector<vector<uint8_t>> levels;
+  levels.push_back(ToRgba(image));
+  const int level_count =
+      options.generate_mipmaps
+          ? std::bit_width(static_cast<unsigned int>(
+                std::max(image.width, image.height)))
+          : 1;
+  for (int level = 1; level < level_count; ++level) {
+    levels.push_back(Downsample(levels.back(),
+                                std::max(1, image.width >> (level - 1)),
+                                std::max(1, image.height >> (level - 1))));
+  }
+
+  vector<byte> header;
+  header.reserve(kHeaderSize + (levels.size() * kLevelEntrySize));
+  for (const char c : kMagic) {
+    header.push_back(static_cast<byte>(c));
+  }
+  AppendLittleEndian(header, kVersion, 4);
+  AppendLittleEndian(header, std::to_underlying(kRgba8), 4);
+  AppendLittleEndian(header, static_cast<uint64_t>(image.width), 4);
+  AppendLittleEndian(header, static_cast<uint64_t>(image.height), 4);
+  AppendLittleEndian(header, levels.size(), 4);
+  AppendLittleEndian(header, kAlignment, 4);
+  uint64_t offset = AlignUp(kHeaderSize + (levels.size() * kLevelEntrySize));
+  for (const vector<uint8_t>& level : levels) {
+    AppendLittleEndian(header, offset, 8);
+    AppendLittleEndian(header, level.size(), 8);
+    offset = AlignUp(offset + level.size());
+  }
+
+  std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+  constexpr std::array<char, kAlignment> kPadding{};
+  uint64_t written = header.size();
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  stream.write(reinterpret_cast<const char*>(header.data()),
+               static_cast<std::streamsize>(header.size()));
+  for (const vector<uint8_t>& level : levels) {
+    stream.write(kPadding.data(),
+                 static_cast<std::streamsize>(AlignUp(written) - written));
+    // NOLINTNEXTLINE(*-reinterpret-cast)
+    stream.write(reinterpret_cast<const char*>(level.data()),
+                 static_cast<std::streamsize>(level.size()));
+    written = AlignUp(written) + level.size();
+  }
+  stream.close();
+  if (!stream) {
+    cerr << "Failed to write texture container " << file << '\n';
+    return unexpected(MakeErrorCode(kFileIoError));
+  }
+  return {};
+}
+
+auto ConvertToTextureContainer(const path& source, const path& destination,
+                               const TextureContainerOptions& options)
+    -> Expected<void> {
+  optional<DecodedImage> decoded = DecodeFile(source);
+  if (!decoded) {
+    cerr << "Failed to decode " << source << '\n';
+    return unexpected(MakeErrorCode(kStbErrorLoad));
+  }
+  return WriteTextureContainer(
+      ImageView{.width = decoded->width,
+                .height = decoded->height,
+                .channels = decoded->channels,
+                .pixels = std::as_bytes(span(decoded->pixels)),
+                .bottom_up = false},
+      destination, options);
+}
+
+auto ReadTextureContainerInfo(const path& file)
+    -> Expected<TextureContainerInfo> {
+  MappedFile mapping;
+  return MapContainer(file, mapping);
+}
+
+auto LoadTextureContainer(const path& file) -> Expected<Texture> {
+  MappedFile mapping;
+  Expected<TextureContainerInfo> info = MapContainer(file, mapping);
+  if (!info) {
+    return unexpected(info.error());
+  }
+  const span<const byte> bytes = mapping.GetBytes();
+  Texture texture{.id = 0,
+                  .width = info->width,
+                  .height = info->height,
+                  .levels = static_cast<int>(info->levels.size())};
+
+  // The level pointers below must be read as client memory, not as offsets
+  // into a bound unpack buffer.
+  if (auto unbound = BindBuffer(kPixelUnpack, 0); !unbound) {
+    return unexpected(unbound.error());
+  }
+  GLint previous_texture = 0;
+  GLint previous_alignment = 0;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_texture);
+  glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous_alignment);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, kChannels);
+  glGenTextures(1, &texture.id);
+  glBindTexture(GL_TEXTURE_2D, texture.id);
+
+  Expected<void> result{};
+  if (GLAD_GL_ARB_texture_storage != 0) {
+    glTexStorage2D(GL_TEXTURE_2D, texture.levels, GL_RGBA8, texture.width,
+                   texture.height);
+    result = CheckGLCall("glTexStorage2D");
+  }
+  for (int level = 0; result.has_value() && level < texture.levels;
+       ++level) {
+    const TextureContainerLevel& level_info = info->levels[level];
+    const byte* pixels = bytes.data() + level_info.offset;
+    // Both calls copy straight from the mapped pages; the driver reads them
+    // in as it goes.
+    if (GLAD_GL_ARB_texture_storage != 0) {
+      glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, level_info.width,
+                      level_info.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+      result = CheckGLCall("glTexSubImage2D");
+    } else {
+      glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, level_info.width,
+                   level_info.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+      result = CheckGLCall("glTexImage2D");
+    }
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture.levels - 1);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                  texture.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+  glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previous_texture));
+  glPixelStorei(GL_UNPACK_ALIGNMENT, previous_alignment);
+
+  if (!result.has_value()) {
+    glDeleteTextures(1, &texture.id);
+    return unexpected(result.error());
+  }
+  return texture;
+}
+
+}  // namespace graphics_engine::texture_container
@@ -0,0 +1,384 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "texture-loader.h"
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include "error.h"
+#include "graphics-engine/gl-wrappers.h"
+#include "stb/stb_image.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::error::CheckGLCall;
+using graphics_engine::error::MakeErrorCode;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::types::Expected;
+
+using std::cerr;
+using std::lock_guard;
+using std::size_t;
+using std::unexpected;
+using std::unique_lock;
+using std::vector;
+using std::filesystem::path;
+
+namespace graphics_engine::texture_loader {
+
+namespace {
+
+// How long a single glClientWaitSync may block before it is retried.
+constexpr GLuint64 kFenceTimeoutNs = 1'000'000'000;
+
+constexpr int kChannels = 4;
+
+}  // namespace
+
+TextureLoader::TextureLoader(const TextureLoaderOptions& options)
+    : options_{options} {
+  workers_.reserve(options.worker_count);
+  for (size_t i = 0; i < options.worker_count; ++i) {
+    workers_.emplace_back([this]() { RunWorker(); });
+  }
+}
+
+TextureLoader::~TextureLoader() {
+  // Complete every future rather than leaving waiters with a broken promise.
+  (void)Flush();
+
+  {
+    lock_guard lock{mutex_};
+    stopping_ = true;
+  }
+  request_available_.notify_all();
+  decoded_space_available_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+
+  for (StagingBuffer& staging : staging_) {
+    if (staging.fence != nullptr) {
+      glDeleteSync(staging.fence);
+    }
+    if (staging.buffer != 0) {
+      (void)DeleteBuffers(1, &staging.buffer);
+    }
+  }
+}
+
+auto TextureLoader::Initialize() -> Expected<void> {
+  if (options_.worker_count == 0 || options_.decoded_capacity == 0 ||
+      options_.staging_buffers == 0 || options_.upload_budget_bytes == 0) {
+    return unexpected(MakeErrorCode(kGLErrorInvalidValue));
+  }
+
+  staging_.resize(options_.staging_buffers);
+  for (size_t i = 0; i < staging_.size(); ++i) {
+    Expected<void> result = GenBuffers(1, &staging_[i].buffer);
+    if (!result.has_value()) {
+      return result;
+    }
+    free_staging_.push_back(i);
+  }
+
+  return {};
+}
+
+auto TextureLoader::Load(path file) -> TextureFuture {
+  Promise promise;
+  TextureFuture future = promise.get_future();
+  {
+    lock_guard lock{mutex_};
+    requests_.push_back(
+        {.file = std::move(file), .promise = std::move(promise)});
+    ++pending_count_;
+  }
+  request_available_.notify_one();
+  return future;
+}
+
+auto TextureLoader::RunWorker() -> void {
+  for (;;) {
+    Request request;
+    {
+      unique_lock lock{mutex_};
+      request_available_.wait(
+          lock, [this]() { return stopping_ || !requests_.empty(); });
+      if (requests_.empty()) {
+        return;
+      }
+      request = std::move(requests_.front());
+      requests_.pop_front();
+    }
+
+    // Reading the file ourselves keeps non-ASCII paths working everywhere,
+    // which stbi_load's char path doesn't.
+    std::ifstream stream(request.file, std::ios::binary);
+    const vector<char> contents{std::istreambuf_iterator<char>(stream),
+                                std::istreambuf_iterator<char>()};
+    DecodedImage image{.promise = std::move(request.promise)};
+    int channels = 0;
+    if (stream && contents.size() <= static_cast<size_t>(INT_MAX)) {
+      // NOLINTNEXTLINE(*-reinterpret-cast)
+      image.pixels = {stbi_load_from_memory(
+                          reinterpret_cast<const stbi_uc*>(contents.data()),
+                          static_cast<int>(contents.size()), &image.width,
+                          &image.height, &channels, kChannels),
+                      stbi_image_free};
+    }
+    if (image.pixels == nullptr) {
+      cerr << "Failed to decode texture " << request.file << '\n';
+      Complete(image.promise, unexpected(MakeErrorCode(kStbErrorLoad)));
+      continue;
+    }
+
+    {
+      unique_lock lock{mutex_};
+      decoded_space_available_.wait(lock, [this]() {
+        return stopping_ || decoded_.size() < options_.decoded_capacity;
+      });
+      decoded_.push_back(std::move(image));
+    }
+    decoded_available_.notify_all();
+  }
+}
+
+auto TextureLoader::Complete(Promise& promise, Expected<Texture> texture)
+    -> void {
+  promise.set_value(std::move(texture));
+  {
+    lock_guard lock{mutex_};
+    --pending_count_;
+  }
+  decoded_available_.notify_all();
+}
+
+auto TextureLoader::RetireStaging(bool block) -> Expected<void> {
+  while (!in_flight_.empty()) {
+    StagingBuffer& staging = staging_[in_flight_.front()];
+    const bool wait = block && free_staging_.empty();
+    GLbitfield flags = wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+    GLenum status = GL_TIMEOUT_EXPIRED;
+    do {
+      status = glClientWaitSync(staging.fence, flags,
+                                wait ? kFenceTimeoutNs : 0);
+      flags = 0;
+    } while (wait && status == GL_TIMEOUT_EXPIRED);
+
+    if (status == GL_TIMEOUT_EXPIRED) {
+      break;
+    }
+    glDeleteSync(staging.fence);
+    staging.fence = nullptr;
+    free_staging_.push_back(in_flight_.front());
+    in_flight_.pop_front();
+    if (status == GL_WAIT_FAILED) {
+      cerr << "glClientWaitSync failed with error code " << glGetError()
+           << '\n';
+      return unexpected(MakeErrorCode(kGLError));
+    }
+  }
+  return {};
+}
+
+auto TextureLoader::Upload(DecodedImage& image, StagingBuffer& staging)
+    -> Expected<Texture> {
+  Texture texture{.id = 0,
+                  .width = image.width,
+                  .height = image.height,
+                  .levels = 1};
+  if (options_.generate_mipmaps) {
+    texture.levels = std::bit_width(
+        static_cast<unsigned int>(std::max(image.width, image.height)));
+  }
+  const auto size = static_cast<long long int>(image.width) * image.height *
+                    kChannels;
+
+  GLint previous_texture = 0;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_texture);
+  glGenTextures(1, &texture.id);
+  glBindTexture(GL_TEXTURE_2D, texture.id);
+
+  // Storage is allocated before the unpack buffer is bound; with it bound the
+  // null pointers below would be read as offsets into it.
+  const char* allocate = "glTexStorage2D";
+  if (GLAD_GL_ARB_texture_storage != 0) {
+    glTexStorage2D(GL_TEXTURE_2D, texture.levels, GL_RGBA8, texture.width,
+                   texture.height);
+  } else {
+    allocate = "glTexImage2D";
+    for (int level = 0; level < texture.levels; ++level) {
+      glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8,
+                   std::max(1, texture.width >> level),
+                   std::max(1, texture.height >> level), 0, GL_RGBA,
+                   GL_UNSIGNED_BYTE, nullptr);
+    }
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture.levels - 1);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                  texture.levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  Expected<void> result = CheckGLCall(allocate);
+
+  if (result.has_value()) {
+    result = BindBuffer(kPixelUnpack, staging.buffer);
+  }
+  if (result.has_value() && size > staging.capacity) {
+    result = BufferData(kPixelUnpack, size, nullptr, kStreamDraw);
+    if (result.has_value()) {
+      staging.capacity = size;
+    }
+  }
+  if (result.has_value()) {
+    // The fence guarantees the GPU is done with the previous contents, so
+    // the driver needn't synchronize or keep them.
+    void* mapped = glMapBufferRange(
+        GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(size),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
+            GL_MAP_UNSYNCHRONIZED_BIT);
+    if (mapped == nullptr) {
+      cerr << "glMapBufferRange failed with error code " << glGetError()
+           << '\n';
+      result = unexpected(MakeErrorCode(kGLError));
+    } else {
+      std::memcpy(mapped, image.pixels.get(), static_cast<size_t>(size));
+      if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_FALSE) {
+        cerr << "glUnmapBuffer lost the staged pixels\n";
+        result = unexpected(MakeErrorCode(kGLError));
+      }
+    }
+  }
+  if (result.has_value()) {
+    // With the unpack buffer bound the pointer is an offset into it, and the
+    // copy into the texture can proceed without the CPU.
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture.width, texture.height,
+                    GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    result = CheckGLCall("glTexSubImage2D");
+  }
+
+  // Later uploads from client memory must not read from the buffer.
+  (void)BindBuffer(kPixelUnpack, 0);
+
+  if (result.has_value() && texture.levels > 1) {
+    glGenerateMipmap(GL_TEXTURE_2D);
+    result = CheckGLCall("glGenerateMipmap");
+  }
+  glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previous_texture));
+
+  if (result.has_value()) {
+    staging.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (staging.fence == nullptr) {
+      cerr << "glFenceSync failed with error code " << glGetError() << '\n';
+      result = unexpected(MakeErrorCode(kGLError));
+    }
+  }
+
+  if (!result.has_value()) {
+    glDeleteTextures(1, &texture.id);
+    return unexpected(result.error());
+  }
+  return texture;
+}
+
+auto TextureLoader::Poll() -> Expected<void> {
+  Expected<void> result = RetireStaging(false);
+  size_t uploaded_bytes = 0;
+  while (result.has_value() && !free_staging_.empty() &&
+         uploaded_bytes < options_.upload_budget_bytes) {
+    DecodedImage image;
+    {
+      lock_guard lock{mutex_};
+      if (decoded_.empty()) {
+        break;
+      }
+      image = std::move(decoded_.front());
+      decoded_.pop_front();
+    }
+    decoded_space_available_.notify_one();
+
+    const size_t index = free_staging_.front();
+    Expected<Texture> texture = Upload(image, staging_[index]);
+    if (texture.has_value()) {
+      free_staging_.pop_front();
+      in_flight_.push_back(index);
+      uploaded_bytes += static_cast<size_t>(texture->width) *
+                        static_cast<size_t>(texture->height) * kChannels;
+    } else {
+      result = unexpected(texture.error());
+    }
+    Complete(image.promise, std::move(texture));
+  }
+  return result;
+}
+
+auto TextureLoader::Flush() -> Expected<void> {
+  Expected<void> first_error{};
+  for (;;) {
+    Expected<void> result = Poll();
+    if (!result.has_value() && first_error.has_value()) {
+      first_error = result;
+    }
+
+    {
+      unique_lock lock{mutex_};
+      if (pending_count_ == 0) {
+        break;
+      }
+      if (decoded_.empty()) {
+        // Nothing to upload until a worker finishes decoding.
+        decoded_available_.wait(lock, [this]() {
+          return pending_count_ == 0 || !decoded_.empty();
+        });
+        continue;
+      }
+    }
+
+    // Decoded images are waiting, so every staging buffer must be busy.
+    result = RetireStaging(true);
+    if (!result.has_value() && first_error.has_value()) {
+      first_error = result;
+    }
+  }
+  return first_error;
+}
+
+auto TextureLoader::GetPendingCount() const -> size_t {
+  lock_guard lock{mutex_};
+  return pending_count_;
+}
+
+auto CreateITextureLoader(const TextureLoaderOptions& options)
+    -> Expected<ITextureLoaderPtr> {
+  auto loader = std::make_unique<TextureLoader>(options);
+  Expected<void> result = loader->Initialize();
+  if (!result.has_value()) {
+    cerr << "Texture loader initialization failed with error code "
+         << result.error().value() << ": " << result.error().message() << '\n';
+    return unexpected(result.error());
+  }
+
+  return loader;
+}
+
+auto DeleteTexture(Texture& texture) -> void {
+  if (texture.id != 0) {
+    glDeleteTextures(1, &texture.id);
+  }
+  texture = {};
+}
+
+}  // namespace graphics_engine::texture_loader
@@ -0,0 +1,102 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#ifndef ENGINE_LIB_TEXTURE_LOADER_H_
+#define ENGINE_LIB_TEXTURE_LOADER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "glad/glad.h"
+#include "graphics-engine/i-texture-loader.h"
+#include "graphics-engine/types.h"
+
+namespace graphics_engine::texture_loader {
+
+class TextureLoader : public ITextureLoader {
+ public:
+  explicit TextureLoader(const TextureLoaderOptions& options);
+  ~TextureLoader() override;
+
+  TextureLoader(const TextureLoader&) = delete;
+  TextureLoader(TextureLoader&&) = delete;
+  auto operator=(const TextureLoader&) -> TextureLoader& = delete;
+  auto operator=(TextureLoader&&) -> TextureLoader& = delete;
+
+  [[nodiscard]] auto Initialize() -> types::Expected<void>;
+
+  [[nodiscard]] auto Load(std::filesystem::path file) -> TextureFuture override;
+  [[nodiscard]] auto Poll() -> types::Expected<void> override;
+  [[nodiscard]] auto Flush() -> types::Expected<void> override;
+
+  [[nodiscard]] auto GetPendingCount() const -> std::size_t override;
+
+ private:
+  using Promise = std::promise<types::Expected<Texture>>;
+
+  // A file waiting for a worker.
+  struct Request {
+    std::filesystem::path file;
+    Promise promise;
+  };
+
+  // RGBA8 pixels waiting for upload, top row first.
+  struct DecodedImage {
+    Promise promise;
+    int width{};
+    int height{};
+    std::unique_ptr<std::uint8_t, void (*)(void*)> pixels{nullptr, nullptr};
+  };
+
+  // A kPixelUnpack buffer and the fence of the last upload read from it.
+  struct StagingBuffer {
+    unsigned int buffer{};
+    long long int capacity{};
+    GLsync fence{};
+  };
+
+  auto RunWorker() -> void;
+
+  // Free staging buffers the GPU is done with. With `block`, waits for the
+  // oldest one if none are free.
+  [[nodiscard]] auto RetireStaging(bool block) -> types::Expected<void>;
+
+  // Upload `image` through the staging buffer `staging` and complete its
+  // promise.
+  [[nodiscard]] auto Upload(DecodedImage& image, StagingBuffer& staging)
+      -> types::Expected<Texture>;
+
+  // Settle a promise and count the texture as no longer pending.
+  auto Complete(Promise& promise, types::Expected<Texture> texture) -> void;
+
+  const TextureLoaderOptions options_;
+
+  // Render thread only.
+  std::vector<StagingBuffer> staging_;
+  std::deque<std::size_t> in_flight_;  // Staging indices, oldest first.
+  std::deque<std::size_t> free_staging_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable request_available_;
+  std::condition_variable decoded_space_available_;
+  std::condition_variable decoded_available_;
+  std::deque<Request> requests_;
+  std::deque<DecodedImage> decoded_;
+  std::size_t pending_count_{};
+  bool stopping_{};
+
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace graphics_engine::texture_loader
+
+#endif  // ENGINE_LIB_TEXTURE_LOADER_H_
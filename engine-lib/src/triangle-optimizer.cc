@@ -0,0 +1,471 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include "graphics-engine/triangle-optimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
+
+using std::array;
+using std::atomic;
+using std::byte;
+using std::size_t;
+using std::span;
+using std::thread;
+using std::uint32_t;
+using std::vector;
+
+namespace graphics_engine::triangle_optimizer {
+
+namespace {
+
+// Scoring parameters from Forsyth's "Linear-Speed Vertex Cache Optimisation".
+constexpr size_t kModelledCacheSize = 32;
+constexpr float kCacheDecayPower = 1.5F;
+constexpr float kLastTriangleScore = 0.75F;
+constexpr float kValenceBoostScale = 2.F;
+constexpr float kValenceBoostPower = 0.5F;
+constexpr size_t kMaxScoredValence = 32;
+
+// Meshes with more triangles than this are optimized in chunks in parallel.
+constexpr size_t kTrianglesPerChunk = size_t{1} << 16;
+
+// Cache used to find cluster boundaries when optimizing overdraw.
+constexpr size_t kOverdrawCacheSize = 16;
+
+constexpr size_t kNoTriangle = std::numeric_limits<size_t>::max();
+constexpr uint32_t kNoVertex = std::numeric_limits<uint32_t>::max();
+
+struct ScoreTables {
+  array<float, kModelledCacheSize> cache{};
+  array<float, kMaxScoredValence + 1> valence{};
+};
+
+auto GetScoreTables() -> const ScoreTables& {
+  static const ScoreTables tables = [] {
+    ScoreTables result;
+    for (size_t i = 0; i < kModelledCacheSize; ++i) {
+      // The last triangle's vertices get a fixed score so the next triangle
+      // does not simply reuse the most recent edge.
+      result.cache[i] =
+          i < 3 ? kLastTriangleScore
+                : std::pow(1.F - static_cast<float>(i - 3) /
+                                     static_cast<float>(kModelledCacheSize - 3),
+                           kCacheDecayPower);
+    }
+    for (size_t i = 1; i <= kMaxScoredValence; ++i) {
+      // Vertices with few triangles left are finished off first.
+      result.valence[i] =
+          kValenceBoostScale *
+          std::pow(static_cast<float>(i), -kValenceBoostPower);
+    }
+    return result;
+  }();
+  return tables;
+}
+
+auto VertexScore(const ScoreTables& tables, int cache_position,
+                 uint32_t remaining) -> float {
+  if (remaining == 0) {
+    return -1.F;
+  }
+
+  const float cache_score =
+      cache_position < 0 ? 0.F
+                         : tables.cache[static_cast<size_t>(cache_position)];
+  return cache_score +
+         tables.valence[std::min<size_t>(remaining, kMaxScoredValence)];
+}
+
+// Forsyth's greedy optimization of one triangle list. `out` receives the
+// reordered triangles.
+auto OptimizeTriangles(span<const uint32_t> indices, size_t vertex_count,
+                       span<uint32_t> out) -> void {
+  const ScoreTables& tables = GetScoreTables();
+  const size_t triangle_count = indices.size() / 3;
+
+  // Triangles using each vertex; the first `remaining[v]` entries of a
+  // vertex's range are the triangles not emitted yet.
+  vector<uint32_t> remaining(vertex_count);
+  for (uint32_t index : indices) {
+    ++remaining[index];
+  }
+  vector<uint32_t> offsets(vertex_count + 1);
+  std::inclusive_scan(remaining.begin(), remaining.end(), offsets.begin() + 1);
+  vector<uint32_t> adjacency(indices.size());
+  {
+    vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < indices.size(); ++i) {
+      adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+  }
+
+  vector<int> cache_position(vertex_count, -1);
+  vector<float> vertex_score(vertex_count);
+  for (size_t v = 0; v < vertex_count; ++v) {
+    vertex_score[v] = VertexScore(tables, -1, remaining[v]);
+  }
+
+  vector<float> triangle_score(triangle_count);
+  vector<bool> emitted(triangle_count);
+  for (size_t t = 0; t < triangle_count; ++t) {
+    triangle_score[t] = vertex_score[indices[t * 3]] +
+                        vertex_score[indices[(t * 3) + 1]] +
+                        vertex_score[indices[(t * 3) + 2]];
+  }
+
+  vector<uint32_t> cache;
+  vector<uint32_t> next_cache;
+  cache.reserve(kModelledCacheSize + 3);
+  next_cache.reserve(kModelledCacheSize + 3);
+
+  size_t best = kNoTriangle;
+  size_t scan_cursor = 0;
+  for (size_t written = 0; written < triangle_count; ++written) {
+    if (best == kNoTriangle) {
+      // Nothing in the cache is connected to a pending triangle; restart at
+      // the next pending triangle in input order. Searching for the best
+      // score instead would make restarts quadratic.
+      while (emitted[scan_cursor]) {
+        ++scan_cursor;
+      }
+      best = scan_cursor;
+    }
+
+    const span<const uint32_t> triangle = indices.subspan(best * 3, 3);
+    std::ranges::copy(triangle, out.subspan(written * 3, 3).begin());
+    emitted[best] = true;
+
+    for (uint32_t v : triangle) {
+      const auto begin = adjacency.begin() + offsets[v];
+      const auto end = begin + remaining[v];
+      const auto it = std::find(begin, end, static_cast<uint32_t>(best));
+      assert(it != end);
+      *it = *(end - 1);
+      --remaining[v];
+    }
+
+    // The triangle's vertices move to the front of the cache.
+    next_cache.clear();
+    for (uint32_t v : triangle) {
+      if (std::ranges::find(next_cache, v) == next_cache.end()) {
+        next_cache.push_back(v);
+      }
+    }
+    for (uint32_t v : cache) {
+      if (std::ranges::find(triangle, v) == triangle.end()) {
+        next_cache.push_back(v);
+      }
+    }
+
+    for (size_t i = 0; i < next_cache.size(); ++i) {
+      const uint32_t v = next_cache[i];
+      cache_position[v] = i < kModelledCacheSize ? static_cast<int>(i) : -1;
+      const float score = VertexScore(tables, cache_position[v], remaining[v]);
+      const float delta = score - vertex_score[v];
+      vertex_score[v] = score;
+      for (uint32_t j = 0; j < remaining[v]; ++j) {
+        triangle_score[adjacency[offsets[v] + j]] += delta;
+      }
+    }
+
+    best = kNoTriangle;
+    float best_score = -1.F;
+    next_cache.resize(std::min(next_cache.size(), kModelledCacheSize));
+    for (uint32_t v : next_cache) {
+      for (uint32_t j = 0; j < remaining[v]; ++j) {
+        const uint32_t t = adjacency[offsets[v] + j];
+        if (triangle_score[t] > best_score) {
+          best_score = triangle_score[t];
+          best = t;
+        }
+      }
+    }
+    cache.swap(next_cache);
+  }
+}
+
+// Optimize a chunk of a larger mesh on its own compact vertex numbering, so
+// the per-vertex state is proportional to the chunk and not the mesh.
+auto OptimizeChunk(span<const uint32_t> indices, span<uint32_t> out) -> void {
+  vector<uint32_t> vertices(indices.begin(), indices.end());
+  std::ranges::sort(vertices);
+  vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                 vertices.end());
+
+  vector<uint32_t> local(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    local[i] = static_cast<uint32_t>(
+        std::ranges::lower_bound(vertices, indices[i]) - vertices.begin());
+  }
+
+  OptimizeTriangles(local, vertices.size(), out);
+  for (uint32_t& index : out) {
+    index = vertices[index];
+  }
+}
+
+struct Vector3 {
+  float x{};
+  float y{};
+  float z{};
+};
+
+auto GetPosition(span<const float> positions, uint32_t index) -> Vector3 {
+  return {.x = positions[index * 3],
+          .y = positions[(index * 3) + 1],
+          .z = positions[(index * 3) + 2]};
+}
+
+}  // namespace
+
+auto AnalyzeVertexCache(span<const uint32_t> indices, size_t vertex_count,
+                        size_t cache_size) -> VertexCacheStats {
+  if (indices.size() < 3 || cache_size == 0) {
+    return {};
+  }
+
+  // A vertex hits when fewer than `cache_size` misses happened since its own
+  // miss pushed it into the FIFO.
+  vector<size_t> pushed_at(vertex_count, 0);
+  vector<bool> referenced(vertex_count);
+  size_t misses = 0;
+  size_t referenced_count = 0;
+  for (uint32_t index : indices) {
+    assert(index < vertex_count);
+    if (!referenced[index]) {
+      referenced[index] = true;
+      ++referenced_count;
+    }
+
+    if (pushed_at[index] == 0 || misses - pushed_at[index] + 1 > cache_size) {
+      ++misses;
+      pushed_at[index] = misses;
+    }
+  }
+
+  return {.acmr = static_cast<float>(misses) /
+                  static_cast<float>(indices.size() / 3),
+          .atvr = static_cast<float>(misses) /
+                  static_cast<float>(referenced_count)};
+}
+
+auto OptimizeVertexCache(span<const uint32_t> indices, size_t vertex_count)
+    -> vector<uint32_t> {
+  assert(indices.size() % 3 == 0);
+  vector<uint32_t> result(indices.size());
+  const size_t triangle_count = indices.size() / 3;
+  if (triangle_count <= kTrianglesPerChunk) {
+    OptimizeTriangles(indices, vertex_count, result);
+    return result;
+  }
+
+  // Chunks have to be spatially coherent to optimize well on their own, even
+  // if the input triangle order is not. Vertex numbering usually is, so group
+  // the triangles by their smallest vertex.
+  vector<uint32_t> min_vertex(triangle_count);
+  for (size_t t = 0; t < triangle_count; ++t) {
+    min_vertex[t] = std::min({indices[t * 3], indices[(t * 3) + 1],
+                              indices[(t * 3) + 2]});
+  }
+  vector<uint32_t> order(triangle_count);
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::stable_sort(order, {}, [&min_vertex](uint32_t t) {
+    return min_vertex[t];
+  });
+  vector<uint32_t> grouped(indices.size());
+  for (size_t i = 0; i < triangle_count; ++i) {
+    std::ranges::copy(indices.subspan(order[i] * size_t{3}, 3),
+                      span(grouped).subspan(i * 3, 3).begin());
+  }
+
+  const size_t chunk_count =
+      (triangle_count + kTrianglesPerChunk - 1) / kTrianglesPerChunk;
+  const size_t thread_count = std::clamp<size_t>(
+      thread::hardware_concurrency(), 1, chunk_count);
+
+  atomic<size_t> next_chunk{0};
+  auto work = [&] {
+    for (size_t chunk = next_chunk++; chunk < chunk_count;
+         chunk = next_chunk++) {
+      const size_t first = chunk * kTrianglesPerChunk * 3;
+      const size_t count =
+          std::min(kTrianglesPerChunk * 3, indices.size() - first);
+      OptimizeChunk(span<const uint32_t>(grouped).subspan(first, count),
+                    span(result).subspan(first, count));
+    }
+  };
+
+  vector<thread> threads;
+  threads.reserve(thread_count - 1);
+  for (size_t i = 1; i < thread_count; ++i) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (thread& worker : threads) {
+    worker.join();
+  }
+
+  return result;
+}
+
+auto OptimizeOverdraw(span<const uint32_t> indices, span<const float> positions,
+                      float threshold) -> vector<uint32_t> {
+  assert(indices.size() % 3 == 0);
+  const size_t vertex_count = positions.size() / 3;
+  const size_t triangle_count = indices.size() / 3;
+
+  // Split wherever the cache order restarts: a triangle whose three vertices
+  // all miss shares nothing with what came before it.
+  vector<size_t> cluster_starts{0};
+  {
+    vector<size_t> pushed_at(vertex_count, 0);
+    size_t misses = 0;
+    for (size_t t = 0; t < triangle_count; ++t) {
+      int triangle_misses = 0;
+      for (uint32_t index : indices.subspan(t * 3, 3)) {
+        assert(index < vertex_count);
+        if (pushed_at[index] == 0 ||
+            misses - pushed_at[index] + 1 > kOverdrawCacheSize) {
+          ++misses;
+          ++triangle_misses;
+          pushed_at[index] = misses;
+        }
+      }
+      if (triangle_misses == 3 && t != 0) {
+        cluster_starts.push_back(t);
+      }
+    }
+  }
+  cluster_starts.push_back(triangle_count);
+
+  const size_t cluster_count = cluster_starts.size() - 1;
+  if (cluster_count < 2) {
+    return {indices.begin(), indices.end()};
+  }
+
+  // Area-weighted centroid and normal of every cluster and of the mesh.
+  vector<Vector3> centroids(cluster_count);
+  vector<Vector3> normals(cluster_count);
+  Vector3 mesh_centroid;
+  float mesh_area = 0.F;
+  for (size_t c = 0; c < cluster_count; ++c) {
+    float cluster_area = 0.F;
+    for (size_t t = cluster_starts[c]; t < cluster_starts[c + 1]; ++t) {
+      const Vector3 a = GetPosition(positions, indices[t * 3]);
+      const Vector3 b = GetPosition(positions, indices[(t * 3) + 1]);
+      const Vector3 p = GetPosition(positions, indices[(t * 3) + 2]);
+      const Vector3 ab{.x = b.x - a.x, .y = b.y - a.y, .z = b.z - a.z};
+      const Vector3 ap{.x = p.x - a.x, .y = p.y - a.y, .z = p.z - a.z};
+      const Vector3 normal{.x = (ab.y * ap.z) - (ab.z * ap.y),
+                           .y = (ab.z * ap.x) - (ab.x * ap.z),
+                           .z = (ab.x * ap.y) - (ab.y * ap.x)};
+      const float area = std::sqrt((normal.x * normal.x) +
+                                   (normal.y * normal.y) +
+                                   (normal.z * normal.z));
+      const float weight = area / 3.F;
+
+      centroids[c].x += (a.x + b.x + p.x) * weight;
+      centroids[c].y += (a.y + b.y + p.y) * weight;
+      centroids[c].z += (a.z + b.z + p.z) * weight;
+      normals[c].x += normal.x;
+      normals[c].y += normal.y;
+      normals[c].z += normal.z;
+      cluster_area += area;
+    }
+
+    mesh_centroid.x += centroids[c].x;
+    mesh_centroid.y += centroids[c].y;
+    mesh_centroid.z += centroids[c].z;
+    mesh_area += cluster_area;
+    if (cluster_area > 0.F) {
+      centroids[c].x /= cluster_area;
+      centroids[c].y /= cluster_area;
+      centroids[c].z /= cluster_area;
+    }
+  }
+  if (mesh_area > 0.F) {
+    mesh_centroid.x /= mesh_area;
+    mesh_centroid.y /= mesh_area;
+    mesh_centroid.z /= mesh_area;
+  }
+
+  // Clusters facing away from the mesh center occlude the rest, so draw them
+  // first.
+  vector<float> sort_keys(cluster_count);
+  for (size_t c = 0; c < cluster_count; ++c) {
+    const Vector3& n = normals[c];
+    const float length = std::sqrt((n.x * n.x) + (n.y * n.y) + (n.z * n.z));
+    sort_keys[c] =
+        length > 0.F ? (((centroids[c].x - mesh_centroid.x) * n.x) +
+                        ((centroids[c].y - mesh_centroid.y) * n.y) +
+                        ((centroids[c].z - mesh_centroid.z) * n.z)) /
+                           length
+                     : 0.F;
+  }
+
+  vector<size_t> order(cluster_count);
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::stable_sort(order, [&sort_keys](size_t lhs, size_t rhs) {
+    return sort_keys[lhs] > sort_keys[rhs];
+  });
+
+  vector<uint32_t> result;
+  result.reserve(indices.size());
+  for (size_t c : order) {
+    const size_t first = cluster_starts[c] * 3;
+    const size_t last = cluster_starts[c + 1] * 3;
+    const span<const uint32_t> cluster = indices.subspan(first, last - first);
+    result.insert(result.end(), cluster.begin(), cluster.end());
+  }
+
+  const float acmr_before =
+      AnalyzeVertexCache(indices, vertex_count, kOverdrawCacheSize).acmr;
+  const float acmr_after =
+      AnalyzeVertexCache(result, vertex_count, kOverdrawCacheSize).acmr;
+  if (acmr_after > acmr_before * threshold) {
+    return {indices.begin(), indices.end()};
+  }
+
+  return result;
+}
+
+auto OptimizeVertexFetch(span<uint32_t> indices, span<const byte> vertices,
+                         size_t vertex_stride) -> vector<byte> {
+  assert(vertex_stride > 0 && vertices.size() % vertex_stride == 0);
+  const size_t vertex_count = vertices.size() / vertex_stride;
+
+  vector<uint32_t> remap(vertex_count, kNoVertex);
+  uint32_t next_vertex = 0;
+  for (uint32_t& index : indices) {
+    assert(index < vertex_count);
+    if (remap[index] == kNoVertex) {
+      remap[index] = next_vertex++;
+    }
+    index = remap[index];
+  }
+
+  vector<byte> result(next_vertex * vertex_stride);
+  for (size_t v = 0; v < vertex_count; ++v) {
+    if (remap[v] != kNoVertex) {
+      std::memcpy(result.data() + (remap[v] * vertex_stride),
+                  vertices.data() + (v * vertex_stride), vertex_stride);
+    }
+  }
+
+  return result;
+}
+
+}  // namespace graphics_engine::triangle_optimizer
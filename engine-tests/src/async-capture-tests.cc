@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-async-capture.h>
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <glm/vec4.hpp>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::async_capture::CaptureFuture;
+using graphics_engine::async_capture::CapturedFrame;
+using graphics_engine::async_capture::CreateIAsyncCapture;
+using graphics_engine::async_capture::IAsyncCapturePtr;
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::engine::Render;
+using graphics_engine::engine::SetBackgroundColor;
+using graphics_engine::types::Expected;
+
+using glm::vec4;
+
+using std::byte;
+using std::future_status;
+using std::size_t;
+using std::vector;
+
+using testing::Test;
+
+namespace graphics_engine_tests::async_capture_tests {
+
+struct AsyncCaptureTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+};
+
+TEST_F(AsyncCaptureTestFixture, ZeroBuffersIsRejected) {
+  Expected<IAsyncCapturePtr> result = CreateIAsyncCapture(0);
+  EXPECT_FALSE(result.has_value());
+}
+
+TEST_F(AsyncCaptureTestFixture, CaptureResolvesOnFlush) {
+  Expected<IAsyncCapturePtr> create_result = CreateIAsyncCapture();
+  ASSERT_TRUE(create_result.has_value());
+  IAsyncCapturePtr capture = std::move(*create_result);
+
+  SetBackgroundColor(vec4{1.0F, 0.0F, 0.0F, 1.0F});
+  ASSERT_TRUE(Render().has_value());
+
+  Expected<CaptureFuture> capture_result = capture->Capture();
+  ASSERT_TRUE(capture_result.has_value());
+  EXPECT_EQ(capture->GetPendingCount(), 1);
+
+  ASSERT_TRUE(capture->Flush().has_value());
+  EXPECT_EQ(capture->GetPendingCount(), 0);
+  ASSERT_EQ(capture_result->wait_for(std::chrono::seconds{0}),
+            future_status::ready);
+
+  Expected<CapturedFrame> frame = capture_result->get();
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(frame->width, 640);
+  EXPECT_EQ(frame->height, 480);
+  ASSERT_EQ(frame->pixels.size(), size_t{640} * 480 * 4);
+  EXPECT_EQ(frame->pixels[0], byte{255});
+  EXPECT_EQ(frame->pixels[1], byte{0});
+  EXPECT_EQ(frame->pixels[2], byte{0});
+  EXPECT_EQ(frame->pixels[3], byte{255});
+}
+
+TEST_F(AsyncCaptureTestFixture, MoreCapturesThanBuffers) {
+  constexpr size_t kBufferCount = 2;
+  constexpr size_t kFrameCount = 5;
+
+  Expected<IAsyncCapturePtr> create_result =
+      CreateIAsyncCapture(kBufferCount);
+  ASSERT_TRUE(create_result.has_value());
+  IAsyncCapturePtr capture = std::move(*create_result);
+
+  vector<CaptureFuture> futures;
+  for (size_t i = 0; i < kFrameCount; ++i) {
+    const float green = static_cast<float>(i) / kFrameCount;
+    SetBackgroundColor(vec4{0.0F, green, 0.0F, 1.0F});
+    ASSERT_TRUE(Render().has_value());
+
+    Expected<CaptureFuture> capture_result = capture->Capture();
+    ASSERT_TRUE(capture_result.has_value());
+    EXPECT_LE(capture->GetPendingCount(), kBufferCount);
+    futures.push_back(std::move(*capture_result));
+  }
+
+  ASSERT_TRUE(capture->Flush().has_value());
+
+  for (size_t i = 0; i < kFrameCount; ++i) {
+    Expected<CapturedFrame> frame = futures[i].get();
+    ASSERT_TRUE(frame.has_value());
+    ASSERT_FALSE(frame->pixels.empty());
+    const auto expected_green =
+        static_cast<int>(static_cast<float>(i) / kFrameCount * 255.0F + 0.5F);
+    EXPECT_NEAR(static_cast<int>(frame->pixels[1]), expected_green, 1);
+  }
+}
+
+}  // namespace graphics_engine_tests::async_capture_tests
@@ -0,0 +1,144 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <graphics-engine/i-capture-writer.h>
+#include <graphics-engine/image.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::async_capture::CapturedFrame;
+using graphics_engine::capture_writer::CaptureWriterOptions;
+using graphics_engine::capture_writer::CreateICaptureWriter;
+using graphics_engine::capture_writer::ICaptureWriterPtr;
+using graphics_engine::image::AreIdentical;
+using graphics_engine::image::CompareImages;
+using graphics_engine::image::CompareOptions;
+using graphics_engine::image::CompareResult;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::size_t;
+using std::to_string;
+using std::filesystem::path;
+using std::filesystem::temp_directory_path;
+
+namespace graphics_engine_tests::capture_writer_tests {
+
+namespace {
+
+constexpr int kWidth = 64;
+constexpr int kHeight = 32;
+
+// A black frame whose first row in memory, the bottom row on screen, is red.
+auto MakeFrame() -> CapturedFrame {
+  CapturedFrame frame{.width = kWidth,
+                      .height = kHeight,
+                      .pixels = std::vector<byte>(
+                          static_cast<size_t>(kWidth) * kHeight * 4)};
+  for (size_t i = 3; i < frame.pixels.size(); i += 4) {
+    frame.pixels[i] = byte{255};
+  }
+  for (size_t x = 0; x < kWidth; ++x) {
+    frame.pixels[x * 4] = byte{255};
+  }
+  return frame;
+}
+
+auto MakeBlackFrame() -> CapturedFrame {
+  CapturedFrame frame = MakeFrame();
+  for (size_t x = 0; x < kWidth; ++x) {
+    frame.pixels[x * 4] = byte{0};
+  }
+  return frame;
+}
+
+auto CreateWriter(const CaptureWriterOptions& options = {})
+    -> ICaptureWriterPtr {
+  Expected<ICaptureWriterPtr> result = CreateICaptureWriter(options);
+  EXPECT_TRUE(result.has_value());
+  return result.has_value() ? std::move(*result) : nullptr;
+}
+
+}  // namespace
+
+TEST(CaptureWriterTests, RejectsEmptyPool) {
+  EXPECT_FALSE(CreateICaptureWriter({.worker_count = 0}).has_value());
+  EXPECT_FALSE(CreateICaptureWriter({.queue_capacity = 0}).has_value());
+}
+
+TEST(CaptureWriterTests, RejectsMismatchedPixelCount) {
+  ICaptureWriterPtr writer = CreateWriter();
+  ASSERT_NE(writer, nullptr);
+
+  CapturedFrame frame = MakeFrame();
+  frame.pixels.pop_back();
+  EXPECT_FALSE(
+      writer->Submit(std::move(frame), temp_directory_path() / "bad.png")
+          .has_value());
+}
+
+TEST(CaptureWriterTests, FlipsRowsToTopDown) {
+  ICaptureWriterPtr writer = CreateWriter();
+  ASSERT_NE(writer, nullptr);
+
+  const path red_bottom = temp_directory_path() / "capture-writer-flip.png";
+  const path black = temp_directory_path() / "capture-writer-black.png";
+  ASSERT_TRUE(writer->Submit(MakeFrame(), red_bottom).has_value());
+  ASSERT_TRUE(writer->Submit(MakeBlackFrame(), black).has_value());
+  ASSERT_TRUE(writer->Flush().has_value());
+  EXPECT_EQ(writer->GetPendingCount(), 0);
+
+  // Only the last row of the png may differ from the black frame.
+  Expected<CompareResult> result = CompareImages(red_bottom, black);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->mismatch_count, static_cast<size_t>(kWidth));
+  EXPECT_EQ(result->mismatch_bounds.y, kHeight - 1);
+  EXPECT_EQ(result->mismatch_bounds.height, 1);
+}
+
+TEST(CaptureWriterTests, BurstIsBoundedAndFullyWritten) {
+  constexpr int kFrameCount = 16;
+  constexpr CaptureWriterOptions kOptions{.worker_count = 2,
+                                          .queue_capacity = 1};
+  ICaptureWriterPtr writer = CreateWriter(kOptions);
+  ASSERT_NE(writer, nullptr);
+
+  for (int i = 0; i < kFrameCount; ++i) {
+    const path png =
+        temp_directory_path() / ("capture-writer-" + to_string(i) + ".png");
+    ASSERT_TRUE(writer->Submit(MakeFrame(), png).has_value());
+    EXPECT_LE(writer->GetPendingCount(),
+              kOptions.worker_count + kOptions.queue_capacity);
+  }
+  ASSERT_TRUE(writer->Flush().has_value());
+
+  const path first = temp_directory_path() / "capture-writer-0.png";
+  for (int i = 1; i < kFrameCount; ++i) {
+    const path png =
+        temp_directory_path() / ("capture-writer-" + to_string(i) + ".png");
+    Expected<bool> identical = AreIdentical(first, png);
+    ASSERT_TRUE(identical.has_value());
+    EXPECT_TRUE(*identical);
+  }
+}
+
+TEST(CaptureWriterTests, FlushReportsWriteFailures) {
+  ICaptureWriterPtr writer = CreateWriter();
+  ASSERT_NE(writer, nullptr);
+
+  const path missing_dir =
+      temp_directory_path() / "capture-writer-missing" / "frame.png";
+  ASSERT_TRUE(writer->Submit(MakeFrame(), missing_dir).has_value());
+  EXPECT_FALSE(writer->Flush().has_value());
+
+  // The error is reported once.
+  EXPECT_TRUE(writer->Flush().has_value());
+}
+
+}  // namespace graphics_engine_tests::capture_writer_tests
@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/gl-wrappers.h>
+#include <graphics-engine/i-command-buffer.h>
+#include <graphics-engine/i-command-queue.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::gl_types::GLErrorPolicy;
+
+using graphics_engine::command_buffer::CreateICommandBuffer;
+using graphics_engine::command_buffer::ICommandBufferPtr;
+using graphics_engine::command_queue::CreateICommandQueue;
+using graphics_engine::command_queue::ICommandQueuePtr;
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::gl_wrappers::GetStateCacheStats;
+using graphics_engine::gl_wrappers::InvalidateStateCache;
+using graphics_engine::gl_wrappers::ResetStateCacheStats;
+using graphics_engine::gl_wrappers::SetErrorPolicy;
+using graphics_engine::gl_wrappers::StateCacheStats;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::jthread;
+using std::vector;
+
+using testing::Test;
+
+namespace graphics_engine_tests::command_buffer_tests {
+
+struct CommandBufferTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+};
+
+TEST(CommandBufferTests, RecordingStopsAtCommandCapacity) {
+  ICommandBufferPtr buffer = CreateICommandBuffer(2, 0);
+  ASSERT_TRUE(buffer->UseProgram(0).has_value());
+  ASSERT_TRUE(buffer->BindVertexArray(0).has_value());
+
+  Expected<void> result = buffer->BindVertexArray(0);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().message(), "Command buffer is full.");
+  ASSERT_EQ(buffer->GetNumCommands(), 2U);
+
+  buffer->Reset();
+  ASSERT_EQ(buffer->GetNumCommands(), 0U);
+  ASSERT_TRUE(buffer->UseProgram(0).has_value());
+}
+
+TEST(CommandBufferTests, BufferDataCopiesIntoPayloadStorage) {
+  const array<float, 3> vertices{1.F, 2.F, 3.F};
+  ICommandBufferPtr buffer = CreateICommandBuffer(8, sizeof(vertices));
+
+  ASSERT_TRUE(buffer->BufferData(kArray, sizeof(vertices), vertices.data(),
+                                 kStaticDraw)
+                  .has_value());
+  ASSERT_EQ(buffer->GetPayloadSize(), sizeof(vertices));
+
+  // No payload room left, but a data-less BufferData needs none.
+  Expected<void> result =
+      buffer->BufferData(kArray, 1, vertices.data(), kStaticDraw);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().message(), "Command buffer is full.");
+  ASSERT_TRUE(
+      buffer->BufferData(kArray, 1024, nullptr, kStaticDraw).has_value());
+  ASSERT_EQ(buffer->GetNumCommands(), 2U);
+
+  result = buffer->BufferData(kArray, -1, nullptr, kStaticDraw);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().message(), "OpenGL Error: Invalid Value.");
+}
+
+TEST(CommandBufferTests, SubmitStopsAtQueueCapacity) {
+  ICommandBufferPtr buffer = CreateICommandBuffer(1, 0);
+  ICommandQueuePtr queue = CreateICommandQueue(1);
+  ASSERT_TRUE(queue->Submit(*buffer).has_value());
+
+  Expected<void> result = queue->Submit(*buffer);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().message(), "Command queue is full.");
+  ASSERT_EQ(queue->GetNumSubmitted(), 1U);
+}
+
+TEST_F(CommandBufferTestFixture, ExecutesBuffersRecordedOnWorkerThreads) {
+  SetErrorPolicy(kCheckEveryCall);
+  InvalidateStateCache();
+  ResetStateCacheStats();
+
+  constexpr int kNumWorkers = 4;
+  vector<ICommandBufferPtr> buffers;
+  for (int i = 0; i < kNumWorkers; ++i) {
+    buffers.push_back(CreateICommandBuffer(2, 0));
+  }
+
+  ICommandQueuePtr queue = CreateICommandQueue(kNumWorkers);
+  {
+    vector<jthread> workers;
+    for (const ICommandBufferPtr& buffer : buffers) {
+      workers.emplace_back([&buffer, &queue]() {
+        ASSERT_TRUE(buffer->UseProgram(0).has_value());
+        ASSERT_TRUE(buffer->BindVertexArray(0).has_value());
+        ASSERT_TRUE(queue->Submit(*buffer).has_value());
+      });
+    }
+  }
+
+  ASSERT_EQ(queue->GetNumSubmitted(), static_cast<size_t>(kNumWorkers));
+  ASSERT_TRUE(queue->ExecuteSubmitted().has_value());
+  ASSERT_EQ(queue->GetNumSubmitted(), 0U);
+
+  // Every buffer set the same state, so only the first one reached GL.
+  const StateCacheStats stats = GetStateCacheStats();
+  ASSERT_EQ(stats.issued, 2U);
+  ASSERT_EQ(stats.skipped, 2U * (kNumWorkers - 1));
+}
+
+}  // namespace graphics_engine_tests::command_buffer_tests
@@ -2,8 +2,11 @@
 // This source code is licensed under the MIT License. See LICENSE file in the
 // project root for details.
 
+#include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "GLFW/glfw3.h"
@@ -18,8 +21,18 @@ using ::graphics_engine::engine::Render;
 using ::graphics_engine::engine::SetBackgroundColor;
 using ::graphics_engine::image::AreIdentical;
 using ::graphics_engine::image::CaptureScreenshot;
+using ::graphics_engine::image::CompareImages;
+using ::graphics_engine::image::CompareOptions;
+using ::graphics_engine::image::CompareResult;
+using ::graphics_engine::image::EncodeImage;
+using ::graphics_engine::image::EncodeOptions;
+using ::graphics_engine::image::GetExtension;
+using ::graphics_engine::image::ImageFormat;
+using ::graphics_engine::image::ImageView;
 using ::graphics_engine::types::Expected;
+using enum ::graphics_engine::types::ErrorCode;
 
+using ::std::byte;
 using ::std::ifstream;
 using ::std::ofstream;
 using ::std::filesystem::exists;
@@ -28,6 +41,9 @@ using ::std::filesystem::permissions;
 using enum ::std::filesystem::perms;
 using ::std::filesystem::remove;
 using ::std::filesystem::temp_directory_path;
+using ::std::size_t;
+using ::std::to_underlying;
+using ::std::vector;
 
 using ::testing::EmptyTestEventListener;
 using ::testing::InitGoogleTest;
@@ -102,6 +118,249 @@ TEST(EngineTests, AreIdenticalWorksWithDifferentSizedFiles) {
   ASSERT_FALSE(expected_comparison.value());
 }
 
+TEST(EngineTests, CompareImagesReportsMismatches) {
+  Expected<CompareResult> result =
+      CompareImages(path("screenshots/hello-window.png"),
+                    path("screenshots/hello-window-modified.png"));
+  ASSERT_TRUE(result.has_value());
+  ASSERT_TRUE(result->same_dimensions);
+  ASSERT_FALSE(result->Matches());
+  ASSERT_EQ(result->mismatch_count, 640U * 480U);
+  ASSERT_EQ(result->mismatch_bounds.x, 0);
+  ASSERT_EQ(result->mismatch_bounds.y, 0);
+  ASSERT_EQ(result->mismatch_bounds.width, 640);
+  ASSERT_EQ(result->mismatch_bounds.height, 480);
+}
+
+TEST(EngineTests, CompareImagesHonorsTolerance) {
+  // Every channel of the modified file is off by less than 32.
+  Expected<CompareResult> result = CompareImages(
+      path("screenshots/hello-window.png"),
+      path("screenshots/hello-window-modified.png"),
+      CompareOptions{.tolerance = {32, 32, 32, 32}});
+  ASSERT_TRUE(result.has_value());
+  ASSERT_TRUE(result->Matches());
+}
+
+TEST(EngineTests, CompareImagesSkipsIgnoredRegions) {
+  Expected<CompareResult> result =
+      CompareImages(path("screenshots/hello-window.png"),
+                    path("screenshots/hello-window-modified.png"),
+                    CompareOptions{.ignore_regions = {{.x = 0,
+                                                       .y = 0,
+                                                       .width = 320,
+                                                       .height = 480}}});
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->mismatch_count, 320U * 480U);
+  ASSERT_EQ(result->mismatch_bounds.x, 320);
+  ASSERT_EQ(result->mismatch_bounds.width, 320);
+}
+
+TEST(EngineTests, CompareImagesWritesHeatmap) {
+  const path heatmap{temp_directory_path() / "heatmap.png"};
+  remove(heatmap);
+
+  Expected<CompareResult> result =
+      CompareImages(path("screenshots/hello-window.png"),
+                    path("screenshots/hello-window-modified.png"),
+                    CompareOptions{.heatmap = heatmap});
+  ASSERT_TRUE(result.has_value());
+  ASSERT_TRUE(exists(heatmap));
+
+  Expected<CompareResult> heatmap_size =
+      CompareImages(heatmap, path("screenshots/hello-window.png"));
+  ASSERT_TRUE(heatmap_size.has_value());
+  ASSERT_TRUE(heatmap_size->same_dimensions);
+  remove(heatmap);
+}
+
+TEST(EngineTests, CompareImagesWritesHeatmapOnlyOnMismatch) {
+  const path heatmap{temp_directory_path() / "heatmap-on-mismatch.png"};
+  remove(heatmap);
+  const CompareOptions options{.heatmap = heatmap,
+                               .heatmap_only_on_mismatch = true};
+
+  Expected<CompareResult> same =
+      CompareImages(path("screenshots/hello-window.png"),
+                    path("screenshots/hello-window.png"), options);
+  ASSERT_TRUE(same.has_value());
+  ASSERT_TRUE(same->Matches());
+  ASSERT_FALSE(exists(heatmap));
+
+  Expected<CompareResult> different =
+      CompareImages(path("screenshots/hello-window.png"),
+                    path("screenshots/hello-window-modified.png"), options);
+  ASSERT_TRUE(different.has_value());
+  ASSERT_EQ(different->mismatch_count, 640U * 480U);
+  ASSERT_TRUE(exists(heatmap));
+  remove(heatmap);
+}
+
+TEST(EngineTests, CompareImagesWorksWithDifferentSizedFiles) {
+  Expected<CompareResult> result =
+      CompareImages(path("screenshots/hello-window.png"),
+                    path("screenshots/hello-window-resized.png"));
+  ASSERT_TRUE(result.has_value());
+  ASSERT_FALSE(result->same_dimensions);
+  ASSERT_FALSE(result->Matches());
+}
+
+namespace {
+
+// A gradient with a translucent stripe, bottom row first.
+auto MakeGradient(int width, int height, int channels) -> vector<byte> {
+  vector<byte> pixels(static_cast<size_t>(width) * height * channels);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      byte* pixel =
+          &pixels[((static_cast<size_t>(y) * width) + x) * channels];
+      for (int c = 0; c < channels; ++c) {
+        pixel[c] = static_cast<byte>((x * (c + 1)) + (y * 3));
+      }
+      if (channels == 4 && y % 8 == 0) {
+        pixel[3] = byte{128};
+      }
+    }
+  }
+  return pixels;
+}
+
+auto WriteEncoded(const ImageView& image, const EncodeOptions& options,
+                  const path& file) -> bool {
+  Expected<vector<byte>> encoded = EncodeImage(image, options);
+  if (!encoded.has_value()) {
+    return false;
+  }
+  ofstream out(file, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(encoded->data()),
+            static_cast<std::streamsize>(encoded->size()));
+  return static_cast<bool>(out);
+}
+
+}  // namespace
+
+TEST(EngineTests, AreIdenticalReadsEveryEncodeFormat) {
+  constexpr int kWidth = 97;
+  constexpr int kHeight = 61;
+  const vector<byte> rgba = MakeGradient(kWidth, kHeight, 4);
+  const ImageView image{.width = kWidth,
+                        .height = kHeight,
+                        .channels = 4,
+                        .pixels = rgba,
+                        .bottom_up = true};
+
+  const path reference = temp_directory_path() / "encode-reference.png";
+  ASSERT_TRUE(WriteEncoded(image, {}, reference));
+
+  const vector<EncodeOptions> formats = {
+      {.format = ImageFormat::kPng, .png_compression_level = 0},
+      {.format = ImageFormat::kPng, .png_compression_level = 1},
+      {.format = ImageFormat::kPng, .png_compression_level = 9},
+      {.format = ImageFormat::kQoi},
+      {.format = ImageFormat::kPam},
+  };
+  for (const EncodeOptions& options : formats) {
+    const path file =
+        temp_directory_path() /
+        ("encode-" + std::to_string(options.png_compression_level) +
+         std::string(GetExtension(options.format)));
+    ASSERT_TRUE(WriteEncoded(image, options, file));
+
+    Expected<bool> identical = AreIdentical(reference, file);
+    ASSERT_TRUE(identical.has_value()) << file;
+    EXPECT_TRUE(*identical) << file;
+    remove(file);
+  }
+  remove(reference);
+}
+
+// Opaque black hashes to index slot 53, which the spec starts as transparent
+// black, so it must not be encoded as QOI_OP_INDEX.
+TEST(EngineTests, EncodeQoiMatchesReferenceBytes) {
+  const vector<byte> rgba = {byte{255}, byte{0}, byte{0}, byte{255},
+                             byte{0},   byte{0}, byte{0}, byte{255}};
+  const ImageView image{
+      .width = 2, .height = 1, .channels = 4, .pixels = rgba};
+  Expected<vector<byte>> encoded =
+      EncodeImage(image, {.format = ImageFormat::kQoi});
+  ASSERT_TRUE(encoded.has_value());
+
+  const vector<byte> reference = {
+      byte{'q'}, byte{'o'}, byte{'i'}, byte{'f'},   // magic
+      byte{0},   byte{0},   byte{0},   byte{2},     // width
+      byte{0},   byte{0},   byte{0},   byte{1},     // height
+      byte{4},   byte{0},                           // channels, colorspace
+      byte{0x5A},                                   // QOI_OP_DIFF to red
+      byte{0x7A},                                   // QOI_OP_DIFF to black
+      byte{0},   byte{0},   byte{0},   byte{0},   byte{0},
+      byte{0},   byte{0},   byte{1}};               // end marker
+  EXPECT_EQ(*encoded, reference);
+}
+
+TEST(EngineTests, DecodeQoiStartsIndexAtTransparentBlack) {
+  // A 1x1 file whose only op is QOI_OP_INDEX 53.
+  const std::string qoi = {'q', 'o', 'i', 'f', 0, 0, 0, 1, 0, 0, 0, 1, 4, 0,
+                           0x35, 0, 0, 0, 0, 0, 0, 0, 1};
+  const path qoi_file = temp_directory_path() / "decode-index.qoi";
+  ofstream(qoi_file, std::ios::binary)
+      .write(qoi.data(), static_cast<std::streamsize>(qoi.size()));
+
+  const vector<byte> transparent(4, byte{0});
+  const path png_file = temp_directory_path() / "decode-index.png";
+  ASSERT_TRUE(WriteEncoded(
+      {.width = 1, .height = 1, .channels = 4, .pixels = transparent}, {},
+      png_file));
+
+  Expected<bool> identical = AreIdentical(png_file, qoi_file);
+  ASSERT_TRUE(identical.has_value());
+  EXPECT_TRUE(*identical);
+  remove(qoi_file);
+  remove(png_file);
+}
+
+TEST(EngineTests, AreIdenticalReadsPpm) {
+  constexpr int kWidth = 33;
+  constexpr int kHeight = 20;
+  const vector<byte> rgb = MakeGradient(kWidth, kHeight, 3);
+  const ImageView image{
+      .width = kWidth, .height = kHeight, .channels = 3, .pixels = rgb};
+
+  const path png = temp_directory_path() / "encode-rgb.png";
+  const path ppm = temp_directory_path() / "encode-rgb.ppm";
+  ASSERT_TRUE(WriteEncoded(image, {}, png));
+  ASSERT_TRUE(WriteEncoded(image, {.format = ImageFormat::kPpm}, ppm));
+
+  Expected<bool> identical = AreIdentical(png, ppm);
+  ASSERT_TRUE(identical.has_value());
+  EXPECT_TRUE(*identical);
+  remove(png);
+  remove(ppm);
+}
+
+TEST(EngineTests, EncodeImageRejectsMalformedViews) {
+  const vector<byte> pixels(16);
+  Expected<vector<byte>> empty =
+      EncodeImage({.width = 2, .height = 2, .channels = 4, .pixels = {}});
+  ASSERT_FALSE(empty.has_value());
+  EXPECT_EQ(empty.error().value(), to_underlying(kInvalidImage));
+  EXPECT_FALSE(
+      EncodeImage({.width = 2, .height = 2, .channels = 5, .pixels = pixels})
+          .has_value());
+  EXPECT_FALSE(
+      EncodeImage({.width = 0, .height = 2, .channels = 4, .pixels = pixels})
+          .has_value());
+}
+
+TEST(EngineTests, CompareImagesReportsUnwritableHeatmap) {
+  Expected<CompareResult> result = CompareImages(
+      path("screenshots/hello-window.png"),
+      path("screenshots/hello-window-modified.png"),
+      CompareOptions{.heatmap = temp_directory_path() / "missing-directory" /
+                                "heatmap.png"});
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().value(), to_underlying(kFileIoError));
+}
+
 TEST(EngineTests, InitializeEngineNoContext) {
   auto result = InitializeEngine();
   ASSERT_FALSE(result.has_value());
@@ -153,6 +412,24 @@ TEST_F(EngineTestFixture, SetBackgroundColor) {
   ASSERT_TRUE(expected_comparison.value());
 }
 
+TEST_F(EngineTestFixture, CaptureScreenshotInEveryFormat) {
+  SetBackgroundColor(vec4{0.2F, 0.3F, 0.3F, 1.0F});
+  ASSERT_TRUE(Render().has_value());
+
+  for (const ImageFormat format : {ImageFormat::kQoi, ImageFormat::kPam}) {
+    ASSERT_TRUE(
+        CaptureScreenshot(std::nullopt, {.format = format}).has_value());
+
+    const path file = temp_directory_path() /
+                      ("screenshot" + std::string(GetExtension(format)));
+    Expected<bool> identical =
+        AreIdentical(path("screenshots/hello-window.png"), file);
+    ASSERT_TRUE(identical.has_value());
+    EXPECT_TRUE(*identical);
+    remove(file);
+  }
+}
+
 //TEST_F(EngineTestFixture, Sandbox) {
 //  SetBackgroundColor(vec4{0.2F, 0.3F, 0.3F, 1.0F});
 //
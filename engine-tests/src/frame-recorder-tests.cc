@@ -0,0 +1,178 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-frame-recorder.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <glm/vec4.hpp>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::engine::Render;
+using graphics_engine::engine::SetBackgroundColor;
+using graphics_engine::frame_recorder::CreateIFrameRecorder;
+using graphics_engine::frame_recorder::FrameRecorderStats;
+using graphics_engine::frame_recorder::IFrameRecorderPtr;
+using graphics_engine::frame_recorder::ReadRecordingIndex;
+using graphics_engine::frame_recorder::RecordingIndex;
+using graphics_engine::types::Expected;
+
+using glm::vec4;
+
+using std::array;
+using std::size_t;
+using std::uint64_t;
+using std::filesystem::path;
+using std::filesystem::remove;
+using std::filesystem::temp_directory_path;
+
+using testing::Test;
+
+namespace graphics_engine_tests::frame_recorder_tests {
+
+struct FrameRecorderTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  void TearDown() override { remove(file_); }
+
+  const path file_{temp_directory_path() / "frame-recorder-test.gef"};
+};
+
+namespace {
+
+constexpr int kFrameCount = 12;
+
+auto GreenForFrame(uint64_t frame_number) -> float {
+  return static_cast<float>(frame_number) / kFrameCount;
+}
+
+}  // namespace
+
+TEST_F(FrameRecorderTestFixture, ZeroBuffersIsRejected) {
+  EXPECT_FALSE(CreateIFrameRecorder(file_, {.pool_size = 0}).has_value());
+  EXPECT_FALSE(
+      CreateIFrameRecorder(file_, {.readback_buffers = 0}).has_value());
+}
+
+TEST_F(FrameRecorderTestFixture, RecordsFramesInOrder) {
+  Expected<IFrameRecorderPtr> create_result = CreateIFrameRecorder(file_);
+  ASSERT_TRUE(create_result.has_value());
+  IFrameRecorderPtr recorder = std::move(*create_result);
+
+  for (int i = 0; i < kFrameCount; ++i) {
+    SetBackgroundColor(vec4{0.0F, GreenForFrame(i), 0.0F, 1.0F});
+    ASSERT_TRUE(Render().has_value());
+    ASSERT_TRUE(recorder->CaptureFrame().has_value());
+  }
+
+  Expected<FrameRecorderStats> stats = recorder->Finish();
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(stats->frames_captured, kFrameCount);
+  EXPECT_EQ(stats->frames_written + stats->frames_dropped, kFrameCount);
+  EXPECT_GT(stats->frames_written, 0);
+  EXPECT_EQ(stats->bytes_written, stats->frames_written * 640 * 480 * 4);
+
+  Expected<RecordingIndex> index = ReadRecordingIndex(file_);
+  ASSERT_TRUE(index.has_value());
+  EXPECT_EQ(index->width, 640);
+  EXPECT_EQ(index->height, 480);
+  EXPECT_EQ(index->channels, 4);
+  EXPECT_TRUE(index->bottom_up);
+  ASSERT_EQ(index->frames.size(), stats->frames_written);
+
+  std::ifstream stream(file_, std::ios::binary);
+  for (size_t i = 0; i < index->frames.size(); ++i) {
+    if (i > 0) {
+      EXPECT_GT(index->frames[i].frame_number,
+                index->frames[i - 1].frame_number);
+      EXPECT_GE(index->frames[i].timestamp_ns,
+                index->frames[i - 1].timestamp_ns);
+    }
+
+    array<unsigned char, 4> pixel{};
+    stream.seekg(static_cast<std::streamoff>(index->frames[i].offset));
+    stream.read(reinterpret_cast<char*>(pixel.data()), pixel.size());
+    ASSERT_TRUE(stream);
+    const float green = GreenForFrame(index->frames[i].frame_number);
+    EXPECT_NEAR(pixel[1], static_cast<int>(green * 255.0F + 0.5F), 1);
+  }
+}
+
+TEST_F(FrameRecorderTestFixture, CaptureAfterFinishFails) {
+  Expected<IFrameRecorderPtr> create_result = CreateIFrameRecorder(file_);
+  ASSERT_TRUE(create_result.has_value());
+  IFrameRecorderPtr recorder = std::move(*create_result);
+
+  ASSERT_TRUE(recorder->Finish().has_value());
+  EXPECT_FALSE(recorder->CaptureFrame().has_value());
+  EXPECT_FALSE(recorder->Finish().has_value());
+
+  Expected<RecordingIndex> index = ReadRecordingIndex(file_);
+  ASSERT_TRUE(index.has_value());
+  EXPECT_TRUE(index->frames.empty());
+}
+
+TEST_F(FrameRecorderTestFixture, ReadRecordingIndexRejectsPartialEntries) {
+  Expected<IFrameRecorderPtr> create_result = CreateIFrameRecorder(file_);
+  ASSERT_TRUE(create_result.has_value());
+  ASSERT_TRUE((*create_result)->Finish().has_value());
+
+  // Grow the index by a byte without changing the footer, so the space it
+  // describes no longer holds a whole number of entries.
+  std::string contents;
+  {
+    std::ifstream stream(file_, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(stream), {});
+  }
+  constexpr size_t kFooterSize = 24;
+  ASSERT_GT(contents.size(), kFooterSize);
+  contents.insert(contents.size() - kFooterSize, 1, '\0');
+  {
+    std::ofstream stream(file_, std::ios::binary | std::ios::trunc);
+    stream << contents;
+  }
+  EXPECT_FALSE(ReadRecordingIndex(file_).has_value());
+}
+
+TEST_F(FrameRecorderTestFixture, ReadRecordingIndexRejectsOtherFiles) {
+  {
+    std::ofstream stream(file_, std::ios::binary);
+    stream << "not a recording, but long enough to have a footer";
+  }
+  EXPECT_FALSE(ReadRecordingIndex(file_).has_value());
+}
+
+}  // namespace graphics_engine_tests::frame_recorder_tests
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/gl-wrappers.h>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLErrorPolicy;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::gl_types::GLErrorPolicy;
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::CheckDeferredErrors;
+using graphics_engine::gl_wrappers::GetErrorPolicy;
+using graphics_engine::gl_wrappers::GetStateCacheStats;
+using graphics_engine::gl_wrappers::InvalidateStateCache;
+using graphics_engine::gl_wrappers::ResetStateCacheStats;
+using graphics_engine::gl_wrappers::SetErrorPolicy;
+using graphics_engine::gl_wrappers::StateCacheStats;
+using graphics_engine::gl_wrappers::UseProgram;
+using graphics_engine::types::Expected;
+
+using testing::Test;
+
+namespace graphics_engine_tests::gl_wrappers_tests {
+
+namespace {
+
+// Never returned by glGenVertexArrays in these tests, so binding it raises
+// GL_INVALID_OPERATION.
+constexpr unsigned int kBogusVertexArray = 0xBAD;
+
+}  // namespace
+
+struct GLWrappersTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  void SetUp() override { original_policy_ = GetErrorPolicy(); }
+
+  void TearDown() override {
+    // Drain anything a test left behind before restoring the policy.
+    SetErrorPolicy(kCheckDeferred);
+    (void)CheckDeferredErrors("TearDown");
+    SetErrorPolicy(original_policy_);
+  }
+
+ private:
+  GLErrorPolicy original_policy_{kCheckEveryCall};
+};
+
+TEST_F(GLWrappersTestFixture, CheckEveryCallReportsErrorImmediately) {
+  SetErrorPolicy(kCheckEveryCall);
+  ASSERT_EQ(GetErrorPolicy(), kCheckEveryCall);
+
+  Expected<void> result = BindVertexArray(kBogusVertexArray);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().message(), "OpenGL Error: Invalid Operation.");
+
+  // The error was consumed by the call, so there is nothing left to collect.
+  ASSERT_TRUE(CheckDeferredErrors("test").has_value());
+}
+
+TEST_F(GLWrappersTestFixture, CheckDeferredReportsErrorAtCheckpoint) {
+  SetErrorPolicy(kCheckDeferred);
+  ASSERT_EQ(GetErrorPolicy(), kCheckDeferred);
+
+  ASSERT_TRUE(BindVertexArray(kBogusVertexArray).has_value());
+
+  Expected<void> result = CheckDeferredErrors("test");
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().message(), "OpenGL Error: Invalid Operation.");
+
+  // The checkpoint drained the error.
+  ASSERT_TRUE(CheckDeferredErrors("test").has_value());
+}
+
+TEST_F(GLWrappersTestFixture, CheckNoneNeverReportsErrors) {
+  SetErrorPolicy(kCheckNone);
+  ASSERT_EQ(GetErrorPolicy(), kCheckNone);
+
+  ASSERT_TRUE(BindVertexArray(kBogusVertexArray).has_value());
+  ASSERT_TRUE(CheckDeferredErrors("test").has_value());
+}
+
+TEST_F(GLWrappersTestFixture, StateCacheSkipsRedundantCalls) {
+  SetErrorPolicy(kCheckEveryCall);
+  InvalidateStateCache();
+  ResetStateCacheStats();
+
+  ASSERT_TRUE(BindVertexArray(0).has_value());
+  ASSERT_TRUE(BindVertexArray(0).has_value());
+  ASSERT_TRUE(UseProgram(0).has_value());
+  ASSERT_TRUE(UseProgram(0).has_value());
+
+  StateCacheStats stats = GetStateCacheStats();
+  ASSERT_EQ(stats.issued, 2U);
+  ASSERT_EQ(stats.skipped, 2U);
+
+  // After invalidation the same values have to reach GL again.
+  InvalidateStateCache();
+  ASSERT_TRUE(BindVertexArray(0).has_value());
+  ASSERT_TRUE(UseProgram(0).has_value());
+
+  stats = GetStateCacheStats();
+  ASSERT_EQ(stats.issued, 4U);
+  ASSERT_EQ(stats.skipped, 2U);
+
+  ResetStateCacheStats();
+  stats = GetStateCacheStats();
+  ASSERT_EQ(stats.issued, 0U);
+  ASSERT_EQ(stats.skipped, 0U);
+}
+
+TEST_F(GLWrappersTestFixture, StateCacheDoesNotRememberFailedCalls) {
+  SetErrorPolicy(kCheckEveryCall);
+  InvalidateStateCache();
+  ResetStateCacheStats();
+
+  ASSERT_FALSE(BindVertexArray(kBogusVertexArray).has_value());
+  ASSERT_FALSE(BindVertexArray(kBogusVertexArray).has_value());
+
+  const StateCacheStats stats = GetStateCacheStats();
+  ASSERT_EQ(stats.issued, 2U);
+  ASSERT_EQ(stats.skipped, 0U);
+}
+
+}  // namespace graphics_engine_tests::gl_wrappers_tests
@@ -0,0 +1,266 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/golden-runner.h>
+#include <graphics-engine/i-fingerprint-index.h>
+#include <graphics-engine/image-fingerprint.h>
+#include <graphics-engine/scene.h>
+
+#include <filesystem>
+#include <fstream>
+#include <glm/vec4.hpp>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::engine::SetBackgroundColor;
+using graphics_engine::golden_runner::GoldenCase;
+using graphics_engine::golden_runner::GoldenReport;
+using graphics_engine::golden_runner::ParseGoldenManifest;
+using graphics_engine::golden_runner::RunGoldenSuite;
+using graphics_engine::golden_runner::SceneRegistry;
+using graphics_engine::golden_runner::WriteJsonReport;
+using graphics_engine::golden_runner::WriteJUnitReport;
+using graphics_engine::image_fingerprint::ComputeFingerprint;
+using graphics_engine::image_fingerprint::CreateIFingerprintIndex;
+using graphics_engine::image_fingerprint::IFingerprintIndexPtr;
+using graphics_engine::scene::Scene;
+using graphics_engine::scene::ScenePtr;
+using graphics_engine::types::Expected;
+
+using glm::vec4;
+
+using std::ifstream;
+using std::ofstream;
+using std::string;
+using std::vector;
+using std::filesystem::current_path;
+using std::filesystem::exists;
+using std::filesystem::path;
+using std::filesystem::remove_all;
+using std::filesystem::temp_directory_path;
+
+using testing::Test;
+
+namespace graphics_engine_tests::golden_runner_tests {
+
+namespace {
+
+auto ReadFile(const path& file) -> string {
+  ifstream stream{file};
+  return {std::istreambuf_iterator<char>{stream}, {}};
+}
+
+// Clears the frame to the color hello-window.png was captured with.
+class BackgroundScene : public Scene {
+ public:
+  [[nodiscard]] auto Render() const -> Expected<void> override {
+    SetBackgroundColor(vec4{0.2F, 0.3F, 0.3F, 1.0F});
+    return graphics_engine::engine::Render();
+  }
+};
+
+auto MakeScenes() -> SceneRegistry {
+  return {{"background", []() -> Expected<ScenePtr> {
+             return std::make_unique<BackgroundScene>();
+           }}};
+}
+
+}  // namespace
+
+struct GoldenManifestTestFixture : public Test {
+  void SetUp() override {
+    std::error_code error;
+    remove_all(directory_, error);
+    std::filesystem::create_directories(directory_);
+  }
+
+  void TearDown() override {
+    std::error_code error;
+    remove_all(directory_, error);
+  }
+
+  auto WriteManifest(const string& contents) const -> path {
+    const path manifest = directory_ / "golden.txt";
+    ofstream{manifest} << contents;
+    return manifest;
+  }
+
+  const path directory_{temp_directory_path() / "golden-manifest-test"};
+};
+
+TEST_F(GoldenManifestTestFixture, ParsesCasesAndSkipsComments) {
+  const path manifest = WriteManifest(
+      "# scene reference [size] [tolerance=N] [name=NAME]\n"
+      "\n"
+      "triangle images/triangle.png\n"
+      "  background bg.png 800x600 tolerance=3 name=clear\n");
+
+  auto cases = ParseGoldenManifest(manifest);
+  ASSERT_TRUE(cases.has_value());
+  ASSERT_EQ(cases->size(), 2);
+
+  const GoldenCase& triangle = (*cases)[0];
+  EXPECT_EQ(triangle.name, "triangle");
+  EXPECT_EQ(triangle.scene, "triangle");
+  EXPECT_EQ(triangle.reference, directory_ / "images/triangle.png");
+  EXPECT_EQ(triangle.width, 640);
+  EXPECT_EQ(triangle.height, 480);
+  EXPECT_EQ(triangle.tolerance, 0);
+
+  const GoldenCase& background = (*cases)[1];
+  EXPECT_EQ(background.name, "clear");
+  EXPECT_EQ(background.scene, "background");
+  EXPECT_EQ(background.reference, directory_ / "bg.png");
+  EXPECT_EQ(background.width, 800);
+  EXPECT_EQ(background.height, 600);
+  EXPECT_EQ(background.tolerance, 3);
+}
+
+TEST_F(GoldenManifestTestFixture, RejectsMalformedLines) {
+  for (const char* line : {"triangle\n", "triangle a.png 640\n",
+                           "triangle a.png 0x480\n",
+                           "triangle a.png tolerance=256\n",
+                           "triangle a.png fast\n"}) {
+    auto cases = ParseGoldenManifest(WriteManifest(line));
+    EXPECT_FALSE(cases.has_value()) << line;
+  }
+}
+
+TEST_F(GoldenManifestTestFixture, RejectsDuplicateNames) {
+  auto cases = ParseGoldenManifest(
+      WriteManifest("triangle a/triangle.png\n"
+                    "background b/triangle.png\n"));
+  EXPECT_FALSE(cases.has_value());
+
+  cases = ParseGoldenManifest(
+      WriteManifest("triangle a/triangle.png name=a\n"
+                    "background b/triangle.png name=b\n"));
+  EXPECT_TRUE(cases.has_value());
+}
+
+TEST_F(GoldenManifestTestFixture, RejectsMissingManifest) {
+  auto cases = ParseGoldenManifest(directory_ / "missing.txt");
+  EXPECT_FALSE(cases.has_value());
+}
+
+struct GoldenRunnerTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  void TearDown() override {
+    std::error_code error;
+    remove_all(output_dir_, error);
+  }
+
+  const path output_dir_{temp_directory_path() / "golden-runner-test"};
+};
+
+TEST_F(GoldenRunnerTestFixture, ReportsPassesFailuresAndUnknownScenes) {
+  const SceneRegistry scenes = MakeScenes();
+  const path screenshots = current_path() / "screenshots";
+  const vector<GoldenCase> cases{
+      {.name = "pass",
+       .scene = "background",
+       .reference = screenshots / "hello-window.png"},
+      {.name = "fail",
+       .scene = "background",
+       .reference = screenshots / "hello-window-modified.png"},
+      {.name = "resized",
+       .scene = "background",
+       .reference = screenshots / "hello-window.png",
+       .width = 320,
+       .height = 240},
+      {.name = "unknown",
+       .scene = "missing",
+       .reference = screenshots / "hello-window.png"}};
+
+  auto report = RunGoldenSuite(
+      cases, scenes, {.worker_count = 2, .output_dir = output_dir_});
+  ASSERT_TRUE(report.has_value());
+  ASSERT_EQ(report->results.size(), cases.size());
+  EXPECT_EQ(report->GetFailureCount(), 3);
+
+  EXPECT_TRUE(report->results[0].passed);
+  EXPECT_TRUE(report->results[0].failure.empty());
+
+  EXPECT_FALSE(report->results[1].passed);
+  EXPECT_GT(report->results[1].mismatch_count, 0);
+  ASSERT_TRUE(report->results[1].diff.has_value());
+  EXPECT_TRUE(exists(*report->results[1].diff));
+  ASSERT_TRUE(report->results[1].actual.has_value());
+  EXPECT_TRUE(exists(*report->results[1].actual));
+
+  EXPECT_FALSE(report->results[2].passed);
+  EXPECT_FALSE(report->results[2].diff.has_value());
+
+  EXPECT_FALSE(report->results[3].passed);
+  EXPECT_NE(report->results[3].failure.find("missing"), string::npos);
+
+  const path junit = output_dir_ / "golden.xml";
+  ASSERT_TRUE(WriteJUnitReport(*report, junit).has_value());
+  const string xml = ReadFile(junit);
+  EXPECT_NE(xml.find("tests=\"4\" failures=\"3\""), string::npos);
+  EXPECT_NE(xml.find("<testcase classname=\"golden\" name=\"pass\""),
+            string::npos);
+
+  const path json_file = output_dir_ / "golden.json";
+  ASSERT_TRUE(WriteJsonReport(*report, json_file).has_value());
+  const string json = ReadFile(json_file);
+  EXPECT_NE(json.find("\"failures\": 3"), string::npos);
+  EXPECT_NE(json.find("\"name\": \"unknown\""), string::npos);
+}
+
+TEST_F(GoldenRunnerTestFixture, PassesOnFingerprintMatch) {
+  const path screenshots = current_path() / "screenshots";
+  auto fingerprint = ComputeFingerprint(screenshots / "hello-window.png");
+  ASSERT_TRUE(fingerprint.has_value());
+
+  // Index the rendered image's fingerprint under a reference that differs,
+  // so only the index lookup can make the case pass.
+  const path reference = screenshots / "hello-window-modified.png";
+  IFingerprintIndexPtr index = CreateIFingerprintIndex();
+  index->Insert(reference.generic_string(), *fingerprint);
+
+  const vector<GoldenCase> cases{
+      {.name = "indexed", .scene = "background", .reference = reference}};
+  auto report = RunGoldenSuite(cases, MakeScenes(),
+                               {.worker_count = 1,
+                                .output_dir = output_dir_,
+                                .fingerprints = index.get()});
+  ASSERT_TRUE(report.has_value());
+  ASSERT_EQ(report->results.size(), 1);
+  EXPECT_TRUE(report->results[0].passed);
+  EXPECT_FALSE(report->results[0].diff.has_value());
+}
+
+}  // namespace graphics_engine_tests::golden_runner_tests
@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <graphics-engine/i-fingerprint-index.h>
+#include <graphics-engine/image-fingerprint.h>
+#include <graphics-engine/image.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::image::ImageView;
+using graphics_engine::image_fingerprint::ComputeFingerprint;
+using graphics_engine::image_fingerprint::CreateIFingerprintIndex;
+using graphics_engine::image_fingerprint::FingerprintMatch;
+using graphics_engine::image_fingerprint::HammingDistance;
+using graphics_engine::image_fingerprint::IFingerprintIndexPtr;
+using graphics_engine::image_fingerprint::ImageFingerprint;
+using graphics_engine::image_fingerprint::LoadIFingerprintIndex;
+
+using std::byte;
+using std::size_t;
+using std::string;
+using std::uint8_t;
+using std::vector;
+using std::filesystem::path;
+using std::filesystem::remove;
+using std::filesystem::temp_directory_path;
+
+namespace graphics_engine_tests::image_fingerprint_tests {
+
+namespace {
+
+constexpr int kWidth = 32;
+constexpr int kHeight = 24;
+
+// A horizontal gradient in RGBA, top-down.
+auto MakeGradient() -> vector<uint8_t> {
+  vector<uint8_t> pixels;
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      const auto value = static_cast<uint8_t>(x * 8);
+      pixels.insert(pixels.end(), {value, value, static_cast<uint8_t>(y), 255});
+    }
+  }
+  return pixels;
+}
+
+auto MakeView(const vector<uint8_t>& pixels, int channels,
+              bool bottom_up = false) -> ImageView {
+  return {.width = kWidth,
+          .height = kHeight,
+          .channels = channels,
+          .pixels = std::as_bytes(std::span(pixels)),
+          .bottom_up = bottom_up};
+}
+
+}  // namespace
+
+TEST(ImageFingerprintTest, ContentHashIgnoresLayout) {
+  const vector<uint8_t> rgba = MakeGradient();
+  vector<uint8_t> rgb;
+  for (size_t i = 0; i < rgba.size(); i += 4) {
+    rgb.insert(rgb.end(), {rgba[i], rgba[i + 1], rgba[i + 2]});
+  }
+  const size_t row_size = static_cast<size_t>(kWidth) * 4;
+  vector<uint8_t> flipped;
+  for (int y = kHeight - 1; y >= 0; --y) {
+    const auto row = rgba.begin() + static_cast<std::ptrdiff_t>(y * row_size);
+    flipped.insert(flipped.end(), row,
+                   row + static_cast<std::ptrdiff_t>(row_size));
+  }
+
+  auto from_rgba = ComputeFingerprint(MakeView(rgba, 4));
+  auto from_rgb = ComputeFingerprint(MakeView(rgb, 3));
+  auto from_flipped = ComputeFingerprint(MakeView(flipped, 4, true));
+  ASSERT_TRUE(from_rgba.has_value());
+  ASSERT_TRUE(from_rgb.has_value());
+  ASSERT_TRUE(from_flipped.has_value());
+  EXPECT_EQ(*from_rgba, *from_rgb);
+  EXPECT_EQ(*from_rgba, *from_flipped);
+  EXPECT_EQ(from_rgba->width, kWidth);
+  EXPECT_EQ(from_rgba->height, kHeight);
+}
+
+TEST(ImageFingerprintTest, SmallEditsKeepPerceptualHashClose) {
+  vector<uint8_t> pixels = MakeGradient();
+  auto original = ComputeFingerprint(MakeView(pixels, 4));
+  ASSERT_TRUE(original.has_value());
+
+  pixels[(5 * kWidth + 7) * 4] ^= 0x10U;
+  auto edited = ComputeFingerprint(MakeView(pixels, 4));
+  ASSERT_TRUE(edited.has_value());
+  EXPECT_NE(edited->content_hash, original->content_hash);
+  EXPECT_LE(HammingDistance(edited->perceptual_hash,
+                            original->perceptual_hash),
+            4);
+
+  // A mirrored gradient should look nothing alike.
+  for (size_t i = 0; i < pixels.size(); i += 4) {
+    pixels[i] = pixels[i + 1] = static_cast<uint8_t>(255 - pixels[i + 1]);
+  }
+  auto mirrored = ComputeFingerprint(MakeView(pixels, 4));
+  ASSERT_TRUE(mirrored.has_value());
+  EXPECT_GT(HammingDistance(mirrored->perceptual_hash,
+                            original->perceptual_hash),
+            32);
+}
+
+TEST(ImageFingerprintTest, RejectsMalformedViews) {
+  const vector<uint8_t> pixels = MakeGradient();
+  ImageView view = MakeView(pixels, 4);
+  view.width += 1;
+  EXPECT_FALSE(ComputeFingerprint(view).has_value());
+  EXPECT_FALSE(ComputeFingerprint(MakeView(pixels, 5)).has_value());
+}
+
+TEST(ImageFingerprintTest, FingerprintsFiles) {
+  auto original = ComputeFingerprint(path("screenshots/hello-window.png"));
+  auto copy = ComputeFingerprint(path("screenshots/hello-window-copy.png"));
+  auto modified =
+      ComputeFingerprint(path("screenshots/hello-window-modified.png"));
+  ASSERT_TRUE(original.has_value());
+  ASSERT_TRUE(copy.has_value());
+  ASSERT_TRUE(modified.has_value());
+  EXPECT_EQ(*original, *copy);
+  EXPECT_NE(original->content_hash, modified->content_hash);
+
+  EXPECT_FALSE(ComputeFingerprint(path("screenshots/missing.png")));
+}
+
+TEST(FingerprintIndexTest, FindsExactAndSimilarEntries) {
+  IFingerprintIndexPtr index = CreateIFingerprintIndex();
+  const ImageFingerprint a{.content_hash = 1, .perceptual_hash = 0b0000,
+                           .width = 4, .height = 4};
+  const ImageFingerprint b{.content_hash = 2, .perceptual_hash = 0b0111,
+                           .width = 4, .height = 4};
+  const ImageFingerprint c{.content_hash = 1, .perceptual_hash = 0b0001,
+                           .width = 4, .height = 4};
+  index->Insert("a.png", a);
+  index->Insert("b.png", b);
+  index->Insert("c.png", c);
+  EXPECT_EQ(index->GetSize(), 3);
+
+  EXPECT_TRUE(index->MatchesExactly("a.png", a));
+  EXPECT_FALSE(index->MatchesExactly("a.png", b));
+  EXPECT_FALSE(index->MatchesExactly("missing.png", a));
+  EXPECT_EQ(index->FindByContent(1), (vector<string>{"a.png", "c.png"}));
+
+  const vector<FingerprintMatch> similar = index->FindSimilar(0b0000, 1);
+  ASSERT_EQ(similar.size(), 2);
+  EXPECT_EQ(similar[0].key, "a.png");
+  EXPECT_EQ(similar[0].distance, 0);
+  EXPECT_EQ(similar[1].key, "c.png");
+  EXPECT_EQ(similar[1].distance, 1);
+
+  // Replacing an entry drops its old content hash.
+  index->Insert("c.png", b);
+  EXPECT_EQ(index->FindByContent(1), (vector<string>{"a.png"}));
+  EXPECT_EQ(index->Find("c.png"), b);
+
+  EXPECT_TRUE(index->Erase("a.png"));
+  EXPECT_FALSE(index->Erase("a.png"));
+  EXPECT_FALSE(index->Find("a.png").has_value());
+  EXPECT_TRUE(index->FindByContent(1).empty());
+}
+
+TEST(FingerprintIndexTest, SavesAndLoads) {
+  const path file = temp_directory_path() / "fingerprint-index-test.txt";
+  IFingerprintIndexPtr index = CreateIFingerprintIndex();
+  const ImageFingerprint fingerprint{.content_hash = 0x0123456789ABCDEFULL,
+                                     .perceptual_hash = 0xFEDCBA9876543210ULL,
+                                     .width = 640,
+                                     .height = 480};
+  index->Insert("screenshots/hello window.png", fingerprint);
+  ASSERT_TRUE(index->Save(file).has_value());
+
+  auto loaded = LoadIFingerprintIndex(file);
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ((*loaded)->GetSize(), 1);
+  EXPECT_EQ((*loaded)->Find("screenshots/hello window.png"), fingerprint);
+
+  std::ofstream{file} << "# graphics-engine fingerprint index 1\n"
+                      << "0123 fedc 640 480 truncated.png\n";
+  EXPECT_FALSE(LoadIFingerprintIndex(file).has_value());
+  remove(file);
+  EXPECT_FALSE(LoadIFingerprintIndex(file).has_value());
+}
+
+}  // namespace graphics_engine_tests::image_fingerprint_tests
@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/gl-wrappers.h>
+#include <graphics-engine/i-indirect-command-builder.h>
+
+#include <array>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::gl_types::GLDrawMode;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::gl_wrappers::GenVertexArrays;
+using graphics_engine::indirect_command_builder::CreateIIndirectCommandBuilder;
+using graphics_engine::indirect_command_builder::DrawArraysIndirectCommand;
+using graphics_engine::indirect_command_builder::DrawElementsIndirectCommand;
+using graphics_engine::indirect_command_builder::IIndirectCommandBuilderPtr;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::to_underlying;
+
+using testing::Test;
+
+namespace graphics_engine_tests::indirect_command_builder_tests {
+
+struct IndirectCommandBuilderTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+};
+
+TEST(IndirectCommandBuilderTests, CollectsCommandsUntilCleared) {
+  IIndirectCommandBuilderPtr builder = CreateIIndirectCommandBuilder();
+  builder->AddDrawArrays({.count = 3, .first = 0});
+  builder->AddDrawArrays({.count = 6, .first = 3});
+  builder->AddDrawElements({.count = 36, .first_index = 12, .base_vertex = 8});
+
+  ASSERT_EQ(builder->GetDrawArraysCommands().size(), 2U);
+  ASSERT_EQ(builder->GetDrawArraysCommands()[1].first, 3U);
+  ASSERT_EQ(builder->GetDrawArraysCommands()[1].instance_count, 1U);
+  ASSERT_EQ(builder->GetDrawElementsCommands().size(), 1U);
+  ASSERT_EQ(builder->GetDrawElementsCommands()[0].base_vertex, 8);
+
+  builder->Clear();
+  ASSERT_TRUE(builder->GetDrawArraysCommands().empty());
+  ASSERT_TRUE(builder->GetDrawElementsCommands().empty());
+}
+
+TEST_F(IndirectCommandBuilderTestFixture, DrawIssuesPackedCommands) {
+  const array<float, 18> vertices{};
+
+  unsigned int vao{};
+  unsigned int vbo{};
+  ASSERT_TRUE(GenVertexArrays(1, &vao).has_value());
+  ASSERT_TRUE(BindVertexArray(vao).has_value());
+  ASSERT_TRUE(GenBuffers(1, &vbo).has_value());
+  ASSERT_TRUE(BindBuffer(kArray, vbo).has_value());
+  ASSERT_TRUE(
+      BufferData(kArray, sizeof(vertices), vertices.data(), kStaticDraw)
+          .has_value());
+
+  IIndirectCommandBuilderPtr builder = CreateIIndirectCommandBuilder();
+  builder->AddDrawArrays({.count = 3, .first = 0});
+  builder->AddDrawArrays({.count = 3, .first = 3});
+
+  Expected<void> result = builder->Draw(kTriangles, kUnsignedInt);
+  if (!result.has_value() &&
+      result.error().value() == to_underlying(kGLExtensionUnavailable)) {
+    GTEST_SKIP() << "GL_ARB_multi_draw_indirect is not available.";
+  }
+  ASSERT_TRUE(result.has_value());
+
+  // Drawing again reuses the indirect buffer.
+  builder->Clear();
+  builder->AddDrawArrays({.count = 6, .first = 0});
+  ASSERT_TRUE(builder->Draw(kTriangles, kUnsignedInt).has_value());
+}
+
+}  // namespace graphics_engine_tests::indirect_command_builder_tests
@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/gl-wrappers.h>
+#include <graphics-engine/i-instance-buffer.h>
+
+#include <array>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::gl_types::GLDrawMode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::DrawArraysInstanced;
+using graphics_engine::gl_wrappers::EnableVertexAttribArray;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::gl_wrappers::GenVertexArrays;
+using graphics_engine::gl_wrappers::VertexAttribDivisor;
+using graphics_engine::gl_wrappers::VertexAttribPointer;
+using graphics_engine::instance_buffer::CreateIInstanceBuffer;
+using graphics_engine::instance_buffer::IInstanceBufferPtr;
+using graphics_engine::instance_buffer::InstanceData;
+
+using std::array;
+
+using testing::Test;
+
+namespace graphics_engine_tests::instance_buffer_tests {
+
+struct InstanceBufferTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  void SetUp() override {
+    const array<float, 9> vertices{};
+
+    unsigned int vao{};
+    unsigned int vbo{};
+    ASSERT_TRUE(GenVertexArrays(1, &vao).has_value());
+    ASSERT_TRUE(BindVertexArray(vao).has_value());
+    ASSERT_TRUE(GenBuffers(1, &vbo).has_value());
+    ASSERT_TRUE(BindBuffer(kArray, vbo).has_value());
+    ASSERT_TRUE(
+        BufferData(kArray, sizeof(vertices), vertices.data(), kStaticDraw)
+            .has_value());
+    ASSERT_TRUE(VertexAttribPointer(0, 3, kFloat, 0, 3 * sizeof(float), nullptr)
+                    .has_value());
+    ASSERT_TRUE(EnableVertexAttribArray(0).has_value());
+  }
+};
+
+TEST(InstanceBufferTests, DefaultInstanceIsIdentityAndWhite) {
+  const InstanceData instance{};
+  ASSERT_EQ(instance.transform[0], 1.F);
+  ASSERT_EQ(instance.transform[1], 0.F);
+  ASSERT_EQ(instance.transform[15], 1.F);
+  ASSERT_EQ(instance.color[3], 1.F);
+}
+
+TEST(InstanceBufferTests, CollectsInstancesUntilCleared) {
+  IInstanceBufferPtr instances = CreateIInstanceBuffer();
+  instances->Add({});
+  instances->Add({.color = {1.F, 0.F, 0.F, 1.F}});
+
+  ASSERT_EQ(instances->GetInstances().size(), 2U);
+  ASSERT_EQ(instances->GetInstances()[1].color[1], 0.F);
+
+  instances->Clear();
+  ASSERT_TRUE(instances->GetInstances().empty());
+}
+
+TEST_F(InstanceBufferTestFixture, DrawArraysInstancedWithDivisor) {
+  ASSERT_TRUE(VertexAttribDivisor(0, 0).has_value());
+  ASSERT_TRUE(DrawArraysInstanced(kTriangles, 0, 3, 4).has_value());
+}
+
+TEST_F(InstanceBufferTestFixture, DrawsEveryInstanceInOneCall) {
+  IInstanceBufferPtr instances = CreateIInstanceBuffer();
+  ASSERT_TRUE(instances->BindAttributes(1).has_value());
+
+  for (int i = 0; i < 100; ++i) {
+    InstanceData instance{};
+    instance.transform[12] = static_cast<float>(i);
+    instances->Add(instance);
+  }
+  ASSERT_TRUE(instances->DrawArrays(kTriangles, 0, 3).has_value());
+
+  // Drawing again reuses the instance buffer.
+  instances->Clear();
+  instances->Add({});
+  ASSERT_TRUE(instances->DrawArrays(kTriangles, 0, 3).has_value());
+}
+
+}  // namespace graphics_engine_tests::instance_buffer_tests
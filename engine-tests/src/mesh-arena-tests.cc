@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/gl-wrappers.h>
+#include <graphics-engine/i-mesh-arena.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::gl_types::GLDrawMode;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::gl_wrappers::EnableVertexAttribArray;
+using graphics_engine::gl_wrappers::VertexAttribPointer;
+using graphics_engine::mesh_arena::CreateIMeshArena;
+using graphics_engine::mesh_arena::IMeshArenaPtr;
+using graphics_engine::mesh_arena::MeshHandle;
+using graphics_engine::mesh_arena::MeshRange;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::as_bytes;
+using std::span;
+using std::to_underlying;
+using std::uint32_t;
+
+using testing::Test;
+
+namespace graphics_engine_tests::mesh_arena_tests {
+
+constexpr int kStride = 3 * sizeof(float);
+constexpr array<float, 9> kTriangle{};
+constexpr array<uint32_t, 3> kTriangleIndices{0, 1, 2};
+
+struct MeshArenaTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  void SetUp() override {
+    Expected<IMeshArenaPtr> result = CreateIMeshArena(kStride, 12, 12);
+    ASSERT_TRUE(result.has_value());
+    arena = std::move(*result);
+
+    ASSERT_TRUE(arena->Bind().has_value());
+    ASSERT_TRUE(
+        VertexAttribPointer(0, 3, kFloat, 0, kStride, nullptr).has_value());
+    ASSERT_TRUE(EnableVertexAttribArray(0).has_value());
+  }
+
+  auto AddTriangle() -> Expected<MeshHandle> {
+    return arena->Add(as_bytes(span(kTriangle)), kTriangleIndices);
+  }
+
+  IMeshArenaPtr arena;
+};
+
+TEST_F(MeshArenaTestFixture, MeshesShareBuffersAtDistinctRanges) {
+  Expected<MeshHandle> first = AddTriangle();
+  Expected<MeshHandle> second = AddTriangle();
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+
+  Expected<MeshRange> range = arena->GetRange(*second);
+  ASSERT_TRUE(range.has_value());
+  ASSERT_EQ(range->base_vertex, 3);
+  ASSERT_EQ(range->first_index, 3U);
+  ASSERT_EQ(range->index_count, 3);
+
+  ASSERT_TRUE(arena->Draw(*first, kTriangles).has_value());
+  ASSERT_TRUE(arena->Draw(*second, kTriangles).has_value());
+  ASSERT_EQ(arena->GetStats().mesh_count, 2U);
+}
+
+TEST_F(MeshArenaTestFixture, RemovedRangesAreReused) {
+  Expected<MeshHandle> first = AddTriangle();
+  ASSERT_TRUE(AddTriangle().has_value());
+  ASSERT_TRUE(arena->Remove(*first).has_value());
+  ASSERT_FALSE(arena->Remove(*first).has_value());
+
+  Expected<MeshHandle> third = AddTriangle();
+  ASSERT_TRUE(third.has_value());
+  ASSERT_EQ(arena->GetRange(*third)->base_vertex, 0);
+}
+
+TEST_F(MeshArenaTestFixture, CompactMergesFreeSpace) {
+  array<MeshHandle, 4> meshes{};
+  for (MeshHandle& mesh : meshes) {
+    Expected<MeshHandle> result = AddTriangle();
+    ASSERT_TRUE(result.has_value());
+    mesh = *result;
+  }
+
+  Expected<MeshHandle> full = AddTriangle();
+  ASSERT_FALSE(full.has_value());
+  ASSERT_EQ(full.error().value(), to_underlying(kMeshArenaFull));
+
+  ASSERT_TRUE(arena->Remove(meshes[0]).has_value());
+  ASSERT_TRUE(arena->Remove(meshes[2]).has_value());
+  ASSERT_EQ(arena->GetStats().free_vertex_blocks, 2U);
+
+  ASSERT_TRUE(arena->Compact().has_value());
+  ASSERT_EQ(arena->GetStats().free_vertex_blocks, 1U);
+  ASSERT_EQ(arena->GetRange(meshes[1])->base_vertex, 0);
+  ASSERT_EQ(arena->GetRange(meshes[3])->base_vertex, 3);
+  ASSERT_EQ(arena->GetRange(meshes[3])->first_index, 3U);
+  ASSERT_TRUE(arena->Draw(meshes[3], kTriangles).has_value());
+}
+
+TEST_F(MeshArenaTestFixture, RejectsMalformedMeshes) {
+  const array<uint32_t, 3> out_of_range{0, 1, 3};
+  ASSERT_FALSE(
+      arena->Add(as_bytes(span(kTriangle)), out_of_range).has_value());
+  ASSERT_FALSE(arena->Add(as_bytes(span(kTriangle)).first(kStride + 1),
+                          kTriangleIndices)
+                   .has_value());
+}
+
+}  // namespace graphics_engine_tests::mesh_arena_tests
@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/gl-wrappers.h>
+#include <graphics-engine/mesh.h>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLBufferTarget;
+using enum graphics_engine::gl_types::GLDataType;
+using enum graphics_engine::gl_types::GLDataUsagePattern;
+using enum graphics_engine::gl_types::GLDrawMode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::gl_wrappers::BindBuffer;
+using graphics_engine::gl_wrappers::BindVertexArray;
+using graphics_engine::gl_wrappers::BufferData;
+using graphics_engine::gl_wrappers::DeleteBuffers;
+using graphics_engine::gl_wrappers::DrawElements;
+using graphics_engine::gl_wrappers::DrawElementsBaseVertex;
+using graphics_engine::gl_wrappers::GenBuffers;
+using graphics_engine::gl_wrappers::GenVertexArrays;
+using graphics_engine::mesh::IndexBuffer;
+using graphics_engine::mesh::SelectIndexType;
+using graphics_engine::mesh::UploadIndices;
+using graphics_engine::types::Expected;
+
+using std::array;
+using std::uint16_t;
+using std::uint32_t;
+using std::vector;
+
+using testing::Test;
+
+namespace graphics_engine_tests::mesh_tests {
+
+struct MeshTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+};
+
+TEST(MeshTests, SelectIndexTypePrefersShortIndices) {
+  ASSERT_EQ(SelectIndexType(0), kUnsignedShort);
+  ASSERT_EQ(SelectIndexType(65535), kUnsignedShort);
+  ASSERT_EQ(SelectIndexType(65536), kUnsignedInt);
+  ASSERT_EQ(SelectIndexType(1'000'000), kUnsignedInt);
+}
+
+TEST_F(MeshTestFixture, UploadIndicesNarrowsSmallMeshes) {
+  unsigned int vao{};
+  unsigned int vbo{};
+  ASSERT_TRUE(GenVertexArrays(1, &vao).has_value());
+  ASSERT_TRUE(BindVertexArray(vao).has_value());
+  ASSERT_TRUE(GenBuffers(1, &vbo).has_value());
+  ASSERT_TRUE(BindBuffer(kArray, vbo).has_value());
+
+  const array<float, 12> vertices{};
+  ASSERT_TRUE(
+      BufferData(kArray, sizeof(vertices), vertices.data(), kStaticDraw)
+          .has_value());
+
+  const array<uint32_t, 6> quad{0, 1, 2, 2, 1, 3};
+  Expected<IndexBuffer> result = UploadIndices(quad, 4, kStaticDraw);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_NE(result->buffer, 0U);
+  ASSERT_EQ(result->type, kUnsignedShort);
+  ASSERT_EQ(result->count, 6);
+
+  ASSERT_TRUE(
+      DrawElements(kTriangles, result->count, result->type, 0).has_value());
+  ASSERT_TRUE(DrawElementsBaseVertex(kTriangles, 3, result->type,
+                                     3 * sizeof(uint16_t), 1)
+                  .has_value());
+  ASSERT_TRUE(DeleteBuffers(1, &result->buffer).has_value());
+  ASSERT_TRUE(DeleteBuffers(1, &vbo).has_value());
+}
+
+TEST_F(MeshTestFixture, UploadIndicesKeepsLargeMeshesAt32Bits) {
+  vector<uint32_t> indices(3);
+  std::iota(indices.begin(), indices.end(), 70'000U);
+
+  Expected<IndexBuffer> result = UploadIndices(indices, 70'003, kStaticDraw);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->type, kUnsignedInt);
+  ASSERT_TRUE(DeleteBuffers(1, &result->buffer).has_value());
+}
+
+TEST_F(MeshTestFixture, UploadIndicesRejectsOutOfRangeIndices) {
+  const array<uint32_t, 3> triangle{0, 1, 3};
+  ASSERT_FALSE(UploadIndices(triangle, 3, kStaticDraw).has_value());
+}
+
+}  // namespace graphics_engine_tests::mesh_tests
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <graphics-engine/quantize.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::quantize::FloatToHalf;
+using graphics_engine::quantize::HalfToFloat;
+using graphics_engine::quantize::kAlphaMaxError;
+using graphics_engine::quantize::kColorMaxError;
+using graphics_engine::quantize::kHalfRelativeError;
+using graphics_engine::quantize::kNormalMaxError;
+using graphics_engine::quantize::PackColors;
+using graphics_engine::quantize::PackHalf;
+using graphics_engine::quantize::PackNormals;
+using graphics_engine::quantize::PackPositions;
+using graphics_engine::quantize::PackSnorm2101010;
+using graphics_engine::quantize::PackUnorm2101010;
+
+using std::array;
+using std::uint16_t;
+using std::uint32_t;
+
+namespace graphics_engine_tests::quantize_tests {
+
+namespace {
+
+// Decode one component the way OpenGL does.
+auto DecodeSnorm(uint32_t packed, int shift, int bits) -> float {
+  const auto max = static_cast<float>((1 << (bits - 1)) - 1);
+  const int value =
+      static_cast<int>(packed << (32 - shift - bits)) >> (32 - bits);
+  return std::fmax(static_cast<float>(value) / max, -1.F);
+}
+
+auto DecodeUnorm(uint32_t packed, int shift, int bits) -> float {
+  const uint32_t max = (1U << bits) - 1;
+  return static_cast<float>((packed >> shift) & max) / static_cast<float>(max);
+}
+
+}  // namespace
+
+TEST(QuantizeTests, FloatToHalfHandlesSpecialValues) {
+  ASSERT_EQ(FloatToHalf(0.F), 0x0000);
+  ASSERT_EQ(FloatToHalf(-0.F), 0x8000);
+  ASSERT_EQ(FloatToHalf(1.F), 0x3C00);
+  ASSERT_EQ(FloatToHalf(-2.F), 0xC000);
+  ASSERT_EQ(FloatToHalf(65504.F), 0x7BFF);
+  ASSERT_EQ(FloatToHalf(65520.F), 0x7C00);
+  ASSERT_EQ(FloatToHalf(std::numeric_limits<float>::infinity()), 0x7C00);
+  ASSERT_EQ(FloatToHalf(0x1p-24F), 0x0001);
+  ASSERT_EQ(FloatToHalf(0x1p-26F), 0x0000);
+  ASSERT_TRUE(std::isnan(
+      HalfToFloat(FloatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(QuantizeTests, HalfRoundTripStaysWithinBound) {
+  for (float value = -1000.F; value < 1000.F; value += 0.173F) {
+    const float decoded = HalfToFloat(FloatToHalf(value));
+    ASSERT_LE(std::fabs(decoded - value),
+              std::fabs(value) * kHalfRelativeError + 0x1p-25F);
+  }
+}
+
+TEST(QuantizeTests, PackHalfAndPositionsMatchScalarConversion) {
+  array<float, 9> values{};
+  for (int i = 0; i < 9; ++i) {
+    values[i] = static_cast<float>(i) * 0.37F - 1.F;
+  }
+
+  array<uint16_t, 9> halves{};
+  ASSERT_TRUE(PackHalf(values, halves).has_value());
+  for (int i = 0; i < 9; ++i) {
+    ASSERT_EQ(halves[i], FloatToHalf(values[i]));
+  }
+
+  array<uint16_t, 12> positions{};
+  ASSERT_TRUE(PackPositions(values, positions).has_value());
+  for (int vertex = 0; vertex < 3; ++vertex) {
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_EQ(positions[(vertex * 4) + c],
+                FloatToHalf(values[(vertex * 3) + c]));
+    }
+    ASSERT_EQ(positions[(vertex * 4) + 3], FloatToHalf(1.F));
+  }
+
+  array<uint16_t, 8> too_few{};
+  ASSERT_FALSE(PackHalf(values, too_few).has_value());
+  ASSERT_FALSE(PackPositions(values, halves).has_value());
+}
+
+TEST(QuantizeTests, PackedNormalsStayWithinBound) {
+  const array<float, 6> normals{0.F, 0.6F, -0.8F, -1.F, 0.333F, 1.F};
+  array<uint32_t, 2> packed{};
+  ASSERT_TRUE(PackNormals(normals, packed).has_value());
+
+  for (int i = 0; i < 2; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_NEAR(DecodeSnorm(packed[i], c * 10, 10), normals[(i * 3) + c],
+                  kNormalMaxError);
+    }
+    ASSERT_EQ(DecodeSnorm(packed[i], 30, 2), 0.F);
+  }
+
+  ASSERT_EQ(DecodeSnorm(PackSnorm2101010(-2.F, 2.F, 0.F, -1.F), 0, 10), -1.F);
+}
+
+TEST(QuantizeTests, PackedColorsStayWithinBound) {
+  const array<float, 8> colors{1.F, 0.5F, 0.25F, 1.F, 0.F, 0.1F, 0.9F, 0.4F};
+  array<uint32_t, 2> packed{};
+  ASSERT_TRUE(PackColors(colors, packed).has_value());
+
+  for (int i = 0; i < 2; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_NEAR(DecodeUnorm(packed[i], c * 10, 10), colors[(i * 4) + c],
+                  kColorMaxError);
+    }
+    ASSERT_NEAR(DecodeUnorm(packed[i], 30, 2), colors[(i * 4) + 3],
+                kAlphaMaxError);
+  }
+
+  ASSERT_EQ(PackUnorm2101010(2.F, -1.F, 0.F, 0.F), 0x3FFU);
+}
+
+}  // namespace graphics_engine_tests::quantize_tests
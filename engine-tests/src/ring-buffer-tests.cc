@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-ring-buffer.h>
+
+#include <cstddef>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::ring_buffer::CreateIRingBuffer;
+using graphics_engine::ring_buffer::IRingBufferPtr;
+using graphics_engine::ring_buffer::RingBufferAllocation;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::to_underlying;
+
+using testing::Test;
+
+namespace graphics_engine_tests::ring_buffer_tests {
+
+struct RingBufferTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  void SetUp() override {
+    Expected<IRingBufferPtr> result = CreateIRingBuffer(kCapacity);
+    if (!result.has_value() &&
+        result.error().value() == to_underlying(kGLExtensionUnavailable)) {
+      GTEST_SKIP() << "GL_ARB_buffer_storage is not available.";
+    }
+    ASSERT_TRUE(result.has_value());
+    ring_buffer = std::move(*result);
+  }
+
+  static constexpr long long int kCapacity = 1024;
+  IRingBufferPtr ring_buffer;
+};
+
+TEST_F(RingBufferTestFixture, AllocationsAreAlignedAndWritable) {
+  ASSERT_NE(ring_buffer->GetBufferId(), 0U);
+  ASSERT_EQ(ring_buffer->GetCapacity(), kCapacity);
+
+  Expected<RingBufferAllocation> first = ring_buffer->Allocate(10, 4);
+  ASSERT_TRUE(first.has_value());
+  ASSERT_EQ(first->offset, 0);
+  ASSERT_EQ(first->data.size(), 10U);
+
+  Expected<RingBufferAllocation> second = ring_buffer->Allocate(16, 64);
+  ASSERT_TRUE(second.has_value());
+  ASSERT_EQ(second->offset, 64);
+
+  second->data[0] = byte{0x7F};
+  ASSERT_EQ(second->data[0], byte{0x7F});
+  ASSERT_TRUE(ring_buffer->EndFrame().has_value());
+}
+
+TEST_F(RingBufferTestFixture, WrapsAroundOverManyFrames) {
+  for (int frame = 0; frame < 64; ++frame) {
+    Expected<RingBufferAllocation> allocation = ring_buffer->Allocate(300, 16);
+    ASSERT_TRUE(allocation.has_value());
+    ASSERT_LE(allocation->offset + 300, kCapacity);
+    ASSERT_TRUE(ring_buffer->EndFrame().has_value());
+  }
+}
+
+TEST_F(RingBufferTestFixture, FailsWhenOneFrameOutgrowsTheBuffer) {
+  ASSERT_TRUE(ring_buffer->Allocate(600, 4).has_value());
+
+  Expected<RingBufferAllocation> result = ring_buffer->Allocate(600, 4);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().value(), to_underlying(kRingBufferFull));
+
+  // Once the frame is fenced its space can be waited for and reused.
+  ASSERT_TRUE(ring_buffer->EndFrame().has_value());
+  ASSERT_TRUE(ring_buffer->Allocate(600, 4).has_value());
+}
+
+TEST_F(RingBufferTestFixture, FailsWhenOneAllocationOutgrowsTheBuffer) {
+  Expected<RingBufferAllocation> result =
+      ring_buffer->Allocate(kCapacity + 1, 4);
+  ASSERT_FALSE(result.has_value());
+  ASSERT_EQ(result.error().value(), to_underlying(kRingBufferFull));
+}
+
+TEST_F(RingBufferTestFixture, RejectsInvalidArguments) {
+  ASSERT_EQ(ring_buffer->Allocate(0, 4).error().value(),
+            to_underlying(kGLErrorInvalidValue));
+  ASSERT_EQ(ring_buffer->Allocate(16, 0).error().value(),
+            to_underlying(kGLErrorInvalidValue));
+  ASSERT_EQ(ring_buffer->Allocate(16, 3).error().value(),
+            to_underlying(kGLErrorInvalidValue));
+}
+
+}  // namespace graphics_engine_tests::ring_buffer_tests
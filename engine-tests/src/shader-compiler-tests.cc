@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-shader-compiler.h>
+#include <graphics-engine/i-shader.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLShaderType;
+using enum graphics_engine::shader_compiler::ShaderCompileMode;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader_compiler::CreateIShaderCompiler;
+using graphics_engine::shader_compiler::IShaderCompilerPtr;
+using graphics_engine::shader_compiler::ShaderCompileHandle;
+using graphics_engine::shader_compiler::ShaderCompilerOptions;
+using graphics_engine::types::Expected;
+using graphics_engine::types::ShaderSourceMap;
+
+using std::string;
+using std::to_underlying;
+using std::vector;
+
+using testing::Test;
+
+namespace graphics_engine_tests::shader_compiler_tests {
+
+namespace {
+
+constexpr int kProgramCount = 24;
+
+inline const string basic_vs_src = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+void main()
+{
+  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);
+})";
+
+inline const string broken_fs_src = R"(#version 330 core
+out vec4 FragColor;
+void main()
+{
+  FragColour = vec4(1.0f);
+})";
+
+// Distinct fragment shaders, so the driver can't hand back one program.
+auto MakeSources(int index) -> ShaderSourceMap {
+  return {{kVertex, basic_vs_src},
+          {kFragment, R"(#version 330 core
+out vec4 FragColor;
+void main()
+{
+  FragColor = vec4()" + std::to_string(index) +
+                          R"(.0 / 64.0, 0.5f, 0.2f, 1.0f);
+})"}};
+}
+
+// Submit kProgramCount programs and one broken one, poll until every Wait
+// would return at once, then take them all.
+auto CompileBatch(IShaderCompilerPtr& compiler) -> void {
+  vector<ShaderCompileHandle> handles;
+  for (int i = 0; i < kProgramCount; ++i) {
+    handles.push_back(compiler->Submit(MakeSources(i)));
+  }
+  const ShaderCompileHandle broken =
+      compiler->Submit({{kVertex, basic_vs_src}, {kFragment, broken_fs_src}});
+  EXPECT_EQ(compiler->GetPendingCount(), kProgramCount + 1);
+
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  for (const ShaderCompileHandle handle : handles) {
+    while (!compiler->Poll(handle) &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  for (const ShaderCompileHandle handle : handles) {
+    Expected<IShaderPtr> shader = compiler->Wait(handle);
+    ASSERT_TRUE(shader.has_value());
+    EXPECT_NE((*shader)->GetProgramId(), 0);
+    EXPECT_FALSE((*shader)->IsFromBinaryCache());
+  }
+
+  Expected<IShaderPtr> failed = compiler->Wait(broken);
+  ASSERT_FALSE(failed.has_value());
+  EXPECT_EQ(failed.error().value(), to_underlying(kShaderError));
+  EXPECT_EQ(compiler->GetPendingCount(), 0);
+}
+
+}  // namespace
+
+struct ShaderCompilerTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  static GLFWwindow* window;
+};
+
+GLFWwindow* ShaderCompilerTestFixture::window = nullptr;
+
+TEST_F(ShaderCompilerTestFixture, CompilesBatchWithBestMode) {
+  auto compiler = CreateIShaderCompiler();
+  ASSERT_TRUE(compiler.has_value());
+  CompileBatch(*compiler);
+}
+
+TEST_F(ShaderCompilerTestFixture, CompilesBatchWithDeferredStatus) {
+  auto compiler = CreateIShaderCompiler({.prefer_parallel_extension = false});
+  ASSERT_TRUE(compiler.has_value());
+  EXPECT_EQ((*compiler)->GetMode(), kDeferredStatus);
+  CompileBatch(*compiler);
+}
+
+TEST_F(ShaderCompilerTestFixture, CompilesBatchOnWorkerContext) {
+  // Another hidden window whose context shares objects with the main one.
+  GLFWwindow* worker_window = glfwCreateWindow(1, 1, "", nullptr, window);
+  ASSERT_NE(worker_window, nullptr);
+
+  ShaderCompilerOptions options{.prefer_parallel_extension = false};
+  options.make_worker_context_current = [worker_window]() {
+    glfwMakeContextCurrent(worker_window);
+    return glfwGetCurrentContext() == worker_window;
+  };
+  options.release_worker_context = []() { glfwMakeContextCurrent(nullptr); };
+  {
+    auto compiler = CreateIShaderCompiler(std::move(options));
+    ASSERT_TRUE(compiler.has_value());
+    EXPECT_EQ((*compiler)->GetMode(), kWorkerContext);
+    CompileBatch(*compiler);
+  }
+  glfwDestroyWindow(worker_window);
+}
+
+TEST_F(ShaderCompilerTestFixture, FallsBackWithoutWorkerContext) {
+  ShaderCompilerOptions options{.prefer_parallel_extension = false};
+  options.make_worker_context_current = []() { return false; };
+  auto compiler = CreateIShaderCompiler(std::move(options));
+  ASSERT_TRUE(compiler.has_value());
+  EXPECT_EQ((*compiler)->GetMode(), kDeferredStatus);
+}
+
+TEST_F(ShaderCompilerTestFixture, RejectsUnknownHandles) {
+  auto compiler = CreateIShaderCompiler();
+  ASSERT_TRUE(compiler.has_value());
+
+  const ShaderCompileHandle handle = (*compiler)->Submit(MakeSources(0));
+  ASSERT_TRUE((*compiler)->Wait(handle).has_value());
+
+  Expected<IShaderPtr> again = (*compiler)->Wait(handle);
+  ASSERT_FALSE(again.has_value());
+  EXPECT_EQ(again.error().value(), to_underlying(kGLErrorInvalidValue));
+  EXPECT_TRUE((*compiler)->Poll(handle));
+}
+
+TEST_F(ShaderCompilerTestFixture, ReleasesProgramsNotWaitedFor) {
+  auto compiler = CreateIShaderCompiler();
+  ASSERT_TRUE(compiler.has_value());
+  for (int i = 0; i < 4; ++i) {
+    (void)(*compiler)->Submit(MakeSources(i));
+  }
+  EXPECT_EQ((*compiler)->GetPendingCount(), 4);
+}
+
+}  // namespace graphics_engine_tests::shader_compiler_tests
@@ -0,0 +1,182 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-shader-registry.h>
+#include <graphics-engine/i-shader.h>
+
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLShaderType;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::shader_registry::CreateIShaderRegistry;
+using graphics_engine::shader_registry::IShaderRegistryPtr;
+using graphics_engine::shader_registry::SharedShader;
+using graphics_engine::shader_registry::ShaderRegistryStats;
+using graphics_engine::types::Expected;
+using graphics_engine::types::ShaderSourceMap;
+
+using std::string;
+
+using testing::Test;
+
+namespace graphics_engine_tests::shader_registry_tests {
+
+namespace {
+
+inline const string basic_vs_src = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+void main()
+{
+  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);
+})";
+
+// The same shader with CRLF line endings and trailing whitespace.
+inline const string reformatted_vs_src =
+    "#version 330 core\r\n"
+    "layout (location = 0) in vec3 aPos;  \r\n"
+    "void main()\t\r\n"
+    "{\r\n"
+    "  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\r\n"
+    "}\r\n\r\n";
+
+inline const string orange_fs_src = R"(#version 330 core
+out vec4 FragColor;
+void main()
+{
+  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);
+})";
+
+inline const string green_fs_src = R"(#version 330 core
+out vec4 FragColor;
+void main()
+{
+  FragColor = vec4(0.2f, 1.0f, 0.2f, 1.0f);
+})";
+
+auto Acquire(IShaderRegistryPtr& registry, const ShaderSourceMap& sources)
+    -> SharedShader {
+  Expected<SharedShader> shader = registry->Acquire(sources);
+  EXPECT_TRUE(shader.has_value());
+  return shader.has_value() ? std::move(*shader) : nullptr;
+}
+
+}  // namespace
+
+struct ShaderRegistryTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  static GLFWwindow* window;
+};
+
+GLFWwindow* ShaderRegistryTestFixture::window = nullptr;
+
+TEST_F(ShaderRegistryTestFixture, SharesProgramForIdenticalSources) {
+  auto registry = CreateIShaderRegistry();
+  ASSERT_TRUE(registry.has_value());
+
+  SharedShader first = Acquire(*registry, {{kVertex, basic_vs_src},
+                                           {kFragment, orange_fs_src}});
+  SharedShader second = Acquire(*registry, {{kFragment, orange_fs_src},
+                                            {kVertex, basic_vs_src}});
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first.use_count(), 2);
+
+  const ShaderRegistryStats stats = (*registry)->GetStats();
+  EXPECT_EQ(stats.live_programs, 1);
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 1);
+}
+
+TEST_F(ShaderRegistryTestFixture, IgnoresLineEndingsAndTrailingWhitespace) {
+  auto registry = CreateIShaderRegistry();
+  ASSERT_TRUE(registry.has_value());
+
+  const ShaderSourceMap original{{kVertex, basic_vs_src},
+                                 {kFragment, orange_fs_src}};
+  const ShaderSourceMap reformatted{{kVertex, reformatted_vs_src},
+                                    {kFragment, orange_fs_src}};
+  EXPECT_EQ((*registry)->GetKey(original), (*registry)->GetKey(reformatted));
+  EXPECT_EQ(Acquire(*registry, original), Acquire(*registry, reformatted));
+}
+
+TEST_F(ShaderRegistryTestFixture, SeparatesDifferentSources) {
+  auto registry = CreateIShaderRegistry();
+  ASSERT_TRUE(registry.has_value());
+
+  const ShaderSourceMap orange{{kVertex, basic_vs_src},
+                               {kFragment, orange_fs_src}};
+  const ShaderSourceMap green{{kVertex, basic_vs_src},
+                              {kFragment, green_fs_src}};
+  EXPECT_NE((*registry)->GetKey(orange), (*registry)->GetKey(green));
+
+  SharedShader first = Acquire(*registry, orange);
+  SharedShader second = Acquire(*registry, green);
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first->GetProgramId(), second->GetProgramId());
+  EXPECT_EQ((*registry)->GetStats().live_programs, 2);
+}
+
+TEST_F(ShaderRegistryTestFixture, ReleasesProgramWithLastUser) {
+  auto registry = CreateIShaderRegistry();
+  ASSERT_TRUE(registry.has_value());
+  const ShaderSourceMap sources{{kVertex, basic_vs_src},
+                                {kFragment, orange_fs_src}};
+
+  SharedShader first = Acquire(*registry, sources);
+  SharedShader second = first;
+  first.reset();
+  EXPECT_EQ((*registry)->GetStats().live_programs, 1);
+  second.reset();
+  EXPECT_EQ((*registry)->GetStats().live_programs, 0);
+
+  // The next request compiles the program again.
+  SharedShader third = Acquire(*registry, sources);
+  ASSERT_NE(third, nullptr);
+  EXPECT_EQ((*registry)->GetStats().misses, 2);
+}
+
+TEST_F(ShaderRegistryTestFixture, ProgramsOutliveRegistry) {
+  SharedShader shader;
+  {
+    auto registry = CreateIShaderRegistry();
+    ASSERT_TRUE(registry.has_value());
+    shader = Acquire(*registry, {{kVertex, basic_vs_src},
+                                 {kFragment, green_fs_src}});
+  }
+  ASSERT_NE(shader, nullptr);
+  EXPECT_NE(shader->GetProgramId(), 0);
+  shader.reset();
+}
+
+}  // namespace graphics_engine_tests::shader_registry_tests
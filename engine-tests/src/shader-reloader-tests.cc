@@ -0,0 +1,231 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-shader-reloader.h>
+#include <graphics-engine/i-shader.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::gl_types::GLShaderType;
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::shader::HashUniformName;
+using graphics_engine::shader_reloader::CreateIShaderReloader;
+using graphics_engine::shader_reloader::IShaderReloaderPtr;
+using graphics_engine::shader_reloader::ReloadableShader;
+using graphics_engine::shader_reloader::ShaderFileMap;
+using graphics_engine::shader_reloader::ShaderReloaderStats;
+using graphics_engine::types::Expected;
+
+using std::string;
+using std::to_underlying;
+using std::filesystem::path;
+
+using testing::Test;
+
+namespace graphics_engine_tests::shader_reloader_tests {
+
+namespace {
+
+inline const string basic_vs_src = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+void main()
+{
+  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);
+})";
+
+inline const string orange_fs_src = R"(#version 330 core
+out vec4 FragColor;
+void main()
+{
+  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);
+})";
+
+inline const string tinted_fs_src = R"(#version 330 core
+uniform vec3 tint;
+out vec4 FragColor;
+void main()
+{
+  FragColor = vec4(tint, 1.0f);
+})";
+
+inline const string broken_fs_src = R"(#version 330 core
+out vec4 FragColor;
+void main()
+{
+  FragColour = vec4(1.0f);
+})";
+
+auto WriteFile(const path& file, const string& contents) -> void {
+  std::ofstream(file, std::ios::binary | std::ios::trunc) << contents;
+}
+
+// Call Update as a render loop would until `done` holds or a few seconds
+// pass. Returns whether `done` held.
+template <typename Done>
+auto UpdateUntil(IShaderReloaderPtr& reloader, Done done) -> bool {
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!done()) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    (void)reloader->Update();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return true;
+}
+
+}  // namespace
+
+struct ShaderReloaderTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+
+  void SetUp() override {
+    directory = std::filesystem::temp_directory_path() /
+                "graphics-engine-shader-reloader-tests";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    vertex_file = directory / "basic.vert";
+    fragment_file = directory / "basic.frag";
+    WriteFile(vertex_file, basic_vs_src);
+    WriteFile(fragment_file, orange_fs_src);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory); }
+
+  [[nodiscard]] auto GetFiles() const -> ShaderFileMap {
+    return {{kVertex, vertex_file}, {kFragment, fragment_file}};
+  }
+
+  static GLFWwindow* window;
+  path directory;
+  path vertex_file;
+  path fragment_file;
+};
+
+GLFWwindow* ShaderReloaderTestFixture::window = nullptr;
+
+TEST_F(ShaderReloaderTestFixture, SwapsInProgramWhenFileChanges) {
+  auto reloader = CreateIShaderReloader();
+  ASSERT_TRUE(reloader.has_value());
+  Expected<ReloadableShader> shader = (*reloader)->Load(GetFiles());
+  ASSERT_TRUE(shader.has_value());
+  const unsigned int original = (*shader)->GetProgramId();
+  EXPECT_EQ((*shader)->GetUniformLocation(HashUniformName("tint")), -1);
+
+  WriteFile(fragment_file, tinted_fs_src);
+  ASSERT_TRUE(UpdateUntil(*reloader, [&]() {
+    return (*reloader)->GetStats().reloads == 1;
+  }));
+  EXPECT_NE((*shader)->GetProgramId(), original);
+  EXPECT_NE((*shader)->GetUniformLocation(HashUniformName("tint")), -1);
+
+  const ShaderReloaderStats stats = (*reloader)->GetStats();
+  EXPECT_EQ(stats.watched_shaders, 1);
+  EXPECT_EQ(stats.pending_compiles, 0);
+  EXPECT_EQ(stats.failures, 0);
+}
+
+TEST_F(ShaderReloaderTestFixture, DetectsFilesReplacedByRename) {
+  auto reloader = CreateIShaderReloader();
+  ASSERT_TRUE(reloader.has_value());
+  Expected<ReloadableShader> shader = (*reloader)->Load(GetFiles());
+  ASSERT_TRUE(shader.has_value());
+
+  // Many editors save to a temporary file and rename it over the original.
+  const path temporary = directory / "basic.frag.swp";
+  WriteFile(temporary, tinted_fs_src);
+  std::filesystem::rename(temporary, fragment_file);
+  EXPECT_TRUE(UpdateUntil(*reloader, [&]() {
+    return (*reloader)->GetStats().reloads == 1;
+  }));
+}
+
+TEST_F(ShaderReloaderTestFixture, KeepsProgramWhenReloadFails) {
+  auto reloader = CreateIShaderReloader();
+  ASSERT_TRUE(reloader.has_value());
+  Expected<ReloadableShader> shader = (*reloader)->Load(GetFiles());
+  ASSERT_TRUE(shader.has_value());
+  const unsigned int original = (*shader)->GetProgramId();
+
+  WriteFile(fragment_file, broken_fs_src);
+  ASSERT_TRUE(UpdateUntil(*reloader, [&]() {
+    return (*reloader)->GetStats().failures == 1;
+  }));
+  EXPECT_EQ((*shader)->GetProgramId(), original);
+  EXPECT_EQ((*reloader)->GetStats().reloads, 0);
+
+  // Fixing the file recovers.
+  WriteFile(fragment_file, tinted_fs_src);
+  ASSERT_TRUE(UpdateUntil(*reloader, [&]() {
+    return (*reloader)->GetStats().reloads == 1;
+  }));
+  EXPECT_NE((*shader)->GetProgramId(), original);
+}
+
+TEST_F(ShaderReloaderTestFixture, RejectsMissingAndBrokenFiles) {
+  auto reloader = CreateIShaderReloader();
+  ASSERT_TRUE(reloader.has_value());
+
+  Expected<ReloadableShader> missing = (*reloader)->Load(
+      {{kVertex, vertex_file}, {kFragment, directory / "missing.frag"}});
+  ASSERT_FALSE(missing.has_value());
+  EXPECT_EQ(missing.error().value(), to_underlying(kFileIoError));
+
+  WriteFile(fragment_file, broken_fs_src);
+  Expected<ReloadableShader> broken = (*reloader)->Load(GetFiles());
+  ASSERT_FALSE(broken.has_value());
+  EXPECT_EQ(broken.error().value(), to_underlying(kShaderError));
+  EXPECT_EQ((*reloader)->GetStats().watched_shaders, 0);
+}
+
+TEST_F(ShaderReloaderTestFixture, ForgetsReleasedShaders) {
+  auto reloader = CreateIShaderReloader();
+  ASSERT_TRUE(reloader.has_value());
+  {
+    Expected<ReloadableShader> shader = (*reloader)->Load(GetFiles());
+    ASSERT_TRUE(shader.has_value());
+    EXPECT_EQ((*reloader)->GetStats().watched_shaders, 1);
+  }
+  EXPECT_EQ((*reloader)->GetStats().watched_shaders, 0);
+
+  WriteFile(fragment_file, tinted_fs_src);
+  (void)(*reloader)->Update();
+  EXPECT_EQ((*reloader)->GetStats().pending_compiles, 0);
+}
+
+}  // namespace graphics_engine_tests::shader_reloader_tests
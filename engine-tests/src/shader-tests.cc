@@ -6,15 +6,36 @@
 #include <graphics-engine/engine.h>
 #include <graphics-engine/i-shader.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <iterator>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 using enum graphics_engine::gl_types::GLShaderType;
+using enum graphics_engine::shader::UniformType;
+using enum graphics_engine::types::ErrorCode;
 
 using graphics_engine::engine::InitializeEngine;
 using graphics_engine::shader::CreateIShader;
+using graphics_engine::shader::HashUniformName;
+using graphics_engine::shader::IShaderPtr;
+using graphics_engine::shader::UniformInfo;
+using graphics_engine::shader::UniformStats;
+using graphics_engine::types::Expected;
 using graphics_engine::types::ShaderSourceMap;
 
 using std::string;
+using std::to_underlying;
+using std::vector;
+using std::filesystem::directory_iterator;
+using std::filesystem::path;
 
 using testing::Test;
 
@@ -43,8 +64,38 @@ void main()
   FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);
 })";
 
+inline const string uniform_vs_src = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+uniform mat4 model;
+uniform float scale[2];
+void main()
+{
+  gl_Position = model * vec4(aPos * scale[0] * scale[1], 1.0);
+})";
+
+inline const string uniform_fs_src = R"(#version 330 core
+uniform vec3 tint;
+uniform sampler2D albedo;
+uniform float unused;
+out vec4 FragColor;
+void main()
+{
+  FragColor = texture(albedo, vec2(0.5)) * vec4(tint, 1.0);
+})";
+
+constexpr std::uint32_t kModel = HashUniformName("model");
+constexpr std::uint32_t kScale = HashUniformName("scale");
+constexpr std::uint32_t kTint = HashUniformName("tint");
+constexpr std::uint32_t kAlbedo = HashUniformName("albedo");
+
 }  // namespace
 
+TEST(ShaderTest, HashUniformNameIsFnv1a) {
+  static_assert(HashUniformName("") == 0x811C9DC5U);
+  EXPECT_EQ(HashUniformName("a"), 0xE40C292CU);
+  EXPECT_NE(HashUniformName("tint"), HashUniformName("tint2"));
+}
+
 struct ShaderTestFixture : public Test {
   static void SetUpTestSuite() {
     ASSERT_EQ(glfwInit(), GLFW_TRUE);
@@ -76,6 +127,161 @@ TEST_F(ShaderTestFixture, ShaderWorksWithGoodSourceCode) {
                              {kFragment, basic_fs_src}};
   auto shader = CreateIShader(sources);
   ASSERT_NE(shader->GetProgramId(), 0);
+  EXPECT_FALSE(shader->IsFromBinaryCache());
+}
+
+TEST_F(ShaderTestFixture, ReflectsActiveUniforms) {
+  IShaderPtr shader =
+      CreateIShader({{kVertex, uniform_vs_src}, {kFragment, uniform_fs_src}});
+  ASSERT_NE(shader, nullptr);
+
+  // `unused` is optimized out, so it isn't active.
+  auto uniforms = shader->GetUniforms();
+  ASSERT_EQ(uniforms.size(), 4);
+  EXPECT_TRUE(std::ranges::is_sorted(uniforms, {}, &UniformInfo::name_hash));
+  EXPECT_EQ(shader->GetUniformLocation(HashUniformName("unused")), -1);
+
+  auto find = [&](std::uint32_t name_hash) -> const UniformInfo* {
+    const auto it = std::ranges::find(uniforms, name_hash,
+                                      &UniformInfo::name_hash);
+    return it == uniforms.end() ? nullptr : &*it;
+  };
+  const UniformInfo* model = find(kModel);
+  const UniformInfo* scale = find(kScale);
+  const UniformInfo* tint = find(kTint);
+  const UniformInfo* albedo = find(kAlbedo);
+  ASSERT_NE(model, nullptr);
+  ASSERT_NE(scale, nullptr);
+  ASSERT_NE(tint, nullptr);
+  ASSERT_NE(albedo, nullptr);
+  EXPECT_EQ(model->type, kMat4);
+  EXPECT_EQ(scale->type, kFloat);
+  EXPECT_EQ(scale->array_size, 2);
+  EXPECT_EQ(tint->type, kVec3);
+  EXPECT_EQ(albedo->type, kSampler);
+  EXPECT_EQ(shader->GetUniformLocation(kTint), tint->location);
+}
+
+TEST_F(ShaderTestFixture, SkipsUnchangedUniformValues) {
+  IShaderPtr shader =
+      CreateIShader({{kVertex, uniform_vs_src}, {kFragment, uniform_fs_src}});
+  ASSERT_NE(shader, nullptr);
+  const int model = shader->GetUniformLocation(kModel);
+  const int tint = shader->GetUniformLocation(kTint);
+  const int albedo = shader->GetUniformLocation(kAlbedo);
+
+  for (int frame = 0; frame < 3; ++frame) {
+    EXPECT_TRUE(shader->SetUniform(model, glm::mat4(1.0f)).has_value());
+    EXPECT_TRUE(shader->SetUniform(tint, glm::vec3(1.0f, 0.5f, 0.25f))
+                    .has_value());
+    EXPECT_TRUE(shader->SetUniform(albedo, 0).has_value());
+  }
+  UniformStats stats = shader->GetUniformStats();
+  EXPECT_EQ(stats.issued, 3);
+  EXPECT_EQ(stats.skipped, 6);
+
+  EXPECT_TRUE(shader->SetUniform(tint, glm::vec3(0.0f, 0.5f, 0.25f))
+                  .has_value());
+  stats = shader->GetUniformStats();
+  EXPECT_EQ(stats.issued, 4);
+  EXPECT_EQ(stats.skipped, 6);
+}
+
+TEST_F(ShaderTestFixture, RejectsMismatchedUniforms) {
+  IShaderPtr shader =
+      CreateIShader({{kVertex, uniform_vs_src}, {kFragment, uniform_fs_src}});
+  ASSERT_NE(shader, nullptr);
+
+  // -1 is ignored, as glUniform does.
+  EXPECT_TRUE(shader->SetUniform(-1, 1.0f).has_value());
+
+  Expected<void> result =
+      shader->SetUniform(shader->GetUniformLocation(kTint), 1.0f);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().value(), to_underlying(kGLErrorInvalidOperation));
+
+  result = shader->SetUniform(1000, 1.0f);
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().value(), to_underlying(kGLErrorInvalidOperation));
+  EXPECT_EQ(shader->GetUniformStats().issued, 0);
+}
+
+struct ShaderCacheTestFixture : public ShaderTestFixture {
+  void SetUp() override {
+    cache_directory = std::filesystem::temp_directory_path() /
+                      "graphics-engine-shader-cache-tests";
+    std::filesystem::remove_all(cache_directory);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(cache_directory); }
+
+  [[nodiscard]] auto Create() const -> IShaderPtr {
+    return CreateIShader({{kVertex, basic_vs_src}, {kFragment, basic_fs_src}},
+                         {.binary_cache_directory = cache_directory});
+  }
+
+  [[nodiscard]] auto GetEntries() const -> vector<path> {
+    vector<path> entries;
+    if (std::filesystem::exists(cache_directory)) {
+      for (const auto& entry : directory_iterator(cache_directory)) {
+        entries.push_back(entry.path());
+      }
+    }
+    return entries;
+  }
+
+  path cache_directory;
+};
+
+TEST_F(ShaderCacheTestFixture, RestoresProgramFromCache) {
+  IShaderPtr cold = Create();
+  ASSERT_NE(cold, nullptr);
+  EXPECT_FALSE(cold->IsFromBinaryCache());
+  if (GetEntries().empty()) {
+    GTEST_SKIP() << "The driver doesn't provide program binaries.";
+  }
+  ASSERT_EQ(GetEntries().size(), 1);
+
+  IShaderPtr warm = Create();
+  ASSERT_NE(warm, nullptr);
+  EXPECT_TRUE(warm->IsFromBinaryCache());
+  EXPECT_NE(warm->GetProgramId(), 0);
+
+  // Different sources get their own entry.
+  IShaderPtr other = CreateIShader(
+      {{kVertex, basic_vs_src},
+       {kFragment, basic_fs_src + "\n// edited\n"}},
+      {.binary_cache_directory = cache_directory});
+  ASSERT_NE(other, nullptr);
+  EXPECT_FALSE(other->IsFromBinaryCache());
+  EXPECT_EQ(GetEntries().size(), 2);
+}
+
+TEST_F(ShaderCacheTestFixture, CompilesWhenEntryIsCorrupt) {
+  ASSERT_NE(Create(), nullptr);
+  const vector<path> entries = GetEntries();
+  if (entries.empty()) {
+    GTEST_SKIP() << "The driver doesn't provide program binaries.";
+  }
+
+  std::ifstream in(entries.front(), std::ios::binary);
+  vector<char> bytes{std::istreambuf_iterator<char>(in),
+                     std::istreambuf_iterator<char>()};
+  in.close();
+  ASSERT_FALSE(bytes.empty());
+  bytes.back() = static_cast<char>(bytes.back() ^ 0x5A);
+  std::ofstream(entries.front(), std::ios::binary | std::ios::trunc)
+      .write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+  IShaderPtr recompiled = Create();
+  ASSERT_NE(recompiled, nullptr);
+  EXPECT_FALSE(recompiled->IsFromBinaryCache());
+  EXPECT_NE(recompiled->GetProgramId(), 0);
+
+  // The bad entry was replaced.
+  IShaderPtr warm = Create();
+  ASSERT_NE(warm, nullptr);
+  EXPECT_TRUE(warm->IsFromBinaryCache());
 }
 
 }  // namespace graphics_engine_tests::shader_tests
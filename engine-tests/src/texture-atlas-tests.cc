@@ -0,0 +1,206 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-texture-atlas.h>
+#include <graphics-engine/image.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using enum graphics_engine::types::ErrorCode;
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::image::ImageView;
+using graphics_engine::texture_atlas::AtlasHandle;
+using graphics_engine::texture_atlas::AtlasRegion;
+using graphics_engine::texture_atlas::CreateITextureAtlas;
+using graphics_engine::texture_atlas::ITextureAtlasPtr;
+using graphics_engine::texture_atlas::TextureAtlasStats;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::size_t;
+using std::to_underlying;
+using std::vector;
+
+using testing::Test;
+
+namespace graphics_engine_tests::texture_atlas_tests {
+
+namespace {
+
+auto MakePixels(int width, int height) -> vector<byte> {
+  return vector<byte>(static_cast<size_t>(width) * height * 4, byte{0x7F});
+}
+
+auto MakeView(const vector<byte>& pixels, int width, int height)
+    -> ImageView {
+  return {.width = width,
+          .height = height,
+          .channels = 4,
+          .pixels = pixels,
+          .bottom_up = false};
+}
+
+}  // namespace
+
+TEST(TextureAtlasTests, RejectsBadOptions) {
+  EXPECT_FALSE(CreateITextureAtlas({.page_size = 0}).has_value());
+  EXPECT_FALSE(CreateITextureAtlas({.max_pages = 0}).has_value());
+  EXPECT_FALSE(CreateITextureAtlas({.padding = -1}).has_value());
+  EXPECT_FALSE(
+      CreateITextureAtlas({.page_size = 64, .mip_levels = 8}).has_value());
+}
+
+TEST(TextureAtlasTests, PacksWithoutOverlap) {
+  constexpr int kPageSize = 256;
+  constexpr int kPadding = 2;
+  constexpr int kAlignment = 4;  // 2^(mip_levels - 1)
+  auto atlas = CreateITextureAtlas({.page_size = kPageSize,
+                                    .max_pages = 8,
+                                    .padding = kPadding,
+                                    .mip_levels = 3});
+  ASSERT_TRUE(atlas.has_value());
+
+  vector<AtlasRegion> regions;
+  std::uint32_t seed = 7;
+  for (int i = 0; i < 150; ++i) {
+    seed = (seed * 1664525U) + 1013904223U;
+    const int width = 1 + static_cast<int>((seed >> 8U) % 40);
+    const int height = 1 + static_cast<int>((seed >> 20U) % 40);
+    const vector<byte> pixels = MakePixels(width, height);
+    Expected<AtlasHandle> handle = (*atlas)->Add(MakeView(pixels, width,
+                                                          height));
+    ASSERT_TRUE(handle.has_value());
+    Expected<AtlasRegion> region = (*atlas)->GetRegion(*handle);
+    ASSERT_TRUE(region.has_value());
+    EXPECT_EQ(region->width, width);
+    EXPECT_EQ(region->height, height);
+    EXPECT_EQ((region->x - kPadding) % kAlignment, 0);
+    EXPECT_EQ((region->y - kPadding) % kAlignment, 0);
+    EXPECT_GE(region->x, kPadding);
+    EXPECT_GE(region->y, kPadding);
+    EXPECT_LE(region->x + width + kPadding, kPageSize);
+    EXPECT_LE(region->y + height + kPadding, kPageSize);
+    EXPECT_FLOAT_EQ(region->u0, static_cast<float>(region->x) / kPageSize);
+    EXPECT_FLOAT_EQ(region->v1,
+                    static_cast<float>(region->y + height) / kPageSize);
+    regions.push_back(*region);
+  }
+
+  // Padded images must not overlap on the same page.
+  for (size_t a = 0; a < regions.size(); ++a) {
+    for (size_t b = a + 1; b < regions.size(); ++b) {
+      const AtlasRegion& first = regions[a];
+      const AtlasRegion& second = regions[b];
+      if (first.page != second.page) {
+        continue;
+      }
+      const bool apart =
+          first.x + first.width + kPadding <= second.x - kPadding ||
+          second.x + second.width + kPadding <= first.x - kPadding ||
+          first.y + first.height + kPadding <= second.y - kPadding ||
+          second.y + second.height + kPadding <= first.y - kPadding;
+      EXPECT_TRUE(apart) << "images " << a << " and " << b << " overlap";
+    }
+  }
+
+  const TextureAtlasStats stats = (*atlas)->GetStats();
+  EXPECT_EQ(stats.image_count, regions.size());
+  EXPECT_GT(stats.page_count, 1);
+  EXPECT_EQ(stats.dirty_pages, stats.page_count);
+}
+
+TEST(TextureAtlasTests, FailsWhenEveryPageIsFull) {
+  auto atlas = CreateITextureAtlas(
+      {.page_size = 64, .max_pages = 2, .padding = 0, .mip_levels = 1});
+  ASSERT_TRUE(atlas.has_value());
+
+  const vector<byte> pixels = MakePixels(32, 32);
+  for (int i = 0; i < 8; ++i) {
+    Expected<AtlasHandle> handle = (*atlas)->Add(MakeView(pixels, 32, 32));
+    ASSERT_TRUE(handle.has_value());
+    EXPECT_EQ((*atlas)->GetRegion(*handle)->page, i / 4);
+  }
+  Expected<AtlasHandle> full = (*atlas)->Add(MakeView(pixels, 32, 32));
+  ASSERT_FALSE(full.has_value());
+  EXPECT_EQ(full.error().value(), to_underlying(kTextureAtlasFull));
+  EXPECT_EQ((*atlas)->GetStats().used_pixels, 2 * 64 * 64);
+}
+
+TEST(TextureAtlasTests, RejectsImagesLargerThanAPage) {
+  auto atlas = CreateITextureAtlas({.page_size = 64, .padding = 1});
+  ASSERT_TRUE(atlas.has_value());
+
+  const vector<byte> pixels = MakePixels(63, 8);
+  Expected<AtlasHandle> handle = (*atlas)->Add(MakeView(pixels, 63, 8));
+  ASSERT_FALSE(handle.has_value());
+  EXPECT_EQ(handle.error().value(), to_underlying(kGLErrorInvalidValue));
+  EXPECT_FALSE((*atlas)->GetRegion(1).has_value());
+}
+
+struct TextureAtlasTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+};
+
+TEST_F(TextureAtlasTestFixture, UploadsOnlyChangedPages) {
+  auto atlas = CreateITextureAtlas({.page_size = 128, .max_pages = 4});
+  ASSERT_TRUE(atlas.has_value());
+  EXPECT_TRUE((*atlas)->Upload().has_value());
+
+  const vector<byte> pixels = MakePixels(16, 16);
+  Expected<AtlasHandle> first = (*atlas)->Add(MakeView(pixels, 16, 16));
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ((*atlas)->GetTextureId(0), 0);
+
+  ASSERT_TRUE((*atlas)->Upload().has_value());
+  const unsigned int texture = (*atlas)->GetTextureId(0);
+  EXPECT_NE(texture, 0);
+  EXPECT_EQ((*atlas)->GetStats().dirty_pages, 0);
+  const AtlasRegion before = *(*atlas)->GetRegion(*first);
+
+  // Images added later go into the same texture without moving earlier ones.
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE((*atlas)->Add(MakeView(pixels, 16, 16)).has_value());
+  }
+  EXPECT_EQ((*atlas)->GetStats().dirty_pages, 1);
+  ASSERT_TRUE((*atlas)->Upload().has_value());
+  EXPECT_EQ((*atlas)->GetTextureId(0), texture);
+  EXPECT_EQ((*atlas)->GetStats().dirty_pages, 0);
+
+  const AtlasRegion after = *(*atlas)->GetRegion(*first);
+  EXPECT_EQ(after.x, before.x);
+  EXPECT_EQ(after.y, before.y);
+  EXPECT_EQ((*atlas)->GetTextureId(1), 0);
+}
+
+}  // namespace graphics_engine_tests::texture_atlas_tests
@@ -0,0 +1,254 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-texture-loader.h>
+#include <graphics-engine/image.h>
+#include <graphics-engine/texture-container.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::image::ImageView;
+using graphics_engine::texture_container::ConvertToTextureContainer;
+using graphics_engine::texture_container::LoadTextureContainer;
+using graphics_engine::texture_container::ReadTextureContainerInfo;
+using graphics_engine::texture_container::TextureContainerInfo;
+using graphics_engine::texture_container::WriteTextureContainer;
+using graphics_engine::texture_loader::DeleteTexture;
+using graphics_engine::texture_loader::Texture;
+using graphics_engine::types::Expected;
+
+using std::byte;
+using std::size_t;
+using std::vector;
+using std::filesystem::path;
+
+using testing::Test;
+
+namespace graphics_engine_tests::texture_container_tests {
+
+namespace {
+
+auto TempPath(const char* name) -> path {
+  return std::filesystem::temp_directory_path() / name;
+}
+
+// Reads `file` back as raw bytes.
+auto ReadBytes(const path& file) -> vector<char> {
+  std::ifstream stream(file, std::ios::binary);
+  return {std::istreambuf_iterator<char>(stream),
+          std::istreambuf_iterator<char>()};
+}
+
+auto WriteBytes(const path& file, const vector<char>& bytes) -> void {
+  std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+  stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+}  // namespace
+
+TEST(TextureContainerTests, WritesAlignedMipChain) {
+  // 5x3 RGB, bottom row first; level 0 must come out RGBA and top-down.
+  vector<byte> pixels(5 * 3 * 3);
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    pixels[i] = static_cast<byte>(i);
+  }
+  const path file = TempPath("texture-container-mips.getex");
+  ASSERT_TRUE(WriteTextureContainer(ImageView{.width = 5,
+                                              .height = 3,
+                                              .channels = 3,
+                                              .pixels = pixels,
+                                              .bottom_up = true},
+                                    file)
+                  .has_value());
+
+  Expected<TextureContainerInfo> info = ReadTextureContainerInfo(file);
+  ASSERT_TRUE(info.has_value());
+  EXPECT_EQ(info->width, 5);
+  EXPECT_EQ(info->height, 3);
+  ASSERT_EQ(info->levels.size(), 3);
+  const int widths[] = {5, 2, 1};
+  const int heights[] = {3, 1, 1};
+  for (size_t level = 0; level < info->levels.size(); ++level) {
+    EXPECT_EQ(info->levels[level].width, widths[level]);
+    EXPECT_EQ(info->levels[level].height, heights[level]);
+    EXPECT_EQ(info->levels[level].size,
+              static_cast<std::uint64_t>(widths[level]) * heights[level] * 4);
+    EXPECT_EQ(info->levels[level].offset % 64, 0);
+  }
+
+  const vector<char> bytes = ReadBytes(file);
+  const auto first = static_cast<size_t>(info->levels[0].offset);
+  // The top row is the last row of the bottom-up source.
+  EXPECT_EQ(static_cast<unsigned char>(bytes[first]), 30);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[first + 1]), 31);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[first + 2]), 32);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[first + 3]), 255);
+
+  std::filesystem::remove(file);
+}
+
+TEST(TextureContainerTests, DownsamplingKeepsOddLastColumn) {
+  // A 3-wide level halves to 1 texel, which must include column 2.
+  const vector<byte> pixels = {byte{0}, byte{0}, byte{255}};
+  const path file = TempPath("texture-container-odd.getex");
+  ASSERT_TRUE(WriteTextureContainer(
+                  ImageView{.width = 3, .height = 1, .channels = 1,
+                            .pixels = pixels},
+                  file)
+                  .has_value());
+
+  Expected<TextureContainerInfo> info = ReadTextureContainerInfo(file);
+  ASSERT_TRUE(info.has_value());
+  ASSERT_EQ(info->levels.size(), 2);
+  ASSERT_EQ(info->levels[1].width, 1);
+
+  const vector<char> bytes = ReadBytes(file);
+  const auto texel = static_cast<size_t>(info->levels[1].offset);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[texel]), 85);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[texel + 3]), 255);
+
+  std::filesystem::remove(file);
+}
+
+TEST(TextureContainerTests, SkipsMipmapsWhenAsked) {
+  const vector<byte> pixels(16 * 16 * 4);
+  const path file = TempPath("texture-container-single.getex");
+  ASSERT_TRUE(WriteTextureContainer(ImageView{.width = 16,
+                                              .height = 16,
+                                              .channels = 4,
+                                              .pixels = pixels,
+                                              .bottom_up = false},
+                                    file, {.generate_mipmaps = false})
+                  .has_value());
+
+  Expected<TextureContainerInfo> info = ReadTextureContainerInfo(file);
+  ASSERT_TRUE(info.has_value());
+  EXPECT_EQ(info->levels.size(), 1);
+  std::filesystem::remove(file);
+}
+
+TEST(TextureContainerTests, ConvertsPng) {
+  const path file = TempPath("texture-container-hello.getex");
+  ASSERT_TRUE(
+      ConvertToTextureContainer(path("screenshots/hello-window.png"), file)
+          .has_value());
+
+  Expected<TextureContainerInfo> info = ReadTextureContainerInfo(file);
+  ASSERT_TRUE(info.has_value());
+  EXPECT_EQ(info->width, 640);
+  EXPECT_EQ(info->height, 480);
+  ASSERT_EQ(info->levels.size(), 10);
+  EXPECT_EQ(info->levels.back().width, 1);
+  EXPECT_EQ(info->levels.back().height, 1);
+
+  // A solid image stays solid all the way down the chain.
+  const vector<char> bytes = ReadBytes(file);
+  const auto last = static_cast<size_t>(info->levels.back().offset);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[last]), 0x33);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[last + 1]), 0x4c);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[last + 2]), 0x4c);
+  EXPECT_EQ(static_cast<unsigned char>(bytes[last + 3]), 0xff);
+  std::filesystem::remove(file);
+}
+
+TEST(TextureContainerTests, RejectsMissingSource) {
+  EXPECT_FALSE(ConvertToTextureContainer(path("screenshots/missing.png"),
+                                         TempPath("missing.getex"))
+                   .has_value());
+  EXPECT_FALSE(ReadTextureContainerInfo(path("screenshots/missing.getex"))
+                   .has_value());
+}
+
+TEST(TextureContainerTests, RejectsMalformedFiles) {
+  const vector<byte> pixels(8 * 8 * 4);
+  const path file = TempPath("texture-container-malformed.getex");
+  ASSERT_TRUE(WriteTextureContainer(ImageView{.width = 8,
+                                              .height = 8,
+                                              .channels = 4,
+                                              .pixels = pixels,
+                                              .bottom_up = false},
+                                    file)
+                  .has_value());
+  const vector<char> valid = ReadBytes(file);
+
+  vector<char> truncated(valid.begin(), valid.end() - 1);
+  WriteBytes(file, truncated);
+  EXPECT_FALSE(ReadTextureContainerInfo(file).has_value());
+
+  vector<char> bad_magic = valid;
+  bad_magic[0] = 'X';
+  WriteBytes(file, bad_magic);
+  EXPECT_FALSE(ReadTextureContainerInfo(file).has_value());
+
+  vector<char> bad_offset = valid;
+  bad_offset[32] = 1;  // First level offset, no longer aligned.
+  WriteBytes(file, bad_offset);
+  EXPECT_FALSE(ReadTextureContainerInfo(file).has_value());
+
+  WriteBytes(file, {});
+  EXPECT_FALSE(ReadTextureContainerInfo(file).has_value());
+
+  std::filesystem::remove(file);
+}
+
+struct TextureContainerTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+};
+
+TEST_F(TextureContainerTestFixture, UploadsEveryLevel) {
+  const path file = TempPath("texture-container-upload.getex");
+  ASSERT_TRUE(
+      ConvertToTextureContainer(path("screenshots/hello-window.png"), file)
+          .has_value());
+
+  Expected<Texture> texture = LoadTextureContainer(file);
+  ASSERT_TRUE(texture.has_value());
+  EXPECT_NE(texture->id, 0);
+  EXPECT_EQ(texture->width, 640);
+  EXPECT_EQ(texture->height, 480);
+  EXPECT_EQ(texture->levels, 10);
+
+  DeleteTexture(*texture);
+  EXPECT_EQ(texture->id, 0);
+  std::filesystem::remove(file);
+}
+
+TEST_F(TextureContainerTestFixture, FailsMalformedFiles) {
+  EXPECT_FALSE(
+      LoadTextureContainer(path("screenshots/hello-window.png")).has_value());
+}
+
+}  // namespace graphics_engine_tests::texture_container_tests
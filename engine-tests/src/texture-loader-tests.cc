@@ -0,0 +1,131 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <GLFW/glfw3.h>
+#include <graphics-engine/engine.h>
+#include <graphics-engine/i-texture-loader.h>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::engine::InitializeEngine;
+using graphics_engine::texture_loader::CreateITextureLoader;
+using graphics_engine::texture_loader::DeleteTexture;
+using graphics_engine::texture_loader::Texture;
+using graphics_engine::texture_loader::TextureFuture;
+using graphics_engine::types::Expected;
+
+using std::size_t;
+using std::vector;
+using std::filesystem::path;
+
+using testing::Test;
+
+namespace graphics_engine_tests::texture_loader_tests {
+
+struct TextureLoaderTestFixture : public Test {
+  static void SetUpTestSuite() {
+    ASSERT_EQ(glfwInit(), GLFW_TRUE);
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "", nullptr, nullptr);
+    ASSERT_NE(window, nullptr);
+
+    glfwMakeContextCurrent(window);
+    error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+
+    auto init_engine_result = InitializeEngine();
+    ASSERT_TRUE(init_engine_result.has_value());
+  }
+
+  static void TearDownTestSuite() {
+    glfwTerminate();
+    int error = glfwGetError(nullptr);
+    ASSERT_EQ(error, GLFW_NO_ERROR);
+  }
+};
+
+TEST_F(TextureLoaderTestFixture, RejectsEmptyOptions) {
+  EXPECT_FALSE(CreateITextureLoader({.worker_count = 0}).has_value());
+  EXPECT_FALSE(CreateITextureLoader({.staging_buffers = 0}).has_value());
+  EXPECT_FALSE(CreateITextureLoader({.upload_budget_bytes = 0}).has_value());
+}
+
+TEST_F(TextureLoaderTestFixture, AllocatesFullMipChain) {
+  auto loader = CreateITextureLoader();
+  ASSERT_TRUE(loader.has_value());
+
+  TextureFuture future = (*loader)->Load(path("screenshots/hello-window.png"));
+  ASSERT_TRUE((*loader)->Flush().has_value());
+  EXPECT_EQ((*loader)->GetPendingCount(), 0);
+
+  Expected<Texture> texture = future.get();
+  ASSERT_TRUE(texture.has_value());
+  EXPECT_NE(texture->id, 0);
+  EXPECT_EQ(texture->width, 640);
+  EXPECT_EQ(texture->height, 480);
+  EXPECT_EQ(texture->levels, 10);
+
+  DeleteTexture(*texture);
+  EXPECT_EQ(texture->id, 0);
+}
+
+TEST_F(TextureLoaderTestFixture, FailsMissingFilesWithoutStalling) {
+  auto loader = CreateITextureLoader({.generate_mipmaps = false});
+  ASSERT_TRUE(loader.has_value());
+
+  TextureFuture missing = (*loader)->Load(path("screenshots/missing.png"));
+  TextureFuture present =
+      (*loader)->Load(path("screenshots/hello-triangle.png"));
+  ASSERT_TRUE((*loader)->Flush().has_value());
+
+  Expected<Texture> failed = missing.get();
+  EXPECT_FALSE(failed.has_value());
+
+  Expected<Texture> texture = present.get();
+  ASSERT_TRUE(texture.has_value());
+  EXPECT_EQ(texture->levels, 1);
+  DeleteTexture(*texture);
+}
+
+TEST_F(TextureLoaderTestFixture, PollSpreadsUploadsOverFrames) {
+  constexpr int kTextureCount = 12;
+  // A budget below one texture limits each Poll to a single upload.
+  auto loader = CreateITextureLoader(
+      {.worker_count = 4, .staging_buffers = 2, .upload_budget_bytes = 1});
+  ASSERT_TRUE(loader.has_value());
+
+  vector<TextureFuture> futures;
+  for (int i = 0; i < kTextureCount; ++i) {
+    futures.push_back((*loader)->Load(path("screenshots/hello-window.png")));
+  }
+
+  int polls = 0;
+  while ((*loader)->GetPendingCount() > 0) {
+    const size_t before = (*loader)->GetPendingCount();
+    ASSERT_TRUE((*loader)->Poll().has_value());
+    EXPECT_GE((*loader)->GetPendingCount() + 1, before);
+    ++polls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_GE(polls, kTextureCount);
+
+  for (TextureFuture& future : futures) {
+    Expected<Texture> texture = future.get();
+    ASSERT_TRUE(texture.has_value());
+    DeleteTexture(*texture);
+  }
+}
+
+}  // namespace graphics_engine_tests::texture_loader_tests
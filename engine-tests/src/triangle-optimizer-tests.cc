@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Milton McDonald
+// This source code is licensed under the MIT License. See LICENSE file in the
+// project root for details.
+
+#include <graphics-engine/triangle-optimizer.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using graphics_engine::triangle_optimizer::AnalyzeVertexCache;
+using graphics_engine::triangle_optimizer::OptimizeOverdraw;
+using graphics_engine::triangle_optimizer::OptimizeVertexCache;
+using graphics_engine::triangle_optimizer::OptimizeVertexFetch;
+using graphics_engine::triangle_optimizer::VertexCacheStats;
+
+using std::array;
+using std::byte;
+using std::size_t;
+using std::span;
+using std::uint32_t;
+using std::vector;
+
+namespace graphics_engine_tests::triangle_optimizer_tests {
+
+namespace {
+
+struct Grid {
+  vector<float> positions;
+  vector<uint32_t> indices;
+  size_t vertex_count{};
+};
+
+// A `size` x `size` grid of quads with its triangles in random order.
+auto MakeShuffledGrid(uint32_t size) -> Grid {
+  Grid grid;
+  const uint32_t row = size + 1;
+  grid.vertex_count = static_cast<size_t>(row) * row;
+  for (uint32_t y = 0; y <= size; ++y) {
+    for (uint32_t x = 0; x <= size; ++x) {
+      grid.positions.push_back(static_cast<float>(x));
+      grid.positions.push_back(static_cast<float>(y));
+      grid.positions.push_back(0.F);
+    }
+  }
+
+  vector<array<uint32_t, 3>> triangles;
+  for (uint32_t y = 0; y < size; ++y) {
+    for (uint32_t x = 0; x < size; ++x) {
+      const uint32_t corner = (y * row) + x;
+      triangles.push_back({corner, corner + 1, corner + row});
+      triangles.push_back({corner + 1, corner + row + 1, corner + row});
+    }
+  }
+  std::ranges::shuffle(triangles, std::mt19937(42));
+  for (const array<uint32_t, 3>& triangle : triangles) {
+    grid.indices.insert(grid.indices.end(), triangle.begin(), triangle.end());
+  }
+
+  return grid;
+}
+
+// Sorted triangles with their first index rotated to the smallest one, so
+// reordered index buffers with the same windings compare equal.
+auto CanonicalTriangles(span<const uint32_t> indices)
+    -> vector<array<uint32_t, 3>> {
+  vector<array<uint32_t, 3>> triangles;
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    array<uint32_t, 3> triangle{indices[i], indices[i + 1], indices[i + 2]};
+    std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+    triangles.push_back(triangle);
+  }
+  std::ranges::sort(triangles);
+  return triangles;
+}
+
+}  // namespace
+
+TEST(TriangleOptimizerTests, AnalyzeVertexCacheCountsMisses) {
+  // Two triangles sharing an edge: four transforms for two triangles.
+  const array<uint32_t, 6> quad{0, 1, 2, 2, 1, 3};
+  const VertexCacheStats stats = AnalyzeVertexCache(quad, 4);
+  ASSERT_FLOAT_EQ(stats.acmr, 2.F);
+  ASSERT_FLOAT_EQ(stats.atvr, 1.F);
+
+  // A single cache entry only keeps the most recent vertex.
+  ASSERT_FLOAT_EQ(AnalyzeVertexCache(quad, 4, 1).acmr, 2.5F);
+}
+
+TEST(TriangleOptimizerTests, OptimizeVertexCacheImprovesAcmr) {
+  const Grid grid = MakeShuffledGrid(32);
+  const vector<uint32_t> optimized =
+      OptimizeVertexCache(grid.indices, grid.vertex_count);
+
+  ASSERT_EQ(CanonicalTriangles(optimized), CanonicalTriangles(grid.indices));
+
+  const VertexCacheStats before =
+      AnalyzeVertexCache(grid.indices, grid.vertex_count);
+  const VertexCacheStats after =
+      AnalyzeVertexCache(optimized, grid.vertex_count);
+  ASSERT_LT(after.acmr, before.acmr * 0.5F);
+  ASSERT_LT(after.acmr, 1.F);
+  ASSERT_LT(after.atvr, before.atvr);
+}
+
+TEST(TriangleOptimizerTests, OptimizeVertexCacheHandlesLargeMeshes) {
+  // Large enough to be split into chunks optimized on separate threads.
+  const Grid grid = MakeShuffledGrid(256);
+  const vector<uint32_t> optimized =
+      OptimizeVertexCache(grid.indices, grid.vertex_count);
+
+  ASSERT_EQ(CanonicalTriangles(optimized), CanonicalTriangles(grid.indices));
+  ASSERT_LT(AnalyzeVertexCache(optimized, grid.vertex_count).acmr,
+            AnalyzeVertexCache(grid.indices, grid.vertex_count).acmr);
+}
+
+TEST(TriangleOptimizerTests, OptimizeOverdrawKeepsTrianglesAndAcmr) {
+  const Grid grid = MakeShuffledGrid(32);
+  const vector<uint32_t> cache_optimized =
+      OptimizeVertexCache(grid.indices, grid.vertex_count);
+  const vector<uint32_t> optimized =
+      OptimizeOverdraw(cache_optimized, grid.positions, 1.05F);
+
+  ASSERT_EQ(CanonicalTriangles(optimized), CanonicalTriangles(grid.indices));
+  ASSERT_LE(AnalyzeVertexCache(optimized, grid.vertex_count).acmr,
+            AnalyzeVertexCache(cache_optimized, grid.vertex_count).acmr *
+                1.05F);
+}
+
+TEST(TriangleOptimizerTests, OptimizeVertexFetchOrdersByFirstUse) {
+  const array<float, 5> vertices{10.F, 11.F, 12.F, 13.F, 14.F};
+  array<uint32_t, 6> indices{3, 1, 4, 4, 1, 0};
+
+  const vector<byte> reordered = OptimizeVertexFetch(
+      indices, std::as_bytes(span(vertices)), sizeof(float));
+
+  ASSERT_EQ(indices, (array<uint32_t, 6>{0, 1, 2, 2, 1, 3}));
+  ASSERT_EQ(reordered.size(), 4 * sizeof(float));
+  // NOLINTNEXTLINE(*-reinterpret-cast)
+  const auto* values = reinterpret_cast<const float*>(reordered.data());
+  ASSERT_EQ(values[0], 13.F);
+  ASSERT_EQ(values[1], 11.F);
+  ASSERT_EQ(values[2], 14.F);
+  ASSERT_EQ(values[3], 10.F);
+}
+
+}  // namespace graphics_engine_tests::triangle_optimizer_tests